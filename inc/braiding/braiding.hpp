@@ -292,6 +292,18 @@ void centralizer_case();
  */
 void conjugacy_case();
 
+/**
+ * @brief Puts every braid of a file in LCF, and prints them in standard output.
+ *
+ * The file holds one braid per line, and is read with
+ * `garcide::stream::for_each_braid`. Errors are reported in standard error.
+ *
+ * @param parameter The parameter of the braids, as a string.
+ * @param path The path to the file.
+ * @return `0` on success, `1` otherwise.
+ */
+int batch_lcf(const std::string &parameter, const std::string &path);
+
 #if BRAIDING_CLASS == 0
 
 /**
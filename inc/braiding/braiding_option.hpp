@@ -58,6 +58,10 @@
 
 #include "garcide/groups/euclidean_lattice.hpp"
 
+#elif BRAIDING_CLASS == 7
+
+#include "garcide/groups/coxeter.hpp"
+
 #endif
 
 namespace braiding {
@@ -109,6 +113,11 @@ using Braid = garcide::standard_complex::Braid;
 using Factor = garcide::euclidean_lattice::Factor;
 using Braid = garcide::euclidean_lattice::Braid;
 
+#elif BRAIDING_CLASS == 7
+
+using Factor = garcide::coxeter::Factor;
+using Braid = garcide::coxeter::Braid;
+
 #endif
 
 }
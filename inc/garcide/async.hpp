@@ -0,0 +1,463 @@
+/**
+ * @file async.hpp
+ * @author GarCide contributors
+ * @brief Header file for computations that run in the background.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ASYNC
+#define ASYNC
+
+#include "garcide/auto_conjugacy.hpp"
+#include "garcide/centralizer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Namespace for computations that run in the background.
+ *
+ * Computations are submitted to the task pool of the library, and the
+ * functions that submit them return at once, with a handle (a `Future`) to
+ * their result. A thread may then submit many computations, and collect their
+ * results as they are ready.
+ *
+ * When the library is built with parallelism, the task pool is _TBB_'s: the
+ * submitted computations, and the parallel sections within them, all share the
+ * same workers, so that running many computations at once does not
+ * oversubscribe the machine. Computations are started in the order they are
+ * submitted. Otherwise, the task pool is a fixed set of threads, one per core,
+ * that take computations from a queue in the order they were submitted.
+ *
+ * Cancellation is cooperative: algorithms call `checkpoint` once for every
+ * vertex of the graphs they explore, and a cancelled computation stops at the
+ * next one. The number of calls so far is its progress.
+ *
+ * Batches of computations are submitted hardest first (as estimated by
+ * `auto_conjugacy::expected_cost` and
+ * `auto_conjugacy::expected_ultra_summit_cost`), so that the few long ones do
+ * not start last and leave workers idle at the end.
+ */
+namespace garcide::async {
+
+/**
+ * @brief Submits a job to the task pool.
+ *
+ * `current_task()` is set to `task` while `job` runs.
+ *
+ * @param task The control of the computation.
+ * @param job The job, that must not throw.
+ */
+void enqueue(std::shared_ptr<TaskControl> task, std::function<void()> job);
+
+/**
+ * @brief The number of workers of the task pool.
+ *
+ * @return The number of jobs that may run at once.
+ */
+unsigned int number_of_workers();
+
+/**
+ * @brief Handle to the result of a computation that runs in the background.
+ *
+ * @tparam T The type of the result.
+ */
+template <class T> class Future {
+  private:
+    /**
+     * @brief The control of the computation.
+     */
+    std::shared_ptr<TaskControl> task;
+
+    /**
+     * @brief The result.
+     */
+    std::future<T> result;
+
+  public:
+    /**
+     * @brief Constructs a handle.
+     *
+     * @param task The control of the computation.
+     * @param result A future to its result.
+     */
+    Future(std::shared_ptr<TaskControl> task, std::future<T> result)
+        : task(task), result(std::move(result)) {}
+
+    /**
+     * @brief Checks if the computation is over.
+     *
+     * @return If the result (or an exception) is available.
+     */
+    inline bool ready() const {
+        return result.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready;
+    }
+
+    /**
+     * @brief Waits until the computation is over.
+     */
+    inline void wait() const { result.wait(); }
+
+    /**
+     * @brief Waits until the computation is over, and returns its result.
+     *
+     * This may only be called once.
+     *
+     * @return The result.
+     * @exception Cancelled Thrown if the computation was cancelled before it
+     * was over.
+     */
+    inline T get() { return result.get(); }
+
+    /**
+     * @brief Asks the computation to stop.
+     *
+     * It then stops at its next checkpoint (or does not start, if it was not
+     * started yet). It may still be over if it was nearly done.
+     */
+    inline void cancel() { task->cancelled = true; }
+
+    /**
+     * @brief Progress of the computation.
+     *
+     * @return The number of steps that were taken so far (see `checkpoint`).
+     */
+    inline u64 progress() const { return task->steps; }
+};
+
+/**
+ * @brief Runs a function in the background.
+ *
+ * @tparam Fun A class of functions that take no argument.
+ * @param fun The function, that is copied. It should call `checkpoint`
+ * regularly, to be cancellable.
+ * @return A handle to the result of `fun`.
+ */
+template <class Fun> Future<std::invoke_result_t<Fun>> submit(Fun fun) {
+    using T = std::invoke_result_t<Fun>;
+
+    std::shared_ptr<TaskControl> task = std::make_shared<TaskControl>();
+    // std::function needs a copyable target.
+    std::shared_ptr<std::packaged_task<T()>> job =
+        std::make_shared<std::packaged_task<T()>>([fun]() {
+            checkpoint();
+            return fun();
+        });
+
+    Future<T> future(task, job->get_future());
+    enqueue(task, [job]() { (*job)(); });
+    return future;
+}
+
+/**
+ * @brief A job of a batch, as it was run.
+ */
+struct ScheduledJob {
+    /**
+     * @brief The index of the job in the batch.
+     */
+    size_t index;
+
+    /**
+     * @brief Its expected cost (for the batches of this namespace, a score in
+     * arbitrary units, see `auto_conjugacy::summit_cost`).
+     */
+    double expected_cost;
+
+    /**
+     * @brief When it started, in seconds since the batch was submitted.
+     */
+    double start;
+
+    /**
+     * @brief When it was over, in seconds since the batch was submitted.
+     */
+    double end;
+};
+
+/**
+ * @brief How a batch was run.
+ */
+struct Schedule {
+    /**
+     * @brief The number of workers of the task pool.
+     */
+    unsigned int workers = 0;
+
+    /**
+     * @brief The time the batch took, in seconds.
+     */
+    double makespan = 0;
+
+    /**
+     * @brief The jobs, in the order they were submitted (that is, by
+     * decreasing expected cost).
+     */
+    std::vector<ScheduledJob> jobs;
+
+    /**
+     * @brief The fraction of the time of the workers that was spent running
+     * jobs.
+     *
+     * Parallel sections within jobs are not accounted for: a job counts for
+     * one worker while it runs.
+     *
+     * @return The sum of the running times of the jobs, divided by `workers`
+     * times `makespan`.
+     */
+    double utilization() const {
+        double busy = 0;
+        for (const ScheduledJob &job : jobs) {
+            busy += job.end - job.start;
+        }
+        return makespan > 0 ? busy / (workers * makespan) : 1;
+    }
+
+    /**
+     * @brief Prints the schedule in output stream `os`.
+     *
+     * @param os The `IndentedOStream` `*this` is printed in.
+     */
+    void print(IndentedOStream &os = ind_cout) const {
+        os << jobs.size() << " jobs on " << workers << " workers, in "
+           << makespan << " s (utilization " << utilization() << ")";
+        for (const ScheduledJob &job : jobs) {
+            os << EndLine() << "Job " << job.index << ": expected cost "
+               << job.expected_cost << ", from " << job.start << " s to "
+               << job.end << " s";
+        }
+    }
+};
+
+/**
+ * @brief Runs a batch of jobs, hardest first, and waits for their results.
+ *
+ * Jobs are submitted by decreasing expected cost (ties keep the order of the
+ * batch). When the library is built with parallelism, parallel sections
+ * within the long jobs are shared with the workers that are done with the
+ * short ones.
+ *
+ * @tparam Fun A class of functions that take the index of a job.
+ * @param costs The expected costs of the jobs.
+ * @param fun The jobs: `fun(i)` runs the `i`-th one. It is copied.
+ * @param schedule Set by the function to how the batch was run.
+ * @return The results of the jobs, in the order of the batch. If a job
+ * throws, its exception is rethrown once all of them are over.
+ */
+template <class Fun>
+std::vector<std::invoke_result_t<Fun, size_t>>
+run_batch(const std::vector<double> &costs, Fun fun, Schedule &schedule) {
+    using T = std::invoke_result_t<Fun, size_t>;
+    using Clock = std::chrono::steady_clock;
+    using Times = std::vector<std::pair<Clock::time_point, Clock::time_point>>;
+
+    std::vector<size_t> order(costs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&costs](size_t i, size_t j) {
+        return costs[i] > costs[j];
+    });
+
+    std::shared_ptr<Times> times = std::make_shared<Times>(costs.size());
+    Clock::time_point begin = Clock::now();
+
+    // Futures are not default-constructible.
+    std::vector<std::optional<Future<T>>> futures(costs.size());
+    for (size_t i : order) {
+        futures[i].emplace(submit([fun, i, times]() {
+            (*times)[i].first = Clock::now();
+            try {
+                T result = fun(i);
+                (*times)[i].second = Clock::now();
+                return result;
+            } catch (...) {
+                (*times)[i].second = Clock::now();
+                throw;
+            }
+        }));
+    }
+    for (const std::optional<Future<T>> &future : futures) {
+        future->wait();
+    }
+
+    auto seconds = [begin](Clock::time_point t) {
+        return std::chrono::duration<double>(t - begin).count();
+    };
+    schedule.workers = number_of_workers();
+    schedule.makespan = seconds(Clock::now());
+    schedule.jobs.clear();
+    for (size_t i : order) {
+        schedule.jobs.push_back(ScheduledJob{i, costs[i],
+                                             seconds((*times)[i].first),
+                                             seconds((*times)[i].second)});
+    }
+
+    std::vector<T> results;
+    results.reserve(costs.size());
+    for (std::optional<Future<T>> &future : futures) {
+        results.push_back(future->get());
+    }
+    return results;
+}
+
+/**
+ * @brief Computes the centralizer of `b` in the background.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid.
+ * @return A handle to the centralizer of `b`.
+ */
+template <class F>
+Future<garcide::centralizer::Centralizer<BraidTemplate<F>>>
+centralizer(const BraidTemplate<F> &b) {
+    return submit([b]() { return garcide::centralizer::centralizer(b); });
+}
+
+/**
+ * @brief Computes the ultra summit set of `b` in the background.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid.
+ * @return A handle to the ultra summit set of `b`.
+ */
+template <class F>
+Future<ultra_summit::UltraSummitSet<BraidTemplate<F>>>
+ultra_summit_set(const BraidTemplate<F> &b) {
+    return submit([b]() { return ultra_summit::ultra_summit_set(b); });
+}
+
+/**
+ * @brief Checks if two braids are conjugates in the background.
+ *
+ * This uses `auto_conjugacy::are_conjugate`.
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param model The model used to choose the engine.
+ * @return A handle to a conjugator \f$c\f$ such that \f$c^{-1}b_1c = b_2\f$,
+ * if `b1` and `b2` are conjugates, and to nothing otherwise.
+ */
+template <class F>
+Future<std::optional<BraidTemplate<F>>>
+are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
+              const auto_conjugacy::CostModel &model =
+                  auto_conjugacy::CostModel()) {
+    return submit([b1, b2, model]() {
+        BraidTemplate<F> c = BraidTemplate<F>(b1.get_parameter());
+        return auto_conjugacy::are_conjugate(b1, b2, c, model)
+                   ? std::optional<BraidTemplate<F>>(c)
+                   : std::nullopt;
+    });
+}
+
+/**
+ * @brief Computes ultra summit sets of many braids, hardest first.
+ *
+ * The cost of each braid is estimated with
+ * `auto_conjugacy::expected_ultra_summit_cost`, in a first batch.
+ *
+ * @tparam F A class representing factors.
+ * @param braids The braids.
+ * @param estimation Set by the function to how the batch that estimates the
+ * costs was run.
+ * @param schedule Set by the function to how the batch was run.
+ * @param model The model used to estimate the costs.
+ * @return The ultra summit sets of `braids`, in the same order.
+ */
+template <class F>
+std::vector<ultra_summit::UltraSummitSet<BraidTemplate<F>>>
+ultra_summit_set(const std::vector<BraidTemplate<F>> &braids,
+                 Schedule &estimation, Schedule &schedule,
+                 const auto_conjugacy::CostModel &model =
+                     auto_conjugacy::CostModel()) {
+    std::vector<double> costs =
+        run_batch(std::vector<double>(braids.size()),
+                  [&braids, model](size_t i) {
+                      return auto_conjugacy::expected_ultra_summit_cost(
+                          braids[i], model);
+                  },
+                  estimation);
+    return run_batch(
+        costs,
+        [&braids](size_t i) {
+            return ultra_summit::ultra_summit_set(braids[i]);
+        },
+        schedule);
+}
+
+/**
+ * @brief Checks if the braids of many pairs are conjugates, hardest first.
+ *
+ * This uses `auto_conjugacy::are_conjugate`, and the cost of each pair is
+ * estimated with `auto_conjugacy::expected_cost`, in a first batch.
+ *
+ * @tparam F A class representing factors.
+ * @param pairs The pairs of braids.
+ * @param estimation Set by the function to how the batch that estimates the
+ * costs was run.
+ * @param schedule Set by the function to how the batch was run.
+ * @param model The model used to choose the engines and estimate the costs.
+ * @return For each pair \f$(b_1,b_2)\f$, in the same order, a conjugator
+ * \f$c\f$ such that \f$c^{-1}b_1c = b_2\f$, if they are conjugates, and
+ * nothing otherwise.
+ */
+template <class F>
+std::vector<std::optional<BraidTemplate<F>>>
+are_conjugate(const std::vector<std::pair<BraidTemplate<F>, BraidTemplate<F>>>
+                  &pairs,
+              Schedule &estimation, Schedule &schedule,
+              const auto_conjugacy::CostModel &model =
+                  auto_conjugacy::CostModel()) {
+    std::vector<double> costs =
+        run_batch(std::vector<double>(pairs.size()),
+                  [&pairs, model](size_t i) {
+                      return auto_conjugacy::expected_cost(
+                          pairs[i].first, pairs[i].second, model);
+                  },
+                  estimation);
+    return run_batch(
+        costs,
+        [&pairs, model](size_t i) {
+            BraidTemplate<F> c =
+                BraidTemplate<F>(pairs[i].first.get_parameter());
+            return auto_conjugacy::are_conjugate(pairs[i].first,
+                                                 pairs[i].second, c, model)
+                       ? std::optional<BraidTemplate<F>>(c)
+                       : std::nullopt;
+        },
+        schedule);
+}
+
+} // namespace garcide::async
+
+#endif
@@ -0,0 +1,605 @@
+/**
+ * @file auto_conjugacy.hpp
+ * @author GarCide contributors
+ * @brief Header file for conjugacy tests that pick their summit set.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AUTO_CONJUGACY
+#define AUTO_CONJUGACY
+
+#include "garcide/sliding_circuits.hpp"
+#include "garcide/ultra_summit.hpp"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+
+/**
+ * @brief Namespace for conjugacy tests that pick their summit set.
+ *
+ * `super_summit`, `ultra_summit` and `sliding_circuits` all solve the
+ * conjugacy problem, and which one is the fastest depends on the braids. This
+ * namespace looks at a few features of the braids that are cheap to compute
+ * (once they are sent to their sliding circuits sets), and uses them to choose
+ * one.
+ */
+namespace garcide::auto_conjugacy {
+
+/**
+ * @brief `enum` for the summit sets a conjugacy test can rely on.
+ */
+enum class Engine { SuperSummit, UltraSummit, SlidingCircuits };
+
+} // namespace garcide::auto_conjugacy
+
+namespace garcide {
+
+/**
+ * @brief Inserts an engine in the output stream.
+ *
+ * @param engine The engine to be inserted.
+ * @return A reference to `*this`, so that `<<` may be chained.
+ */
+template <>
+inline IndentedOStream &IndentedOStream::operator<< <auto_conjugacy::Engine>(
+    const auto_conjugacy::Engine &engine) {
+    switch (engine) {
+    case auto_conjugacy::Engine::SuperSummit:
+        os << "super summit sets";
+        break;
+    case auto_conjugacy::Engine::UltraSummit:
+        os << "ultra summit sets";
+        break;
+    case auto_conjugacy::Engine::SlidingCircuits:
+        os << "sliding circuits sets";
+        break;
+    }
+    return *this;
+}
+
+} // namespace garcide
+
+namespace garcide::auto_conjugacy {
+
+/**
+ * @brief Parameters of the model that chooses an engine.
+ *
+ * The default values were chosen by timing the three engines on random
+ * conjugate pairs, in `artin` and `band`, for \f$3\leq n\leq 8\f$.
+ */
+struct CostModel {
+    /**
+     * @brief Super summit sets are used for non-rigid braids of canonical
+     * length \f$\ell\f$, in a lattice of height \f$h\f$, if \f$h\f$ is at most
+     * `super_summit_max_height` and \f$\ell h\f$ is at most
+     * `super_summit_budget`.
+     *
+     * Super summit sets grow very fast with both, but are cheap to explore
+     * as long as they are small.
+     */
+    i16 super_summit_budget = 30;
+
+    /**
+     * @brief See `super_summit_budget`.
+     */
+    i16 super_summit_max_height = 10;
+
+    /**
+     * @brief Whether ultra summit sets may be used (for rigid braids).
+     *
+     * They are often the fastest for rigid braids, but `ultra_summit` is only
+     * reliable for some Garside structures (see `ultra_summit::NotUltraSummit`)
+     * so this is off by default.
+     */
+    bool trust_ultra_summit = false;
+
+    /**
+     * @brief The number of vertices of the graph of the summit set that
+     * `expected_cost` and `expected_ultra_summit_cost` explore.
+     */
+    i16 probe_steps = 4;
+
+    /**
+     * @brief The exponent applied to the number of conjugates the probe finds
+     * in `expected_cost` and `expected_ultra_summit_cost`.
+     *
+     * The more conjugates the first vertices have, the faster the summit set
+     * tends to grow, so that its size is more than linear in that number.
+     */
+    double probe_exponent = 2;
+
+    /**
+     * @brief The factor applied to the cost of rigid pairs in `expected_cost`
+     * and `expected_ultra_summit_cost`.
+     *
+     * Rigid braids only have rigid neighbours, and their trajectories are
+     * shorter, so that their summit sets are cheaper to explore.
+     */
+    double rigid_factor = 0.5;
+};
+
+/**
+ * @brief Cheap features of a pair of braids, that the choice of an engine is
+ * based on.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> struct Features {
+    /**
+     * @brief The parameter of the braids.
+     */
+    typename F::Parameter parameter;
+
+    /**
+     * @brief The height of the lattice of simple elements.
+     */
+    i16 lattice_height;
+
+    /**
+     * @brief The infimum of the summit representative of the first braid.
+     */
+    i16 inf;
+
+    /**
+     * @brief The supremum of the summit representative of the first braid.
+     */
+    i16 sup;
+
+    /**
+     * @brief Whether the summit representatives of both braids have the same
+     * infimum and supremum (otherwise, they are not conjugates).
+     */
+    bool summits_match;
+
+    /**
+     * @brief Whether the summit representatives of both braids are rigid.
+     */
+    bool rigid;
+
+    /**
+     * @brief The canonical length of the summit representative of the first
+     * braid.
+     *
+     * @return `sup - inf`.
+     */
+    inline i16 canonical_length() const { return sup - inf; }
+
+    /**
+     * @brief Prints the features in output stream `os`.
+     *
+     * @param os The `IndentedOStream` `*this` is printed in.
+     */
+    void print(IndentedOStream &os = ind_cout) const {
+        os << "parameter " << parameter << ", lattice height "
+           << lattice_height << ", inf " << inf << ", sup " << sup
+           << (rigid ? ", rigid" : ", not rigid")
+           << (summits_match ? "" : ", summits do not match");
+    }
+};
+
+/**
+ * @brief Computes the features of two braids, from their summit
+ * representatives.
+ *
+ * @tparam F A class representing factors.
+ * @param bt1 A braid in its sliding circuits set.
+ * @param bt2 Another braid in its sliding circuits set.
+ * @return The features of `bt1` and `bt2`.
+ */
+template <class F>
+Features<F> summit_features(const BraidTemplate<F> &bt1,
+                            const BraidTemplate<F> &bt2) {
+    typename F::Parameter n = bt1.get_parameter();
+
+    // Parameters need not be default-constructible.
+    return Features<F>{n,
+                       i16(F(n).lattice_height()),
+                       i16(bt1.inf()),
+                       i16(bt1.sup()),
+                       bt1.inf() == bt2.inf() && bt1.sup() == bt2.sup(),
+                       bt1.is_rigid() && bt2.is_rigid()};
+}
+
+/**
+ * @brief Computes the features of `b1` and `b2`.
+ *
+ * Both are sent to their sliding circuits sets (which is polynomial).
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @return The features of `b1` and `b2`.
+ */
+template <class F>
+Features<F> features(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2) {
+    return summit_features(sliding_circuits::send_to_sliding_circuits(b1),
+                           sliding_circuits::send_to_sliding_circuits(b2));
+}
+
+/**
+ * @brief Explores the first vertices of the graph of the sliding circuits set
+ * of a braid.
+ *
+ * This runs the first `steps` steps of the breadth-first search of
+ * `sliding_circuits::sliding_circuits_set`, without looking for repetitions
+ * (which requires computing trajectories), and counts the conjugates it
+ * finds.
+ *
+ * @tparam F A class representing factors.
+ * @param bt A braid in its sliding circuits set.
+ * @param steps The number of vertices to explore.
+ * @return The number of conjugates found, counting `bt`.
+ */
+template <class F> size_t probe(const BraidTemplate<F> &bt, i16 steps) {
+    std::deque<BraidTemplate<F>> queue;
+    queue.push_back(bt);
+    size_t found = 1;
+
+    for (i16 _ = 0; _ < steps && !queue.empty(); _++) {
+        BraidTemplate<F> b_rcf = queue.front();
+        b_rcf.lcf_to_rcf();
+        for (const F &f :
+             sliding_circuits::min_sliding_circuits(queue.front(), b_rcf)) {
+            BraidTemplate<F> b = queue.front();
+            b.conjugate(f);
+            queue.push_back(b);
+            found++;
+        }
+        queue.pop_front();
+    }
+    return found;
+}
+
+/**
+ * @brief Explores the first vertices of the graph of the ultra summit set of a
+ * braid.
+ *
+ * This is `probe`, for `ultra_summit::ultra_summit_set`. The probe stops
+ * early if `ultra_summit::min_ultra_summit` throws `NotUltraSummit` (the
+ * computation of the ultra summit set then throws as well).
+ *
+ * @tparam F A class representing factors.
+ * @param bt A braid in its ultra summit set.
+ * @param steps The number of vertices to explore.
+ * @return The number of conjugates found, counting `bt`.
+ */
+template <class F>
+size_t probe_ultra_summit(const BraidTemplate<F> &bt, i16 steps) {
+    std::deque<BraidTemplate<F>> queue;
+    queue.push_back(bt);
+    size_t found = 1;
+
+    try {
+        for (i16 _ = 0; _ < steps && !queue.empty(); _++) {
+            BraidTemplate<F> b_rcf = queue.front();
+            b_rcf.lcf_to_rcf();
+            for (const F &f :
+                 ultra_summit::min_ultra_summit(queue.front(), b_rcf)) {
+                BraidTemplate<F> b = queue.front();
+                b.conjugate(f);
+                queue.push_back(b);
+                found++;
+            }
+            queue.pop_front();
+        }
+    } catch (ultra_summit::NotUltraSummit<BraidTemplate<F>> const &) {
+    }
+    return found;
+}
+
+/**
+ * @brief Scores the work of exploring a summit set, from the features of its
+ * representative and the number of conjugates a probe found.
+ *
+ * The score is \f$\ell h v^e\f$, where \f$\ell\f$ is the canonical length
+ * (at least 1), \f$h\f$ the height of the lattice, \f$v\f$ the number of
+ * conjugates found and \f$e\f$ `model.probe_exponent`, times
+ * `model.rigid_factor` for rigid pairs.
+ *
+ * @tparam F A class representing factors.
+ * @param f The features of the representative.
+ * @param found The number of conjugates found by the probe (1 if there was
+ * none).
+ * @param model The model, that gives the exponent and the factor of rigid
+ * pairs.
+ * @return The score.
+ */
+template <class F>
+double summit_cost(const Features<F> &f, size_t found,
+                   const CostModel &model) {
+    double cost = double(std::max(f.canonical_length(), i16(1))) *
+                  double(f.lattice_height) *
+                  std::pow(double(found), model.probe_exponent);
+    return f.rigid ? cost * model.rigid_factor : cost;
+}
+
+/**
+ * @brief Estimates the work needed to check if `b1` and `b2` are conjugates.
+ *
+ * Both braids are sent to their sliding circuits sets, and the first
+ * `model.probe_steps` vertices of the graph of the first one are explored
+ * (with `probe`), unless the summit representatives do not match or have
+ * canonical length at most 1. The estimate is then `summit_cost` of the
+ * features of the pair and of the number of conjugates found.
+ *
+ * The estimate only depends on the braids and on `model`, and is only meant
+ * to compare pairs (to schedule the hardest first).
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param model The model, that gives the number of steps of the probe and
+ * the weights of the score.
+ * @return The expected cost of the test, in arbitrary units.
+ */
+template <class F>
+double expected_cost(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
+                     const CostModel &model = CostModel()) {
+    BraidTemplate<F> bt1 = sliding_circuits::send_to_sliding_circuits(b1);
+    Features<F> f =
+        summit_features(bt1, sliding_circuits::send_to_sliding_circuits(b2));
+
+    size_t found = 1;
+    if (f.summits_match && f.canonical_length() > 1) {
+        found = probe(bt1, std::max(model.probe_steps, i16(1)));
+    }
+    return summit_cost(f, found, model);
+}
+
+/**
+ * @brief Estimates the work needed to compute the ultra summit set of `b`.
+ *
+ * `b` is sent to its ultra summit set, and the first `model.probe_steps`
+ * vertices of its graph are explored (with `probe_ultra_summit`), unless its
+ * canonical length is at most 1. The estimate is then `summit_cost` of the
+ * features of the representative and of the number of conjugates found.
+ *
+ * The estimate only depends on `b` and on `model`, and is only meant to
+ * compare braids (to schedule the hardest first).
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid.
+ * @param model The model, that gives the number of steps of the probe and
+ * the weights of the score.
+ * @return The expected cost of the computation, in arbitrary units.
+ */
+template <class F>
+double expected_ultra_summit_cost(const BraidTemplate<F> &b,
+                                  const CostModel &model = CostModel()) {
+    BraidTemplate<F> bt = ultra_summit::send_to_ultra_summit(b);
+    Features<F> f = summit_features(bt, bt);
+
+    size_t found = 1;
+    if (f.canonical_length() > 1) {
+        found = probe_ultra_summit(bt, std::max(model.probe_steps, i16(1)));
+    }
+    return summit_cost(f, found, model);
+}
+
+/**
+ * @brief Chooses the engine that is expected to be the fastest, given the
+ * features of a pair of braids.
+ *
+ * - If the summit representatives do not match, or if their canonical length
+ * is at most 1, super summit sets are used: either nothing is explored, or
+ * super summit sets are small.
+ * - Rigid braids are dealt with by ultra summit sets if the model trusts
+ * them, and by sliding circuits sets otherwise, which both start by
+ * exploring rigid elements only.
+ * - Other braids are dealt with by super summit sets if the model deems them
+ * small enough, and by sliding circuits sets otherwise.
+ *
+ * @tparam F A class representing factors.
+ * @param f The features of a pair of braids.
+ * @param model The model used to choose.
+ * @return The chosen engine.
+ */
+template <class F>
+Engine choose_engine(const Features<F> &f,
+                     const CostModel &model = CostModel()) {
+    if (!f.summits_match || f.canonical_length() <= 1) {
+        return Engine::SuperSummit;
+    }
+    if (f.rigid) {
+        return model.trust_ultra_summit ? Engine::UltraSummit
+                                        : Engine::SlidingCircuits;
+    }
+    if (f.lattice_height <= model.super_summit_max_height &&
+        f.canonical_length() * f.lattice_height <=
+            model.super_summit_budget) {
+        return Engine::SuperSummit;
+    }
+    return Engine::SlidingCircuits;
+}
+
+/**
+ * @brief The choice of an engine, with what it was based on.
+ *
+ * The sliding circuits representatives the features were computed on are
+ * kept, with their conjugators, so that the conjugacy test does not compute
+ * them again.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> struct Decision {
+    /**
+     * @brief The features the choice was based on.
+     */
+    Features<F> features;
+
+    /**
+     * @brief The chosen engine.
+     */
+    Engine engine;
+
+    /**
+     * @brief The sliding circuits representative of the first braid.
+     */
+    BraidTemplate<F> summit1;
+
+    /**
+     * @brief The sliding circuits representative of the second braid.
+     */
+    BraidTemplate<F> summit2;
+
+    /**
+     * @brief The conjugator that takes the first braid to `summit1`.
+     */
+    BraidTemplate<F> conjugator1;
+
+    /**
+     * @brief The conjugator that takes the second braid to `summit2`.
+     */
+    BraidTemplate<F> conjugator2;
+
+    /**
+     * @brief Prints the decision in output stream `os`.
+     *
+     * @param os The `IndentedOStream` `*this` is printed in.
+     */
+    void print(IndentedOStream &os = ind_cout) const {
+        os << "Using " << engine << " (";
+        features.print(os);
+        os << ").";
+    }
+};
+
+/**
+ * @brief Chooses the engine that is expected to be the fastest to test if
+ * `b1` and `b2` are conjugates.
+ *
+ * Both are sent to their sliding circuits sets (which is polynomial).
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param model The model used to choose.
+ * @return The chosen engine, with the features it was chosen on and the
+ * sliding circuits representatives they were computed from.
+ */
+template <class F>
+Decision<F> decide(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
+                   const CostModel &model = CostModel()) {
+    typename F::Parameter n = b1.get_parameter();
+    BraidTemplate<F> c1 = BraidTemplate<F>(n), c2 = BraidTemplate<F>(n);
+    BraidTemplate<F> bt1 = sliding_circuits::send_to_sliding_circuits(b1, c1),
+                     bt2 = sliding_circuits::send_to_sliding_circuits(b2, c2);
+    Features<F> f = summit_features(bt1, bt2);
+    return Decision<F>{f, choose_engine(f, model), bt1, bt2, c1, c2};
+}
+
+/**
+ * @brief Checks if two braids are conjugates, and computes a conjugator,
+ * with a given engine.
+ *
+ * `c` is not modified if `b1` and `b2` are not conjugates.
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param c A braid, that is set by the function to the conjugator that takes
+ * `b1` to `b2`, if it exists.
+ * @param engine The engine to use.
+ * @return If `b1` and `b2` are conjugates.
+ */
+template <class F>
+bool are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
+                   BraidTemplate<F> &c, Engine engine) {
+    switch (engine) {
+    case Engine::SuperSummit:
+        return super_summit::are_conjugate(b1, b2, c);
+    case Engine::UltraSummit:
+        return ultra_summit::are_conjugate(b1, b2, c);
+    default:
+        return sliding_circuits::are_conjugate(b1, b2, c);
+    }
+}
+
+/**
+ * @brief Checks if the two braids a decision was taken on are conjugates, and
+ * computes a conjugator, with the chosen engine.
+ *
+ * The engine starts from the sliding circuits representatives of the
+ * decision, which are in their super summit sets as well.
+ *
+ * `c` is not modified if the braids are not conjugates.
+ *
+ * @tparam F A class representing factors.
+ * @param decision The decision returned by `decide`.
+ * @param c A braid, that is set by the function to the conjugator that takes
+ * the first braid to the second one, if it exists.
+ * @return If the braids are conjugates.
+ */
+template <class F>
+bool are_conjugate(const Decision<F> &decision, BraidTemplate<F> &c) {
+    if (!decision.features.summits_match) {
+        return false;
+    }
+
+    BraidTemplate<F> ct = BraidTemplate<F>(decision.features.parameter);
+    bool conjugates;
+    switch (decision.engine) {
+    case Engine::SuperSummit:
+        conjugates =
+            super_summit::are_conjugate(decision.summit1, decision.summit2, ct);
+        break;
+    case Engine::UltraSummit:
+        conjugates =
+            ultra_summit::are_conjugate(decision.summit1, decision.summit2, ct);
+        break;
+    default:
+        conjugates = sliding_circuits::are_conjugate_summits(
+            decision.summit1, decision.summit2, ct);
+    }
+
+    if (conjugates) {
+        c = decision.conjugator1 * ct * !decision.conjugator2;
+    }
+    return conjugates;
+}
+
+/**
+ * @brief Checks if two braids are conjugates, and computes a conjugator,
+ * with the engine that is expected to be the fastest.
+ *
+ * `c` is not modified if `b1` and `b2` are not conjugates.
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param c A braid, that is set by the function to the conjugator that takes
+ * `b1` to `b2`, if it exists.
+ * @param model The model used to choose the engine.
+ * @return If `b1` and `b2` are conjugates.
+ */
+template <class F>
+bool are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
+                   BraidTemplate<F> &c, const CostModel &model = CostModel()) {
+    return are_conjugate(decide(b1, b2, model), c);
+}
+
+} // namespace garcide::auto_conjugacy
+
+#endif
@@ -0,0 +1,387 @@
+/**
+ * @file c_api.h
+ * @author GarCide contributors
+ * @brief Header file for the C interface of the library.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * This header is meant to be usable from C (and from any language that can
+ * call C functions), so that it only uses C types.
+ *
+ * Braids are passed as binary buffers, in which all integers are
+ * little-endian. A buffer starts with a header, that holds:
+ *
+ * - the length of the parameter, as a 32-bit integer, and the parameter, as
+ *   it was passed to `garcide_group_new` (a buffer is only read by handles
+ *   with an equal parameter);
+ * - the size of packed factors, in bytes, as a 32-bit integer (see
+ *   `garcide_factor_size`).
+ *
+ * Then comes the infimum, as a signed 64-bit integer (within the range of
+ * `int`), the number of factors, as a 64-bit integer, and the factors, each in
+ * packed form. That is the tables that represent it in the library, with
+ * 16-bit entries unless stated otherwise:
+ *
+ * - `artin` and `band` (with \f$n\f$ strands): the inverse permutation table,
+ *   from index \f$1\f$ to \f$n\f$. For `band`, the permutation must have
+ *   decreasing cycles, along a non-crossing partition.
+ * - `octahedral` (with parameter \f$n\f$): the first half of the inverse
+ *   table of the centrally symmetric permutation of \f$[\![1,2n]\!]\f$, from
+ *   index \f$1\f$ to \f$n\f$.
+ * - `dual_complex` (with parameter \f$(e,n)\f$): for each index from \f$0\f$
+ *   to \f$n\f$, its entries in the inverse permutation table and in the
+ *   coefficient table (where \f$k\f$ stands for \f$\zeta_e^k\f$).
+ * - `standard_complex` (with parameter \f$(e,n)\f$): the inverse
+ *   permutation table (from index \f$0\f$ to \f$n-1\f$), then the
+ *   coefficient table.
+ * - `euclidean_lattice` (with parameter \f$n\f$): the coordinates, as
+ *   \f$\lceil n/8\rceil\f$ bytes (coordinate `i` is bit `i % 8` of byte
+ *   `i / 8`).
+ * - `dihedral`: the type (`0` for the identity, `1` for \f$\Delta\f$ and `2`
+ *   for reflections), then the vertex `0` is sent on by reflections (and `0`
+ *   for other factors).
+ * - `coxeter`: the index of the factor in the tables of the structure, as a
+ *   32-bit integer (these tables only depend on the parameter).
+ *
+ * Input buffers may hold any sequence of simple elements (not necessarily in
+ * normal form), and `GARCIDE_INVALID_BUFFER` is returned if a factor is not a
+ * simple element. Output buffers always hold left normal forms. Braids are
+ * most easily built from the atoms (see `garcide_atom`), with products and
+ * inverses.
+ *
+ * Output buffers are supplied by the caller: `capacity` is their size, and
+ * `*size` is set to the number of bytes that are (or would be) written. If
+ * the buffer is too small, nothing is written and `GARCIDE_BUFFER_TOO_SMALL`
+ * is returned, so that the call may be made again with a large enough buffer.
+ * Buffers handed to callbacks are only valid during the callback.
+ *
+ * No exception crosses this interface. All functions are thread-safe.
+ */
+
+#ifndef GARCIDE_C_API_H
+#define GARCIDE_C_API_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Opaque handle to a group (a Garside structure and a parameter).
+ */
+typedef struct garcide_group garcide_group;
+
+/**
+ * @brief Status codes returned by the C interface.
+ */
+typedef enum garcide_status {
+    /**
+     * @brief Success.
+     */
+    GARCIDE_OK = 0,
+
+    /**
+     * @brief The group name, the parameter or an atom index is invalid.
+     */
+    GARCIDE_INVALID_ARGUMENT = 1,
+
+    /**
+     * @brief An input buffer does not hold a braid (or its infimum is out of
+     * range).
+     */
+    GARCIDE_INVALID_BUFFER = 2,
+
+    /**
+     * @brief An output buffer is too small.
+     */
+    GARCIDE_BUFFER_TOO_SMALL = 3,
+
+    /**
+     * @brief The computation failed.
+     */
+    GARCIDE_ERROR = 4
+} garcide_status;
+
+/**
+ * @brief Callback receiving braids, one at a time.
+ *
+ * @param braid A buffer holding a braid, only valid during the call.
+ * @param size The size of `braid`, in bytes.
+ * @param user_data The pointer that was passed along with the callback.
+ * @return `0` to go on, anything else to stop.
+ */
+typedef int (*garcide_braid_callback)(const unsigned char *braid, size_t size,
+                                      void *user_data);
+
+/**
+ * @brief Creates a group handle.
+ *
+ * @param group The name of the group: one of `artin`, `band`, `octahedral`,
+ * `dihedral`, `dual_complex`, `standard_complex`, `euclidean_lattice` and
+ * `coxeter`.
+ * @param parameter The parameter, written as `braiding.exe` reads it.
+ * @param out Set to the handle, that must be freed with `garcide_group_free`
+ * (or to null, on failure).
+ * @return `GARCIDE_OK`, or `GARCIDE_INVALID_ARGUMENT`.
+ */
+garcide_status garcide_group_new(const char *group, const char *parameter,
+                                 garcide_group **out);
+
+/**
+ * @brief Frees a group handle.
+ *
+ * @param group The handle (may be null).
+ */
+void garcide_group_free(garcide_group *group);
+
+/**
+ * @brief Number of atoms of a group.
+ *
+ * @param group The group.
+ * @return The number of atoms.
+ */
+size_t garcide_number_of_atoms(const garcide_group *group);
+
+/**
+ * @brief Size of packed factors, for a group.
+ *
+ * @param group The group.
+ * @return The size of packed factors, in bytes (it only depends on the
+ * parameter).
+ */
+size_t garcide_factor_size(const garcide_group *group);
+
+/**
+ * @brief Writes an atom, as a braid.
+ *
+ * @param group The group.
+ * @param index The index of the atom, in the order of the library (for
+ * instance, \f$\sigma_{i+1}\f$ has index `i` for `artin`).
+ * @param out The output buffer.
+ * @param capacity The size of `out`.
+ * @param size Set to the size of the result.
+ * @return A status code (`GARCIDE_INVALID_ARGUMENT` if `index` is not smaller
+ * than the number of atoms).
+ */
+garcide_status garcide_atom(const garcide_group *group, size_t index,
+                            unsigned char *out, size_t capacity, size_t *size);
+
+/**
+ * @brief Puts a braid in left normal form.
+ *
+ * @param group The group.
+ * @param braid A buffer holding the braid.
+ * @param braid_size The size of `braid`.
+ * @param out The output buffer.
+ * @param capacity The size of `out`.
+ * @param size Set to the size of the result.
+ * @return A status code.
+ */
+garcide_status garcide_normalize(const garcide_group *group,
+                                 const unsigned char *braid, size_t braid_size,
+                                 unsigned char *out, size_t capacity,
+                                 size_t *size);
+
+/**
+ * @brief Computes the product of two braids.
+ *
+ * @param group The group.
+ * @param left A buffer holding the left operand.
+ * @param left_size The size of `left`.
+ * @param right A buffer holding the right operand.
+ * @param right_size The size of `right`.
+ * @param out The output buffer.
+ * @param capacity The size of `out`.
+ * @param size Set to the size of the result.
+ * @return A status code.
+ */
+garcide_status garcide_product(const garcide_group *group,
+                               const unsigned char *left, size_t left_size,
+                               const unsigned char *right, size_t right_size,
+                               unsigned char *out, size_t capacity,
+                               size_t *size);
+
+/**
+ * @brief Computes the inverse of a braid.
+ *
+ * @param group The group.
+ * @param braid A buffer holding the braid.
+ * @param braid_size The size of `braid`.
+ * @param out The output buffer.
+ * @param capacity The size of `out`.
+ * @param size Set to the size of the result.
+ * @return A status code.
+ */
+garcide_status garcide_inverse(const garcide_group *group,
+                               const unsigned char *braid, size_t braid_size,
+                               unsigned char *out, size_t capacity,
+                               size_t *size);
+
+/**
+ * @brief Computes the meet of two braids for the prefix order.
+ *
+ * @param group The group.
+ * @param left A buffer holding the first operand.
+ * @param left_size The size of `left`.
+ * @param right A buffer holding the second operand.
+ * @param right_size The size of `right`.
+ * @param out The output buffer.
+ * @param capacity The size of `out`.
+ * @param size Set to the size of the result.
+ * @return A status code.
+ */
+garcide_status garcide_left_meet(const garcide_group *group,
+                                 const unsigned char *left, size_t left_size,
+                                 const unsigned char *right, size_t right_size,
+                                 unsigned char *out, size_t capacity,
+                                 size_t *size);
+
+/**
+ * @brief Computes the meet of two braids for the suffix order.
+ *
+ * @param group The group.
+ * @param left A buffer holding the first operand.
+ * @param left_size The size of `left`.
+ * @param right A buffer holding the second operand.
+ * @param right_size The size of `right`.
+ * @param out The output buffer.
+ * @param capacity The size of `out`.
+ * @param size Set to the size of the result.
+ * @return A status code.
+ */
+garcide_status garcide_right_meet(const garcide_group *group,
+                                  const unsigned char *left, size_t left_size,
+                                  const unsigned char *right,
+                                  size_t right_size, unsigned char *out,
+                                  size_t capacity, size_t *size);
+
+/**
+ * @brief Feeds the super summit set of a braid to a callback.
+ *
+ * The set is explored as elements are fed, so that stopping early (by
+ * returning non-zero from `callback`) saves the rest of the exploration.
+ *
+ * @param group The group.
+ * @param braid A buffer holding the braid.
+ * @param braid_size The size of `braid`.
+ * @param callback The callback, that is fed each element.
+ * @param user_data A pointer that is passed to `callback`.
+ * @return A status code.
+ */
+garcide_status garcide_super_summit_set(const garcide_group *group,
+                                        const unsigned char *braid,
+                                        size_t braid_size,
+                                        garcide_braid_callback callback,
+                                        void *user_data);
+
+/**
+ * @brief Feeds the ultra summit set of a braid to a callback.
+ *
+ * Elements are fed orbit by orbit, in cycling order. The set is explored as
+ * orbits are fed, so that stopping early (by returning non-zero from
+ * `callback`) saves the rest of the exploration.
+ *
+ * @param group The group.
+ * @param braid A buffer holding the braid.
+ * @param braid_size The size of `braid`.
+ * @param callback The callback, that is fed each element.
+ * @param user_data A pointer that is passed to `callback`.
+ * @return A status code.
+ */
+garcide_status garcide_ultra_summit_set(const garcide_group *group,
+                                        const unsigned char *braid,
+                                        size_t braid_size,
+                                        garcide_braid_callback callback,
+                                        void *user_data);
+
+/**
+ * @brief Feeds the sliding circuits set of a braid to a callback.
+ *
+ * Elements are fed circuit by circuit, in sliding order. The set is explored
+ * as circuits are fed, so that stopping early (by returning non-zero from
+ * `callback`) saves the rest of the exploration.
+ *
+ * @param group The group.
+ * @param braid A buffer holding the braid.
+ * @param braid_size The size of `braid`.
+ * @param callback The callback, that is fed each element.
+ * @param user_data A pointer that is passed to `callback`.
+ * @return A status code.
+ */
+garcide_status garcide_sliding_circuits_set(const garcide_group *group,
+                                            const unsigned char *braid,
+                                            size_t braid_size,
+                                            garcide_braid_callback callback,
+                                            void *user_data);
+
+/**
+ * @brief Checks if two braids are conjugates, and computes a conjugator.
+ *
+ * This uses sliding circuits sets.
+ *
+ * @param group The group.
+ * @param left A buffer holding the first braid.
+ * @param left_size The size of `left`.
+ * @param right A buffer holding the second braid.
+ * @param right_size The size of `right`.
+ * @param conjugate Set to `1` if they are conjugates, and to `0` otherwise.
+ * @param out The output buffer, where a conjugator \f$c\f$ such that
+ * \f$c^{-1}\mathtt{left}c = \mathtt{right}\f$ is written (if they are
+ * conjugates).
+ * @param capacity The size of `out`.
+ * @param size Set to the size of the conjugator (or to `0`).
+ * @return A status code.
+ */
+garcide_status garcide_are_conjugate(const garcide_group *group,
+                                     const unsigned char *left,
+                                     size_t left_size,
+                                     const unsigned char *right,
+                                     size_t right_size, int *conjugate,
+                                     unsigned char *out, size_t capacity,
+                                     size_t *size);
+
+/**
+ * @brief Feeds a generating set of the centralizer of a braid to a callback.
+ *
+ * @param group The group.
+ * @param braid A buffer holding the braid.
+ * @param braid_size The size of `braid`.
+ * @param callback The callback, that is fed each generator.
+ * @param user_data A pointer that is passed to `callback`.
+ * @return A status code.
+ */
+garcide_status garcide_centralizer(const garcide_group *group,
+                                   const unsigned char *braid,
+                                   size_t braid_size,
+                                   garcide_braid_callback callback,
+                                   void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
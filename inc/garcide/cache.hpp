@@ -0,0 +1,383 @@
+/**
+ * @file cache.hpp
+ * @author GarCide contributors
+ * @brief Header file for the on-disk cache of summit sets computations.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CACHE
+#define CACHE
+
+#include "garcide/garcide.hpp"
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <typeinfo>
+
+/**
+ * @brief Namespace for the on-disk cache of summit sets computations.
+ *
+ * When it is enabled (with `enable`), `ultra_summit::ultra_summit_set`,
+ * `sliding_circuits::sliding_circuits_set`, the `are_conjugate` functions that
+ * use them, `centralizer::centralizer` and `artin::thurston_type` look their
+ * results up in a cache directory before computing them, and store them there
+ * afterwards. The directory may be shared between processes and machines.
+ *
+ * Entries are content-addressed: their key is made of the name and version of
+ * the computation, the type of the factors, the parameter and the normal form
+ * of a summit representative, and their file name is a hash of the key (the
+ * key itself is stored in the file, to rule out collisions). Entries are
+ * written to a temporary file that is then renamed, so that readers never see
+ * partial entries, and read through memory mapping. The size of the directory
+ * is bounded by evicting the least recently used entries: a running total of
+ * the sizes of the entries is kept, and the directory is only scanned when it
+ * exceeds the bound. Scans run outside of the lock that guards the state of
+ * the cache, one at a time, and also remove temporary files that were left by
+ * writers that crashed.
+ *
+ * Braids are serialized in binary form, with integers written as varints and
+ * factors as words in their atoms. Values are followed by a checksum, and
+ * decoded braids are checked to be in LCF. The type of the factors is
+ * identified with `typeid`, so that entries should only be shared between
+ * builds from the same compiler.
+ */
+namespace garcide::cache {
+
+/**
+ * @brief Default bound on the size of the cache directory, in bytes.
+ */
+const std::uintmax_t DEFAULT_MAX_SIZE = std::uintmax_t(1) << 30;
+
+/**
+ * @brief Exception thrown when an entry cannot be decoded.
+ *
+ * It is caught by the functions that consult the cache, which then recompute
+ * the result.
+ */
+struct CorruptEntry {};
+
+/**
+ * @brief Enables the cache.
+ *
+ * `directory` is created if it does not exist, and its least recently used
+ * entries are evicted if it does not fit in `max_size`. Thread-safe, like
+ * every function of this namespace.
+ *
+ * @param directory The cache directory.
+ * @param max_size A bound on the size of the cache directory, in bytes.
+ */
+void enable(const std::string &directory,
+            std::uintmax_t max_size = DEFAULT_MAX_SIZE);
+
+/**
+ * @brief Disables the cache.
+ *
+ * Thread-safe. Computations that already looked the cache up may still store
+ * their results there.
+ */
+void disable();
+
+/**
+ * @brief Checks if the cache is enabled.
+ *
+ * Thread-safe.
+ *
+ * @return If the cache is enabled.
+ */
+bool is_enabled();
+
+/**
+ * @brief A read-only view of a cache entry, mapped in memory.
+ */
+class Entry {
+  private:
+    /**
+     * @brief Start of the mapping.
+     */
+    void *mapping = nullptr;
+
+    /**
+     * @brief Size of the mapping.
+     */
+    size_t mapping_size = 0;
+
+    /**
+     * @brief Start of the value.
+     */
+    const char *value = nullptr;
+
+    /**
+     * @brief Size of the value.
+     */
+    size_t value_size = 0;
+
+    /**
+     * @brief Unmaps the entry, if it is mapped.
+     */
+    void release();
+
+    friend bool load(const std::string &key, Entry &entry);
+
+  public:
+    Entry() = default;
+
+    Entry(const Entry &) = delete;
+
+    Entry &operator=(const Entry &) = delete;
+
+    /**
+     * @brief Unmaps the entry.
+     */
+    ~Entry();
+
+    /**
+     * @brief Start of the value.
+     *
+     * @return A pointer to the first byte of the value.
+     */
+    inline const char *data() const { return value; }
+
+    /**
+     * @brief Size of the value.
+     *
+     * @return The number of bytes of the value.
+     */
+    inline size_t size() const { return value_size; }
+};
+
+/**
+ * @brief Looks an entry up in the cache.
+ *
+ * On success, the entry is marked as the most recently used. Thread-safe,
+ * and safe against other processes that share the directory.
+ *
+ * @param key The key of the entry.
+ * @param entry Set to a view of the entry, if it is found.
+ * @return If the entry was found.
+ */
+bool load(const std::string &key, Entry &entry);
+
+/**
+ * @brief Stores an entry in the cache.
+ *
+ * Least recently used entries are then evicted if the running total of the
+ * sizes of the entries exceeds the bound, so that the size of the cache
+ * directory stays below it. Errors are silently ignored: the cache is
+ * only an optimization.
+ *
+ * Thread-safe, and safe against other processes that share the directory
+ * (the last writer of a key wins).
+ *
+ * @param key The key of the entry.
+ * @param value The value of the entry.
+ */
+void store(const std::string &key, const std::string &value);
+
+/**
+ * @brief Builds the key of an entry.
+ *
+ * @tparam F A class representing factors.
+ * @param computation The name and version of the computation.
+ * @param b A summit representative, whose normal form identifies the entry.
+ * @return The key.
+ */
+template <class F>
+std::string key(const std::string &computation, const BraidTemplate<F> &b) {
+    std::ostringstream str;
+    IndentedOStream os(str);
+    os << computation << "\n" << typeid(F).name() << "\n" << b.get_parameter()
+       << "\n";
+    b.print(os);
+    return str.str();
+}
+
+/**
+ * @brief Appends an unsigned integer to `str`, as a varint.
+ *
+ * The integer is cut in groups of 7 bits, least significant first, and each
+ * group is written in a byte whose high bit is set if more groups follow.
+ *
+ * @param str The string to append to.
+ * @param x The integer.
+ */
+inline void write(std::string &str, u64 x) {
+    while (x >= 0x80) {
+        str.push_back(char((x & 0x7f) | 0x80));
+        x >>= 7;
+    }
+    str.push_back(char(x));
+}
+
+/**
+ * @brief Reads an unsigned integer, written by `write`.
+ *
+ * @param pos The position to read from, that is moved past the integer.
+ * @param end The end of the buffer.
+ * @return The integer.
+ * @exception CorruptEntry Thrown if the buffer is too short, or if the
+ * integer does not fit in 64 bits.
+ */
+inline u64 read(const char *&pos, const char *end) {
+    u64 x = 0;
+    for (i16 shift = 0; shift < 64; shift += 7) {
+        if (pos == end) {
+            throw CorruptEntry();
+        }
+        u64 byte = u64((unsigned char)*pos++);
+        if (shift == 63 && byte > 1) {
+            throw CorruptEntry();
+        }
+        x |= (byte & 0x7f) << shift;
+        if (byte < 0x80) {
+            return x;
+        }
+    }
+    throw CorruptEntry();
+}
+
+/**
+ * @brief Appends a factor to `str`.
+ *
+ * Its length is written, followed by the indices of the atoms of a word
+ * representing it.
+ *
+ * @tparam U A class representing underlying factors.
+ * @param str The string to append to.
+ * @param f The factor.
+ * @param atoms The atoms of the group (as given by `atoms`).
+ */
+template <class U>
+void write(std::string &str, const FactorTemplate<U> &f,
+           const std::vector<FactorTemplate<U>> &atoms) {
+    std::vector<u64> word;
+
+    FactorTemplate<U> g = f;
+    while (!g.is_identity()) {
+        u64 i = 0;
+        while (atoms[i].left_meet(g) != atoms[i]) {
+            i++;
+        }
+        word.push_back(i);
+        g = atoms[i].right_complement(g);
+    }
+    write(str, u64(word.size()));
+    for (u64 i : word) {
+        write(str, i);
+    }
+}
+
+/**
+ * @brief Reads a factor, written by `write`.
+ *
+ * The word is checked to be a word of a simple element: every prefix of it
+ * must left divide \f$\Delta\f$.
+ *
+ * @tparam U A class representing underlying factors.
+ * @param pos The position to read from, that is moved past the factor.
+ * @param end The end of the buffer.
+ * @param f A factor that is set to what was read.
+ * @param atoms The atoms of the group (as given by `atoms`).
+ * @exception CorruptEntry Thrown if the buffer does not hold a factor.
+ */
+template <class U>
+void read(const char *&pos, const char *end, FactorTemplate<U> &f,
+          const std::vector<FactorTemplate<U>> &atoms) {
+    f.identity();
+    u64 word_length = read(pos, end);
+    for (u64 l = 0; l < word_length; l++) {
+        u64 i = read(pos, end);
+        if (i >= atoms.size() ||
+            atoms[i].left_meet(f.right_complement()) != atoms[i]) {
+            throw CorruptEntry();
+        }
+        f = f * atoms[i];
+    }
+}
+
+/**
+ * @brief Appends a braid to `str`.
+ *
+ * Its infimum (zigzag encoded, so that small negative values are short) and
+ * number of factors are written, and then each factor (see `write` for
+ * factors).
+ *
+ * @tparam F A class representing factors.
+ * @param str The string to append to.
+ * @param b The braid.
+ */
+template <class F> void write(std::string &str, const BraidTemplate<F> &b) {
+    std::vector<F> atoms = F(b.get_parameter()).atoms();
+
+    i64 inf = b.inf();
+    write(str, inf < 0 ? 2 * u64(-(inf + 1)) + 1 : 2 * u64(inf));
+    write(str, u64(b.canonical_length()));
+    for (typename BraidTemplate<F>::ConstFactorItr it = b.cbegin();
+         it != b.cend(); it++) {
+        write(str, *it, atoms);
+    }
+}
+
+/**
+ * @brief Reads a braid, written by `write`.
+ *
+ * The braid is checked to be in LCF, so that its factors are appended as they
+ * are, without normalizing.
+ *
+ * @tparam F A class representing factors.
+ * @param pos The position to read from, that is moved past the braid.
+ * @param end The end of the buffer.
+ * @param b A braid that is set to what was read (its parameter is used to
+ * decode the factors).
+ * @exception CorruptEntry Thrown if the buffer does not hold a braid in LCF.
+ */
+template <class F>
+void read(const char *&pos, const char *end, BraidTemplate<F> &b) {
+    F f = F(b.get_parameter()), previous = F(b.get_parameter());
+    std::vector<F> atoms = f.atoms();
+
+    u64 zigzag = read(pos, end);
+    u64 magnitude = zigzag / 2;
+    if (magnitude > u64(std::numeric_limits<i16>::max())) {
+        throw CorruptEntry();
+    }
+    i16 inf = (zigzag % 2 == 0) ? i16(magnitude) : i16(-i64(magnitude) - 1);
+
+    b.identity();
+    b.set_delta(inf);
+    u64 length = read(pos, end);
+    for (u64 k = 0; k < length; k++) {
+        read(pos, end, f, atoms);
+        if (f.is_identity() || f.is_delta() ||
+            (k > 0 && !previous.is_left_weighted(f))) {
+            throw CorruptEntry();
+        }
+        b.push_back_left_weighted(f);
+        previous = f;
+    }
+}
+
+} // namespace garcide::cache
+
+#endif
@@ -98,7 +98,7 @@ template <class B> class Centralizer {
      *
      * @return The number of generators already in `*this`.
      */
-    inline size_t number_of_generators() { return generators.size(); }
+    inline size_t number_of_generators() const { return generators.size(); }
 
     /**
      * @brief Look if `b` is in `*this`.
@@ -215,6 +215,8 @@ centralizer(const ultra_summit::UltraSummitSet<BraidTemplate<F>> &uss,
 
     for (size_t orbit_index = 0; orbit_index < uss.number_of_orbits();
          orbit_index++) {
+        checkpoint();
+
         BraidTemplate<F> d = ultra_summit::tree_path(
                              uss.at(orbit_index, (size_t)0), uss, mins, prev),
                          c = d, b2(b.get_parameter());
@@ -249,9 +251,53 @@ centralizer(const ultra_summit::UltraSummitSet<BraidTemplate<F>> &uss,
     return centralizer;
 }
 
+/**
+ * @brief Appends a collection of generators to `str`, for the cache.
+ *
+ * @tparam F A class representing factors.
+ * @param str The string to append to.
+ * @param centralizer The generators.
+ */
+template <class F>
+void write(std::string &str, const Centralizer<BraidTemplate<F>> &centralizer) {
+    cache::write(str, u64(centralizer.number_of_generators()));
+    for (typename Centralizer<BraidTemplate<F>>::ConstIterator it =
+             centralizer.begin();
+         it != centralizer.end(); it++) {
+        cache::write(str, *it);
+    }
+}
+
+/**
+ * @brief Reads a collection of generators, written by `write`.
+ *
+ * @tparam F A class representing factors.
+ * @param pos The position to read from, that is moved past the generators.
+ * @param end The end of the buffer.
+ * @param n The parameter of the generators.
+ * @return The generators.
+ * @exception cache::CorruptEntry Thrown if the buffer does not hold a
+ * collection of generators.
+ */
+template <class F>
+Centralizer<BraidTemplate<F>> read(const char *&pos, const char *end,
+                                   typename F::Parameter n) {
+    Centralizer<BraidTemplate<F>> centralizer;
+    BraidTemplate<F> b = BraidTemplate<F>(n);
+    u64 number_of_generators = cache::read(pos, end);
+    for (u64 i = 0; i < number_of_generators; i++) {
+        cache::read(pos, end, b);
+        centralizer.insert(b);
+    }
+    return centralizer;
+}
+
 /**
  * @brief Computes `b`'s centralizer.
  *
+ * If the cache is enabled, the centralizer of the ultra summit representative
+ * of `b` is looked up there first, and stored there afterwards.
+ *
  * @tparam F A class representing factors.
  * @param b The braid whose centralizer is to be computed.
  * @return `b`'s centralizer.
@@ -261,16 +307,39 @@ Centralizer<BraidTemplate<F>> centralizer(const BraidTemplate<F> &b) {
     std::vector<F> mins;
     std::vector<i16> prev;
 
-    Centralizer<BraidTemplate<F>> centralizer_uss = centralizer(
-                                      ultra_summit::ultra_summit_set(b, mins,
-                                                                     prev),
-                                      mins, prev),
-                                  centralizer;
+    Centralizer<BraidTemplate<F>> centralizer_uss, centralizer;
 
     BraidTemplate<F> c = BraidTemplate<F>(b.get_parameter()), d = c;
-    ultra_summit::send_to_ultra_summit(b, c);
+    BraidTemplate<F> b2 = ultra_summit::send_to_ultra_summit(b, c);
     c = !c;
 
+    std::string key;
+    bool found = false;
+    if (cache::is_enabled()) {
+        key = cache::key("centralizer 1", b2);
+        cache::Entry entry;
+        if (cache::load(key, entry)) {
+            const char *pos = entry.data();
+            try {
+                centralizer_uss =
+                    read<F>(pos, pos + entry.size(), b.get_parameter());
+                found = true;
+            } catch (cache::CorruptEntry const &) {
+            }
+        }
+    }
+
+    if (!found) {
+        centralizer_uss = centralizer::centralizer(
+            ultra_summit::ultra_summit_set(b, mins, prev), mins, prev);
+
+        if (cache::is_enabled()) {
+            std::string value;
+            write(value, centralizer_uss);
+            cache::store(key, value);
+        }
+    }
+
     for (typename Centralizer<BraidTemplate<F>>::ConstIterator it =
              centralizer_uss.begin();
          it != centralizer_uss.end(); it++) {
@@ -0,0 +1,850 @@
+/**
+ * @file differential.hpp
+ * @author GarCide contributors
+ * @brief Header file for differential checks of fast paths against reference
+ * behaviour.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DIFFERENTIAL
+#define DIFFERENTIAL
+
+#include "garcide/sliding_circuits.hpp"
+#include "garcide/ultra_summit.hpp"
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Namespace for differential checks.
+ *
+ * Most operations have a fast path (an optional member function of the
+ * underlying class, a vectorized kernel, a lazy or parallel exploration) and a
+ * reference behaviour, that they must match exactly. A check computes both on
+ * a braid, and tells if they agree. `find_mismatch` runs checks on seeded
+ * random braids, and shrinks the first braid a check fails on to a minimal
+ * word, that can then be replayed with `braid_of_word`.
+ *
+ * Braids are given as words in the atoms, as returned by `F::atoms()`: a
+ * letter \f$k>0\f$ stands for the \f$k\f$-th atom, and a letter \f$-k<0\f$ for
+ * its inverse.
+ */
+namespace garcide::differential {
+
+/**
+ * @brief A named check.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> struct Check {
+    /**
+     * @brief The name of the check, for reports.
+     */
+    std::string name;
+
+    /**
+     * @brief Computes both the fast path and the reference on a braid.
+     *
+     * It returns if they agree. Throwing counts as disagreeing.
+     */
+    std::function<bool(const BraidTemplate<F> &)> agrees;
+};
+
+/**
+ * @brief A braid on which a check fails.
+ */
+struct Mismatch {
+    /**
+     * @brief The name of the check that failed.
+     */
+    std::string check;
+
+    /**
+     * @brief A word that it fails on, that is minimal: removing any letter
+     * makes the check pass.
+     */
+    std::vector<i16> word;
+};
+
+/**
+ * @brief Computes the braid a word stands for.
+ *
+ * @tparam F A class representing factors.
+ * @param p The parameter.
+ * @param word A word in the atoms.
+ * @return The braid represented by `word`.
+ */
+template <class F>
+BraidTemplate<F> braid_of_word(const typename F::Parameter &p,
+                               const std::vector<i16> &word) {
+    std::vector<F> atoms = F(p).atoms();
+    BraidTemplate<F> b = BraidTemplate<F>(p);
+    for (i16 k : word) {
+        if (k > 0) {
+            b.right_multiply(atoms[k - 1]);
+        } else {
+            b.right_divide(atoms[-k - 1]);
+        }
+    }
+    return b;
+}
+
+/**
+ * @brief Compares the optional factor member functions with their generic
+ * fallbacks, and checks lattice identities for meets.
+ *
+ * On every factor \f$x\f$ of the braid, paired with the next one and with
+ * every atom: `is_identity`, `is_delta`, the complements under \f$\Delta\f$
+ * and `left_meet_is_identity` against the computations they shortcut; then
+ * commutativity and idempotence of meets and joins, meets and joins with the
+ * identity and with \f$\Delta\f$, that meets divide and joins are divided by
+ * \f$x\f$ and \f$y\f$, and minimality (the complements of \f$x\f$ and
+ * \f$y\f$ over \f$x\wedge y\f$, or under \f$x\vee y\f$, have a trivial
+ * meet). Meets are compared with `==`, so that this does not rely on
+ * `is_identity`.
+ *
+ * @tparam F A class representing factors.
+ * @return The check.
+ */
+template <class F> Check<F> factor_check() {
+    return Check<F>{"factors", [](const BraidTemplate<F> &b) {
+        F e = F(b.get_parameter()), delta = F(b.get_parameter());
+        e.identity();
+        delta.delta();
+        std::vector<F> factors(b.cbegin(), b.cend()),
+            atoms = e.atoms();
+        factors.push_back(e);
+        factors.push_back(delta);
+
+        for (size_t i = 0; i < factors.size(); i++) {
+            const F &x = factors[i];
+            if (x.is_identity() != (x == e) || x.is_delta() != (x == delta) ||
+                x.left_complement() != x.left_complement(delta) ||
+                x.right_complement() != x.right_complement(delta) ||
+                x.left_meet(x) != x || x.left_meet(e) != e ||
+                x.left_meet(delta) != x || x.right_meet(x) != x ||
+                x.right_meet(e) != e || x.right_meet(delta) != x ||
+                x.left_join(x) != x || x.left_join(e) != x ||
+                x.left_join(delta) != delta || x.right_join(x) != x ||
+                x.right_join(e) != x || x.right_join(delta) != delta) {
+                return false;
+            }
+            std::vector<F> others = atoms;
+            others.push_back(factors[(i + 1) % factors.size()]);
+            for (const F &y : others) {
+                F m = x.left_meet(y), r = x.right_meet(y);
+                if (m != y.left_meet(x) || r != y.right_meet(x) ||
+                    x.left_meet_is_identity(y) != (m == e) ||
+                    m * m.right_complement(x) != x ||
+                    m * m.right_complement(y) != y ||
+                    r.left_complement(x) * r != x ||
+                    r.left_complement(y) * r != y ||
+                    m.right_complement(x).left_meet(m.right_complement(y)) !=
+                        e ||
+                    r.left_complement(x).right_meet(r.left_complement(y)) !=
+                        e) {
+                    return false;
+                }
+                F j = x.left_join(y), k = x.right_join(y);
+                if (j != y.left_join(x) || k != y.right_join(x) ||
+                    x.left_meet(j) != x || y.left_meet(j) != y ||
+                    x.right_meet(k) != x || y.right_meet(k) != y ||
+                    x.right_complement(j).right_meet(y.right_complement(j)) !=
+                        e ||
+                    x.left_complement(k).left_meet(y.left_complement(k)) !=
+                        e) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }};
+}
+
+/**
+ * @brief Compares normal forms computed in different ways.
+ *
+ * The left normal form of the braid is compared with the one obtained by
+ * multiplying its factors on the left in reverse order, with the one obtained
+ * by converting its right normal form (computed by `right_multiply_rcf`), and
+ * the braid with its double inverse. Consecutive factors must be
+ * left-weighted, and the product with the inverse must be trivial.
+ *
+ * @tparam F A class representing factors.
+ * @return The check.
+ */
+template <class F> Check<F> normal_form_check() {
+    return Check<F>{"normal forms", [](const BraidTemplate<F> &b) {
+        typename F::Parameter p = b.get_parameter();
+        F delta = F(p);
+        delta.delta();
+
+        BraidTemplate<F> left = BraidTemplate<F>(p), rcf = BraidTemplate<F>(p);
+        for (auto it = b.crbegin(); it != b.crend(); it++) {
+            left.left_multiply(*it);
+        }
+        for (i16 i = 0; i < b.inf(); i++) {
+            left.left_multiply(delta);
+        }
+        for (i16 i = 0; i > b.inf(); i--) {
+            left.left_divide(delta);
+        }
+        for (i16 i = 0; i < b.inf(); i++) {
+            rcf.right_multiply_rcf(delta);
+        }
+        for (i16 i = 0; i > b.inf(); i--) {
+            rcf.right_divide_rcf(delta);
+        }
+        for (auto it = b.cbegin(); it != b.cend(); it++) {
+            rcf.right_multiply_rcf(*it);
+        }
+        rcf.rcf_to_lcf();
+
+        for (auto it = b.cbegin(); it != b.cend(); it++) {
+            auto next = std::next(it);
+            if (it->is_identity() || it->is_delta() ||
+                (next != b.cend() && !it->is_left_weighted(*next))) {
+                return false;
+            }
+        }
+        return left == b && rcf == b && b.inverse().inverse() == b &&
+               (b * b.inverse()).is_identity();
+    }};
+}
+
+/**
+ * @brief Compares lazy summit set ranges with the eager computations.
+ *
+ * Lazy ranges must have as many elements (or orbits, or circuits) as the
+ * sets computed by `super_summit_set`, `ultra_summit_set` and
+ * `sliding_circuits_set`, and their conjugators must send the braid to the
+ * elements. Braids whose ultra summit sets can not be computed
+ * (`ultra_summit::NotUltraSummit`) are skipped.
+ *
+ * @tparam F A class representing factors.
+ * @return The check.
+ */
+template <class F> Check<F> lazy_summit_check() {
+    return Check<F>{"lazy summit sets", [](const BraidTemplate<F> &b) {
+        using B = BraidTemplate<F>;
+        auto conjugates_to = [&b](const B &c, const B &d) {
+            B e = b;
+            e.conjugate(c);
+            return e == d;
+        };
+
+        size_t card = 0;
+        for (const super_summit::Conjugate<B> &d :
+             super_summit::lazy_super_summit_set(b)) {
+            if (!conjugates_to(d.conjugator, d.braid)) {
+                return false;
+            }
+            card++;
+        }
+        if (card != size_t(super_summit::super_summit_set(b).card())) {
+            return false;
+        }
+
+        try {
+            card = 0;
+            for (const ultra_summit::Orbit<B> &o :
+                 ultra_summit::lazy_ultra_summit_set(b)) {
+                if (!conjugates_to(o.conjugator, o.orbit.front())) {
+                    return false;
+                }
+                card++;
+            }
+            if (card != ultra_summit::ultra_summit_set(b).number_of_orbits()) {
+                return false;
+            }
+        } catch (const ultra_summit::NotUltraSummit<B> &) {
+        }
+
+        card = 0;
+        for (const sliding_circuits::Circuit<B> &c :
+             sliding_circuits::lazy_sliding_circuits_set(b)) {
+            if (!conjugates_to(c.conjugator, c.circuit.front())) {
+                return false;
+            }
+            card++;
+        }
+        return card ==
+               sliding_circuits::sliding_circuits_set(b).number_of_circuits();
+    }};
+}
+
+/**
+ * @brief Compares the vectorized kernels with the scalar code.
+ *
+ * Every factor \f$x\f$ of the braid and \f$\Delta\f$, paired with every
+ * atom and every factor \f$y\f$: the meets of \f$x\f$ and \f$y\f$, the
+ * product of \f$x\f$ with \f$\partial x\wedge y\f$ (which is simple), and
+ * the square of the braid, are computed with the vectorized kernels enabled
+ * and disabled (see `set_simd_kernels`), and must agree: this compares the
+ * SSE meets of `artin` (up to 16 strands) with `MeetSub`, and the AVX2
+ * products of `dual_complex` and `standard_complex` with the scalar loops.
+ * Groups without kernels pass trivially.
+ *
+ * The kernels are global, so that this check must not run concurrently with
+ * other computations.
+ *
+ * @tparam F A class representing factors.
+ * @return The check.
+ */
+template <class F> Check<F> simd_check() {
+    return Check<F>{"vectorized kernels", [](const BraidTemplate<F> &b) {
+        // Restores the kernels, even if a computation throws.
+        struct Restore {
+            bool enabled = simd_kernels();
+            ~Restore() { set_simd_kernels(enabled); }
+        } restore;
+
+        F delta = F(b.get_parameter());
+        delta.delta();
+        std::vector<F> factors(b.cbegin(), b.cend()), others = delta.atoms();
+        factors.push_back(delta);
+        others.insert(others.end(), factors.begin(), factors.end());
+
+        auto compute = [&b, &factors, &others](bool enabled) {
+            set_simd_kernels(enabled);
+            std::vector<F> results;
+            for (const F &x : factors) {
+                for (const F &y : others) {
+                    results.push_back(x.left_meet(y));
+                    results.push_back(x.right_meet(y));
+                    results.push_back(x * x.right_complement().left_meet(y));
+                }
+            }
+            return std::make_pair(results, b * b);
+        };
+        return compute(true) == compute(false);
+    }};
+}
+
+/**
+ * @brief The bytes of a packed factor, as a key.
+ *
+ * @tparam F A class representing factors.
+ * @param f The factor.
+ * @return Its `packed_size()` bytes.
+ */
+template <class F> std::string packed(const F &f) {
+    std::string bytes(f.packed_size(), '\0');
+    f.pack(reinterpret_cast<u8 *>(&bytes[0]));
+    return bytes;
+}
+
+/**
+ * @brief The lattice of simple elements, computed from word lengths alone.
+ *
+ * This only applies to groups whose factors hold any element of a finite
+ * quotient, and multiply and divide there (`octahedral`, `dual_complex` and
+ * `standard_complex`). The quotient is explored breadth first from the
+ * identity, multiplying by atoms, so that every element gets its length as a
+ * word in the atoms. Then \f$s\f$ left-divides \f$x\f$ if and only if
+ * \f$|s|+|s^{-1}x|=|x|\f$ (and likewise on the right), simple elements are
+ * the left divisors of \f$\Delta\f$, and meets and joins are found by
+ * scanning them.
+ *
+ * This is quadratic in the number of simple elements, and linear in the order
+ * of the quotient: parameters must be small.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> class ReferenceLattice {
+  public:
+    /**
+     * @brief The parameter.
+     */
+    typename F::Parameter parameter;
+
+  private:
+    /**
+     * @brief The simple elements, by increasing length.
+     */
+    std::vector<F> simples;
+
+    /**
+     * @brief The indices of the simple elements, by packed bytes.
+     */
+    std::unordered_map<std::string, size_t> indices;
+
+    /**
+     * @brief `left_divisors[j][i]` tells if `simples[i]` left-divides
+     * `simples[j]`.
+     */
+    std::vector<std::vector<bool>> left_divisors;
+
+    /**
+     * @brief `right_divisors[j][i]` tells if `simples[i]` right-divides
+     * `simples[j]`.
+     */
+    std::vector<std::vector<bool>> right_divisors;
+
+    /**
+     * @brief The index of a simple element.
+     *
+     * @param x A simple element.
+     * @return Its index in `simples`.
+     * @exception std::out_of_range Thrown if `x` is not simple.
+     */
+    inline size_t index(const F &x) const { return indices.at(packed(x)); }
+
+    /**
+     * @brief The last common divisor, or the first common multiple, of two
+     * simple elements.
+     *
+     * @param x A simple element.
+     * @param y Another one.
+     * @param divisors `left_divisors` or `right_divisors`.
+     * @param meet Whether the last common divisor is searched for (and
+     * otherwise, the first common multiple).
+     * @return It.
+     */
+    F scan(const F &x, const F &y,
+           const std::vector<std::vector<bool>> &divisors, bool meet) const {
+        size_t i = index(x), j = index(y), found = 0;
+        for (size_t k = 0; k < simples.size(); k++) {
+            if (meet ? (divisors[i][k] && divisors[j][k])
+                     : (divisors[k][i] && divisors[k][j])) {
+                found = k;
+                if (!meet) {
+                    break;
+                }
+            }
+        }
+        return simples[found];
+    }
+
+  public:
+    /**
+     * @brief Computes the lattice.
+     *
+     * @param p The parameter.
+     */
+    explicit ReferenceLattice(const typename F::Parameter &p) : parameter(p) {
+        F e = F(p), delta = F(p);
+        e.identity();
+        delta.delta();
+        std::vector<F> atoms = e.atoms(), elements(1, e);
+        std::unordered_map<std::string, i16> lengths = {{packed(e), 0}};
+        for (size_t i = 0; i < elements.size(); i++) {
+            i16 l = lengths.at(packed(elements[i]));
+            for (const F &a : atoms) {
+                F y = elements[i] * a;
+                if (lengths.emplace(packed(y), l + 1).second) {
+                    elements.push_back(y);
+                }
+            }
+        }
+
+        auto length = [&lengths](const F &x) {
+            return lengths.at(packed(x));
+        };
+        for (const F &x : elements) {
+            if (length(x) + length(x.right_complement(delta)) ==
+                length(delta)) {
+                indices[packed(x)] = simples.size();
+                simples.push_back(x);
+            }
+        }
+        size_t n = simples.size();
+        left_divisors.assign(n, std::vector<bool>(n));
+        right_divisors.assign(n, std::vector<bool>(n));
+        for (size_t j = 0; j < n; j++) {
+            for (size_t i = 0; i < n; i++) {
+                const F &s = simples[i], &x = simples[j];
+                left_divisors[j][i] =
+                    length(s) + length(s.right_complement(x)) == length(x);
+                right_divisors[j][i] =
+                    length(s.left_complement(x)) + length(s) == length(x);
+            }
+        }
+    }
+
+    /**
+     * @brief The number of simple elements.
+     *
+     * @return The number of simple elements.
+     */
+    inline size_t number_of_simples() const { return simples.size(); }
+
+    /**
+     * @brief Computes a left meet.
+     *
+     * @param x A simple element.
+     * @param y Another one.
+     * @return The left meet of `x` and `y`.
+     */
+    inline F left_meet(const F &x, const F &y) const {
+        return scan(x, y, left_divisors, true);
+    }
+
+    /**
+     * @brief Computes a right meet.
+     *
+     * @param x A simple element.
+     * @param y Another one.
+     * @return The right meet of `x` and `y`.
+     */
+    inline F right_meet(const F &x, const F &y) const {
+        return scan(x, y, right_divisors, true);
+    }
+
+    /**
+     * @brief Computes a left join.
+     *
+     * @param x A simple element.
+     * @param y Another one.
+     * @return The left join of `x` and `y`.
+     */
+    inline F left_join(const F &x, const F &y) const {
+        return scan(x, y, left_divisors, false);
+    }
+
+    /**
+     * @brief Computes a right join.
+     *
+     * @param x A simple element.
+     * @param y Another one.
+     * @return The right join of `x` and `y`.
+     */
+    inline F right_join(const F &x, const F &y) const {
+        return scan(x, y, right_divisors, false);
+    }
+};
+
+/**
+ * @brief Compares meets and joins with the ones of `ReferenceLattice`.
+ *
+ * On every factor \f$x\f$ of the braid and \f$\Delta\f$, paired with every
+ * atom and every factor: both meets and both joins. The number of simple
+ * elements `for_each_simple` finds is compared too. The reference is built on
+ * the first call, and again when the parameter changes: see
+ * `ReferenceLattice` for the groups this applies to.
+ *
+ * @tparam F A class representing factors.
+ * @return The check.
+ */
+template <class F> Check<F> reference_lattice_check() {
+    auto reference = std::make_shared<std::unique_ptr<ReferenceLattice<F>>>();
+    return Check<F>{"reference lattice", [reference](
+                                             const BraidTemplate<F> &b) {
+        typename F::Parameter p = b.get_parameter();
+        if (!*reference || !((*reference)->parameter == p)) {
+            *reference = std::make_unique<ReferenceLattice<F>>(p);
+        }
+        const ReferenceLattice<F> &lattice = **reference;
+
+        F delta = F(p);
+        delta.delta();
+        size_t number_of_simples = 0;
+        delta.for_each_simple([&number_of_simples](const F &) {
+            number_of_simples++;
+        });
+        if (number_of_simples != lattice.number_of_simples()) {
+            return false;
+        }
+
+        std::vector<F> factors(b.cbegin(), b.cend()), others = delta.atoms();
+        factors.push_back(delta);
+        others.insert(others.end(), factors.begin(), factors.end());
+        for (const F &x : factors) {
+            for (const F &y : others) {
+                if (x.left_meet(y) != lattice.left_meet(x, y) ||
+                    x.right_meet(y) != lattice.right_meet(x, y) ||
+                    x.left_join(y) != lattice.left_join(x, y) ||
+                    x.right_join(y) != lattice.right_join(x, y)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }};
+}
+
+/**
+ * @brief Compares `ultra_summit::are_conjugate`, that first explores rigid
+ * conjugates only, with a search of the whole ultra summit set.
+ *
+ * The braid is paired with its conjugate by the product of the first and last
+ * atoms, and with its product by the first atom (which is not a conjugate in
+ * general). `are_conjugate` must tell if they are conjugates as the ultra
+ * summit set of the braid does, and its conjugator must conjugate.
+ * Braids whose ultra summit sets can not be computed
+ * (`ultra_summit::NotUltraSummit`) are skipped.
+ *
+ * @tparam F A class representing factors.
+ * @return The check.
+ */
+template <class F> Check<F> conjugacy_check() {
+    return Check<F>{"conjugacy", [](const BraidTemplate<F> &b) {
+        using B = BraidTemplate<F>;
+        typename F::Parameter p = b.get_parameter();
+        std::vector<F> atoms = F(p).atoms();
+        B c = B(atoms.front()) * B(atoms.back()), conjugate = b,
+          product = b * B(atoms.front());
+        conjugate.conjugate(c);
+
+        try {
+            for (const B &b2 : {conjugate, product}) {
+                B c1 = B(p), c2 = B(p), d = B(p);
+                B bt1 = ultra_summit::send_to_ultra_summit(b, c1),
+                  bt2 = ultra_summit::send_to_ultra_summit(b2, c2);
+                bool reference =
+                    bt1.canonical_length() == bt2.canonical_length() &&
+                    bt1.inf() == bt2.inf() &&
+                    ultra_summit::ultra_summit_set(bt1).mem(bt2);
+                if (ultra_summit::are_conjugate(b, b2, d) != reference) {
+                    return false;
+                }
+                B e = b;
+                e.conjugate(d);
+                if (reference && e != b2) {
+                    return false;
+                }
+            }
+        } catch (const ultra_summit::NotUltraSummit<B> &) {
+        }
+        return true;
+    }};
+}
+
+/**
+ * @brief Compares summit sets with a serial search of their graphs.
+ *
+ * The super summit, ultra summit and sliding circuits sets of the braid are
+ * explored again from the braid the library sends there, breadth first, by
+ * conjugating by the minimal conjugator above each atom, computed one atom at
+ * a time. Elements of the latter two sets come with their orbits under
+ * cycling (or circuits under sliding), and conjugators are only computed at
+ * the element each orbit is found from. This is the reference for the
+ * searches of `summit_search`, whose minimal conjugators are computed in
+ * parallel if `USE_PAR` is defined: both must find the same elements. Braids
+ * whose ultra summit sets can not be computed
+ * (`ultra_summit::NotUltraSummit`) are skipped there.
+ *
+ * @tparam F A class representing factors.
+ * @return The check.
+ */
+template <class F> Check<F> serial_summit_check() {
+    return Check<F>{"serial summit sets", [](const BraidTemplate<F> &b) {
+        using B = BraidTemplate<F>;
+        std::vector<F> atoms = F(b.get_parameter()).atoms();
+
+        // Explores from `start`: each new element is added with its orbit
+        // under `step`, and followed by conjugation by the minimal
+        // conjugators `min` returns at it.
+        auto explore = [&atoms](const B &start, auto step, auto min) {
+            std::unordered_set<B> seen;
+            std::vector<B> queue;
+            auto visit = [&seen, &queue, &step](B v) {
+                if (seen.count(v) == 0) {
+                    queue.push_back(v);
+                }
+                while (seen.insert(v).second) {
+                    step(v);
+                }
+            };
+            visit(start);
+            for (size_t i = 0; i < queue.size(); i++) {
+                B v_rcf = queue[i];
+                v_rcf.lcf_to_rcf();
+                for (const F &a : atoms) {
+                    B w = queue[i];
+                    w.conjugate(min(queue[i], v_rcf, a));
+                    visit(w);
+                }
+            }
+            return seen;
+        };
+        auto same = [](const std::unordered_set<B> &seen, const auto &set) {
+            if (seen.size() != size_t(set.card())) {
+                return false;
+            }
+            for (const B &v : seen) {
+                if (!set.mem(v)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        auto cycling = [](B &v) { v.cycling(); };
+        if (!same(explore(super_summit::send_to_super_summit(b), [](B &) {},
+                          [](const B &v, const B &v_rcf, const F &a) {
+                              return super_summit::min_super_summit(v, v_rcf,
+                                                                    a);
+                          }),
+                  super_summit::super_summit_set(b))) {
+            return false;
+        }
+
+        try {
+            if (!same(explore(ultra_summit::send_to_ultra_summit(b), cycling,
+                              [](const B &v, const B &v_rcf, const F &a) {
+                                  return ultra_summit::min_ultra_summit(
+                                      v, v_rcf, a);
+                              }),
+                      ultra_summit::ultra_summit_set(b))) {
+                return false;
+            }
+        } catch (const ultra_summit::NotUltraSummit<B> &) {
+        }
+
+        return same(explore(sliding_circuits::send_to_sliding_circuits(b),
+                            [](B &v) { v.sliding(); },
+                            [](const B &v, const B &v_rcf, const F &a) {
+                                return sliding_circuits::min_sliding_circuits(
+                                    v, v_rcf, a);
+                            }),
+                    sliding_circuits::sliding_circuits_set(b));
+    }};
+}
+
+/**
+ * @brief The checks of factors, normal forms and summit sets.
+ *
+ * @tparam F A class representing factors.
+ * @return `factor_check`, `normal_form_check`, `simd_check` and
+ * `lazy_summit_check`.
+ */
+template <class F> std::vector<Check<F>> default_checks() {
+    return {factor_check<F>(), normal_form_check<F>(), simd_check<F>(),
+            lazy_summit_check<F>()};
+}
+
+/**
+ * @brief The checks of conjugacy searches, that compute summit sets again
+ * and are slower.
+ *
+ * @tparam F A class representing factors.
+ * @return `conjugacy_check` and `serial_summit_check`.
+ */
+template <class F> std::vector<Check<F>> search_checks() {
+    return {conjugacy_check<F>(), serial_summit_check<F>()};
+}
+
+/**
+ * @brief Runs a check on a word.
+ *
+ * @tparam F A class representing factors.
+ * @param p The parameter.
+ * @param check The check.
+ * @param word A word in the atoms.
+ * @return If `check` passes on the braid represented by `word`.
+ */
+template <class F>
+bool passes(const typename F::Parameter &p, const Check<F> &check,
+            const std::vector<i16> &word) {
+    try {
+        return check.agrees(braid_of_word<F>(p, word));
+    } catch (...) {
+        return false;
+    }
+}
+
+/**
+ * @brief Shrinks a word a check fails on.
+ *
+ * Chunks of letters are removed for as long as the check still fails, with
+ * chunks halving in size down to single letters.
+ *
+ * @tparam F A class representing factors.
+ * @param p The parameter.
+ * @param check The check.
+ * @param word A word in the atoms that `check` fails on.
+ * @return A subword of `word` that `check` fails on, and such that removing
+ * any letter makes it pass.
+ */
+template <class F>
+std::vector<i16> shrink(const typename F::Parameter &p, const Check<F> &check,
+                        std::vector<i16> word) {
+    for (size_t chunk = std::max(word.size() / 2, size_t(1)); chunk > 0;
+         chunk /= 2) {
+        bool shrunk = true;
+        while (shrunk) {
+            shrunk = false;
+            for (size_t start = 0; start + chunk <= word.size();) {
+                std::vector<i16> smaller = word;
+                smaller.erase(smaller.begin() + start,
+                              smaller.begin() + start + chunk);
+                if (!passes(p, check, smaller)) {
+                    word = smaller;
+                    shrunk = true;
+                } else {
+                    start += chunk;
+                }
+            }
+        }
+    }
+    return word;
+}
+
+/**
+ * @brief Runs checks on random braids.
+ *
+ * Random words are drawn with the library's random engine, that is seeded
+ * with `seed` first, so that runs can be replayed.
+ *
+ * @tparam F A class representing factors.
+ * @param p The parameter.
+ * @param checks The checks.
+ * @param tries The number of random braids.
+ * @param length The length of the random words.
+ * @param seed The seed.
+ * @return The first check that failed, with a minimal word it fails on, if
+ * there is one.
+ */
+template <class F>
+std::optional<Mismatch>
+find_mismatch(const typename F::Parameter &p,
+              const std::vector<Check<F>> &checks, size_t tries, size_t length,
+              u64 seed) {
+    seed_random_engine(seed);
+    size_t number_of_atoms = F(p).atoms().size();
+    for (size_t _ = 0; _ < tries; _++) {
+        std::vector<i16> word(length);
+        for (i16 &k : word) {
+            k = i16(random_below(number_of_atoms)) + 1;
+            k = (random_below(2) == 0) ? k : -k;
+        }
+        for (const Check<F> &check : checks) {
+            if (!passes(p, check, word)) {
+                return Mismatch{check.name, shrink(p, check, word)};
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace garcide::differential
+
+#endif
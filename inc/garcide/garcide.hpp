@@ -32,15 +32,167 @@
 
 #include "garcide/utility.hpp"
 #include <list>
+#include <memory_resource>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 /**
  * @brief Namespace for the _GarCide_ library.
+ *
+ * The library is reentrant, and has no hidden shared state: independent
+ * computations may run concurrently from any number of threads. More
+ * precisely:
+ * - Const member functions and free functions may be called concurrently,
+ * including on the same objects. Other member functions may be called
+ * concurrently on different objects.
+ * - Scratch space is `thread_local`, and functions that use it do not call
+ * each other while it is in use.
+ * - `randomize` member functions draw from `random_engine()`, which is
+ * `thread_local`.
+ * - `ind_cout` is `thread_local`.
+ * - Shared caches (such as the lattices of `coxeter` and the on-disk cache of
+ * `cache`) are guarded by mutexes.
  */
 namespace garcide {
 
+/**
+ * @brief Detects if `U` has a member function `bool is_identity() const`.
+ *
+ * Classes representing underlying factors may provide the optional member
+ * functions that are detected here, to speed up the matching `FactorTemplate`
+ * member functions (that would otherwise build and fill temporary factors).
+ * Those that do not still work, through generic fallbacks.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U, class = void> struct HasIsIdentity : std::false_type {};
+
+/**
+ * @brief Specialization of `HasIsIdentity` for classes that have the member
+ * function.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U>
+struct HasIsIdentity<
+    U, std::void_t<decltype(bool(std::declval<const U &>().is_identity()))>>
+    : std::true_type {};
+
+/**
+ * @brief Detects if `U` has a member function `bool is_delta() const`.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U, class = void> struct HasIsDelta : std::false_type {};
+
+/**
+ * @brief Specialization of `HasIsDelta` for classes that have the member
+ * function.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U>
+struct HasIsDelta<
+    U, std::void_t<decltype(bool(std::declval<const U &>().is_delta()))>>
+    : std::true_type {};
+
+/**
+ * @brief Detects if `U` has member functions `U left_complement() const` and
+ * `U right_complement() const`, computing complements under the Garside
+ * element.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U, class = void>
+struct HasDeltaComplements : std::false_type {};
+
+/**
+ * @brief Specialization of `HasDeltaComplements` for classes that have the
+ * member functions.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U>
+struct HasDeltaComplements<
+    U, std::void_t<decltype(U(std::declval<const U &>().left_complement())),
+                   decltype(U(std::declval<const U &>().right_complement()))>>
+    : std::true_type {};
+
+/**
+ * @brief Detects if `U` has a member function
+ * `bool left_meet_is_identity(const U &) const`.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U, class = void>
+struct HasLeftMeetIsIdentity : std::false_type {};
+
+/**
+ * @brief Specialization of `HasLeftMeetIsIdentity` for classes that have the
+ * member function.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U>
+struct HasLeftMeetIsIdentity<
+    U, std::void_t<decltype(bool(
+           std::declval<const U &>().left_meet_is_identity(
+               std::declval<const U &>())))>> : std::true_type {};
+
+/**
+ * @brief Detects if `U` has member functions
+ * `bool is_left_divisible_by_atom(size_t) const` and
+ * `bool is_right_divisible_by_atom(size_t) const`, telling if the `k`-th atom
+ * (in the order of `atoms`) left or right divides a factor.
+ *
+ * All groups but `dual_complex` have them. There, `FactorTemplate` tests
+ * divisibility with a meet.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U, class = void>
+struct HasAtomDivisibility : std::false_type {};
+
+/**
+ * @brief Specialization of `HasAtomDivisibility` for classes that have the
+ * member functions.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U>
+struct HasAtomDivisibility<
+    U, std::void_t<decltype(bool(std::declval<const U &>()
+                                     .is_left_divisible_by_atom(size_t(0)))),
+                   decltype(bool(std::declval<const U &>()
+                                     .is_right_divisible_by_atom(size_t(0))))>>
+    : std::true_type {};
+
+/**
+ * @brief Detects if `U` has a member function template
+ * `void for_each_simple(Fun, size_t, size_t) const`, that enumerates simple
+ * elements directly, in chunks (as `FactorTemplate::for_each_simple` does).
+ *
+ * Only `band::Underlying` has one, that goes through ballot sequences.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U, class = void>
+struct HasForEachSimple : std::false_type {};
+
+/**
+ * @brief Specialization of `HasForEachSimple` for classes that have the
+ * member function template.
+ *
+ * @tparam U A class representing underlying factors.
+ */
+template <class U>
+struct HasForEachSimple<
+    U, std::void_t<decltype(std::declval<const U &>().for_each_simple(
+           std::declval<void (*)(const U &)>(), size_t(0), size_t(1)))>>
+    : std::true_type {};
+
 /**
  * @brief A class template for Garside group canonical factors.
  *
@@ -58,6 +210,12 @@ template <class U> class FactorTemplate {
      */
     using Parameter = typename U::Parameter;
 
+    /**
+     * @brief Whether `left_meet_is_identity` is cheaper than computing the
+     * meet (_i.e._ whether `U` provides it).
+     */
+    static constexpr bool HAS_LEFT_MEET_TEST = HasLeftMeetIsIdentity<U>::value;
+
   private:
     /**
      * @brief The actual data structure representing the factor.
@@ -228,23 +386,37 @@ template <class U> class FactorTemplate {
     /**
      * @brief Equality test with the identity.
      *
+     * Uses the matching `U` member function if there is one, and otherwise
+     * compares `*this` with an identity factor.
+     *
      * @return if `*this` is the identity.
      */
     inline bool is_identity() const {
-        FactorTemplate e = FactorTemplate(*this);
-        e.identity();
-        return compare(e);
+        if constexpr (HasIsIdentity<U>::value) {
+            return underlying.is_identity();
+        } else {
+            FactorTemplate e = FactorTemplate(*this);
+            e.identity();
+            return compare(e);
+        }
     }
 
     /**
      * @brief Equality test with the Garside element.
      *
+     * Uses the matching `U` member function if there is one, and otherwise
+     * compares `*this` with a Garside element factor.
+     *
      * @return if `*this` is the Garside element.
      */
     inline bool is_delta() const {
-        FactorTemplate delta = FactorTemplate(*this);
-        delta.delta();
-        return compare(delta);
+        if constexpr (HasIsDelta<U>::value) {
+            return underlying.is_delta();
+        } else {
+            FactorTemplate delta = FactorTemplate(*this);
+            delta.delta();
+            return compare(delta);
+        }
     }
 
     /**
@@ -268,12 +440,19 @@ template <class U> class FactorTemplate {
     /**
      * @brief Computes the left complement of `*this` under the Garside element.
      *
+     * Uses the matching `U` member function if there is one, and otherwise
+     * builds the Garside element.
+     *
      * @return The left complement of `*this` under the Garside element.
      */
     inline FactorTemplate left_complement() const {
-        FactorTemplate delta = FactorTemplate(*this);
-        delta.delta();
-        return left_complement(delta);
+        if constexpr (HasDeltaComplements<U>::value) {
+            return FactorTemplate(underlying.left_complement());
+        } else {
+            FactorTemplate delta = FactorTemplate(*this);
+            delta.delta();
+            return left_complement(delta);
+        }
     }
 
     /**
@@ -298,12 +477,19 @@ template <class U> class FactorTemplate {
      * @brief Computes the right complement of `*this` under the Garside
      * element.
      *
+     * Uses the matching `U` member function if there is one, and otherwise
+     * builds the Garside element.
+     *
      * @return The right complement of `*this` under the Garside element.
      */
     inline FactorTemplate right_complement() const {
-        FactorTemplate delta = FactorTemplate(*this);
-        delta.delta();
-        return right_complement(delta);
+        if constexpr (HasDeltaComplements<U>::value) {
+            return FactorTemplate(underlying.right_complement());
+        } else {
+            FactorTemplate delta = FactorTemplate(*this);
+            delta.delta();
+            return right_complement(delta);
+        }
     }
 
     /**
@@ -419,6 +605,23 @@ template <class U> class FactorTemplate {
             .right_complement();
     }
 
+    /**
+     * @brief Checks if the left meet of `*this` and `b` is the identity.
+     *
+     * Uses the matching `U` member function if there is one (see
+     * `HAS_LEFT_MEET_TEST`), and otherwise computes the meet.
+     *
+     * @param b Second operand.
+     * @return If `*this` and `b` have no common non-trivial left divisor.
+     */
+    inline bool left_meet_is_identity(const FactorTemplate &b) const {
+        if constexpr (HAS_LEFT_MEET_TEST) {
+            return underlying.left_meet_is_identity(b.underlying);
+        } else {
+            return left_meet(b).is_identity();
+        }
+    }
+
     /**
      * @brief Checks left-weightedness.
      *
@@ -426,7 +629,7 @@ template <class U> class FactorTemplate {
      * @return If `*this`\f${}\mid{}\f$`b` is left-weighted.
      */
     inline bool is_left_weighted(const FactorTemplate &b) const {
-        return right_complement().left_meet(b).is_identity();
+        return right_complement().left_meet_is_identity(b);
     }
 
     /**
@@ -492,23 +695,58 @@ template <class U> class FactorTemplate {
      */
     inline std::size_t hash() const { return underlying.hash(); }
 
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * This is a wrapper for the matching `U` member function. It only depends
+     * on the parameter.
+     *
+     * @return The size of the packed form of factors.
+     */
+    inline size_t packed_size() const { return underlying.packed_size(); }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * This is a wrapper for the matching `U` member function. The packed form
+     * is the tables representing the factor (without the parameter), written
+     * as little-endian integers: see the `U` member function for the layout.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    inline void pack(u8 *out) const { underlying.pack(out); }
+
+    /**
+     * @brief Sets the factor to one read in packed form.
+     *
+     * This is a wrapper for the matching `U` member function. The bytes are
+     * checked to describe a simple element.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a simple element (otherwise, `*this` is
+     * left in an unspecified state).
+     */
+    inline bool unpack(const u8 *in) { return underlying.unpack(in); }
+
     /**
      * @brief Randomizes the factor.
      *
      * This is a wrapper for the matching `U` member function, unless
-     * preprocessor variable `RANDOMIZE_AS_WORDS` is defined. In that case,
+     * preprocessor variable `RANDOMIZE_AS_WORD` is defined. In that case,
      * A random factor is polled instead.
      *
+     * Thread-safe: draws come from the calling thread's `random_engine()`.
+     *
      * @exception NonRandomizable Thrown if `U` does not support uniform polling
-     * and `RANDOMIZE_AS_WORDS` is not defined.
+     * and `RANDOMIZE_AS_WORD` is not defined.
      */
     inline void randomize() {
 
-#ifdef RANDOMIZE_AS_WORDS
+#ifdef RANDOMIZE_AS_WORD
 
-        std::vector<FactorTemplate> atoms = atoms();
+        std::vector<FactorTemplate> atoms_list = atoms();
 
-        *this = atoms[rand() % int(atoms.size())];
+        *this = atoms_list[random_below(atoms_list.size())];
 
 #else
 
@@ -533,6 +771,170 @@ template <class U> class FactorTemplate {
         }
         return factor_atoms;
     }
+
+    /**
+     * @brief Checks if the `k`-th atom left-divides `*this`.
+     *
+     * Uses the matching `U` member function if there is one, and otherwise
+     * computes a meet.
+     *
+     * @param k The index of an atom.
+     * @param atoms_list The atoms.
+     * @return If `atoms_list[k]` left-divides `*this`.
+     */
+    inline bool
+    is_left_divisible_by_atom(size_t k,
+                              const std::vector<FactorTemplate> &atoms_list)
+        const {
+        if constexpr (HasAtomDivisibility<U>::value) {
+            return underlying.is_left_divisible_by_atom(k);
+        } else {
+            return atoms_list[k].left_meet(*this) == atoms_list[k];
+        }
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom right-divides `*this`.
+     *
+     * Uses the matching `U` member function if there is one, and otherwise
+     * computes a meet.
+     *
+     * @param k The index of an atom.
+     * @param atoms_list The atoms.
+     * @return If `atoms_list[k]` right-divides `*this`.
+     */
+    inline bool
+    is_right_divisible_by_atom(size_t k,
+                               const std::vector<FactorTemplate> &atoms_list)
+        const {
+        if constexpr (HasAtomDivisibility<U>::value) {
+            return underlying.is_right_divisible_by_atom(k);
+        } else {
+            return atoms_list[k].right_meet(*this) == atoms_list[k];
+        }
+    }
+
+    /**
+     * @brief Calls `fun` on every left divisor of `*this`, once.
+     *
+     * Divisors are the vertices of a tree rooted at the identity, in which
+     * the parent of a divisor \f$y\f$ is \f$x\f$ such that \f$y=xa\f$,
+     * where \f$a\f$ is the last atom (in the order of `atoms`) that
+     * right-divides \f$y\f$. The tree is explored depth first, and no set of
+     * visited divisors is kept.
+     *
+     * This is not constant amortized time per divisor: each vertex costs a
+     * product and a right complement, a left divisibility test for every atom
+     * (to find its children) and up to one right divisibility test per atom
+     * (to check that it is their parent). All groups but `dual_complex` have
+     * dedicated tests (see `HasAtomDivisibility`), which are constant time for
+     * `coxeter`, `dihedral`, `euclidean_lattice` and left divisibility in
+     * `artin` and `standard_complex`, and linear in the parameter otherwise.
+     * `dual_complex` computes a meet for each test.
+     *
+     * The exploration may be split in chunks, that can run in parallel: the
+     * subtrees rooted at depth `SPLIT_DEPTH` are dealt round-robin, and the
+     * divisors above them belong to the first chunk.
+     *
+     * @tparam Fun A class of functions that take a factor.
+     * @param fun The function.
+     * @param chunk The index of the chunk to explore.
+     * @param number_of_chunks The number of chunks.
+     */
+    template <class Fun>
+    void for_each_left_divisor(Fun fun, size_t chunk = 0,
+                               size_t number_of_chunks = 1) const {
+        std::vector<FactorTemplate> atoms_list = atoms();
+        FactorTemplate e = FactorTemplate(*this);
+        e.identity();
+        size_t subtree = 0;
+        visit_left_divisors(fun, atoms_list, e, *this, 0, chunk,
+                            number_of_chunks, subtree);
+    }
+
+    /**
+     * @brief Calls `fun` on every simple element (with the same parameter as
+     * `*this`), once.
+     *
+     * Uses the matching `U` member function if there is one (see
+     * `HasForEachSimple`). Otherwise, these are the left divisors of
+     * \f$\Delta\f$: see `for_each_left_divisor`, also for the cost per
+     * element.
+     *
+     * @tparam Fun A class of functions that take a factor.
+     * @param fun The function.
+     * @param chunk The index of the chunk to explore.
+     * @param number_of_chunks The number of chunks.
+     */
+    template <class Fun>
+    void for_each_simple(Fun fun, size_t chunk = 0,
+                         size_t number_of_chunks = 1) const {
+        if constexpr (HasForEachSimple<U>::value) {
+            underlying.for_each_simple(
+                [&fun](const U &u) { fun(FactorTemplate(u)); }, chunk,
+                number_of_chunks);
+        } else {
+            FactorTemplate delta = FactorTemplate(*this);
+            delta.delta();
+            delta.for_each_left_divisor(fun, chunk, number_of_chunks);
+        }
+    }
+
+    /**
+     * @brief The depth at which `for_each_left_divisor` splits its
+     * exploration in chunks.
+     */
+    static const i16 SPLIT_DEPTH = 2;
+
+  private:
+    /**
+     * @brief Explores the subtree rooted at a divisor, for
+     * `for_each_left_divisor`.
+     *
+     * @tparam Fun A class of functions that take a factor.
+     * @param fun The function.
+     * @param atoms_list The atoms.
+     * @param x A left divisor.
+     * @param r Its right complement under the factor whose divisors are
+     * enumerated.
+     * @param depth The depth of `x` in the tree.
+     * @param chunk The index of the chunk to explore.
+     * @param number_of_chunks The number of chunks.
+     * @param subtree The number of vertices of depth `SPLIT_DEPTH` met so far.
+     */
+    template <class Fun>
+    static void visit_left_divisors(
+        Fun &fun, const std::vector<FactorTemplate> &atoms_list,
+        const FactorTemplate &x, const FactorTemplate &r, i16 depth,
+        size_t chunk, size_t number_of_chunks, size_t &subtree) {
+        if (depth < SPLIT_DEPTH) {
+            if (chunk == 0) {
+                fun(x);
+            }
+        } else if (depth > SPLIT_DEPTH ||
+                   subtree++ % number_of_chunks == chunk) {
+            fun(x);
+        } else {
+            return;
+        }
+
+        for (size_t k = 0; k < atoms_list.size(); k++) {
+            if (!r.is_left_divisible_by_atom(k, atoms_list)) {
+                continue;
+            }
+            FactorTemplate y = x * atoms_list[k];
+            size_t last = atoms_list.size() - 1;
+            while (last > k &&
+                   !y.is_right_divisible_by_atom(last, atoms_list)) {
+                last--;
+            }
+            if (last == k) {
+                visit_left_divisors(fun, atoms_list, y, r / atoms_list[k],
+                                    depth + 1, chunk, number_of_chunks,
+                                    subtree);
+            }
+        }
+    }
 };
 
 /**
@@ -546,7 +948,14 @@ template <class U> class FactorTemplate {
  * @return If `u` and `v` were modified.
  */
 template <class F> bool make_left_weighted(F &u, F &v) {
-    F t = (~u) ^ v;
+    F c = ~u;
+    // Most calls find a left-weighted pair: then the meet need not be built.
+    if constexpr (F::HAS_LEFT_MEET_TEST) {
+        if (c.left_meet_is_identity(v)) {
+            return false;
+        }
+    }
+    F t = c ^ v;
     if (t.is_identity()) {
         return false;
     } else {
@@ -644,29 +1053,33 @@ template <class F> class BraidTemplate {
      *
      * A list of the braid's canonical factors, from left to right. It is
      * left weighted when in LCF, and right weighted when in RCF.
+     *
+     * Its nodes are allocated from a memory resource, that is chosen when the
+     * braid is constructed (see `current_resource`).
      */
-    std::list<F> factor_list;
+    std::pmr::list<F> factor_list;
 
   public:
     /**
      * @brief Factor iterator.
      */
-    using FactorItr = typename std::list<F>::iterator;
+    using FactorItr = typename std::pmr::list<F>::iterator;
 
     /**
      * @brief Reverse factor iterator.
      */
-    using RevFactorItr = typename std::list<F>::reverse_iterator;
+    using RevFactorItr = typename std::pmr::list<F>::reverse_iterator;
 
     /**
      * @brief Constant factor iterator.
      */
-    using ConstFactorItr = typename std::list<F>::const_iterator;
+    using ConstFactorItr = typename std::pmr::list<F>::const_iterator;
 
     /**
      * @brief Constant reverse factor iterator.
      */
-    using ConstRevFactorItr = typename std::list<F>::const_reverse_iterator;
+    using ConstRevFactorItr =
+        typename std::pmr::list<F>::const_reverse_iterator;
 
     /**
      * @brief Iterator to the first factor.
@@ -744,17 +1157,21 @@ template <class F> class BraidTemplate {
      * @brief Construct a new BraidTemplate, with a group parameter.
      *
      * @param parameter Group parameter.
+     * @param resource The memory resource factors are allocated from.
      */
-    BraidTemplate(Parameter parameter)
-        : parameter(parameter), delta(0), factor_list() {}
+    BraidTemplate(Parameter parameter,
+                  std::pmr::memory_resource *resource = current_resource())
+        : parameter(parameter), delta(0), factor_list(resource) {}
 
     /**
      * @brief Construct a new BraidTemplate, from a factor.
      *
      * @param f Factor to be converted to a braid.
+     * @param resource The memory resource factors are allocated from.
      */
-    BraidTemplate(const F &f)
-        : parameter(f.get_parameter()), delta(0), factor_list() {
+    BraidTemplate(const F &f,
+                  std::pmr::memory_resource *resource = current_resource())
+        : parameter(f.get_parameter()), delta(0), factor_list(resource) {
         if (f.is_delta()) {
             delta = 1;
         } else if (!f.is_identity()) {
@@ -762,6 +1179,49 @@ template <class F> class BraidTemplate {
         }
     }
 
+    /**
+     * @brief Copy constructor.
+     *
+     * The copy does not share the memory resource of `b`: like any braid, it
+     * allocates from `resource`.
+     *
+     * @param b The braid to be copied.
+     * @param resource The memory resource factors are allocated from.
+     */
+    BraidTemplate(const BraidTemplate &b,
+                  std::pmr::memory_resource *resource = current_resource())
+        : parameter(b.parameter), delta(b.delta),
+          factor_list(b.factor_list, resource) {}
+
+    /**
+     * @brief Move constructor.
+     *
+     * The braid keeps the memory resource of `b`.
+     *
+     * @param b The braid to be moved.
+     */
+    BraidTemplate(BraidTemplate &&b) = default;
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * `*this` keeps its memory resource.
+     *
+     * @param b The braid to be copied.
+     * @return A reference to `*this`.
+     */
+    BraidTemplate &operator=(const BraidTemplate &b) = default;
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * `*this` keeps its memory resource.
+     *
+     * @param b The braid to be moved.
+     * @return A reference to `*this`.
+     */
+    BraidTemplate &operator=(BraidTemplate &&b) = default;
+
     /**
      * @brief Converts a string to a `Parameter`.
      *
@@ -1041,6 +1501,21 @@ template <class F> class BraidTemplate {
         clean();
     }
 
+    /**
+     * @brief Appends a factor to the LCF, without normalizing.
+     *
+     * @warning `f` must be neither the identity nor \f$\Delta\f$, and it must
+     * form a left-weighted decomposition with the last factor of the braid
+     * (if any), so that the braid stays in LCF. This is not checked.
+     *
+     * Constant time.
+     *
+     * @param f Second operand.
+     */
+    inline void push_back_left_weighted(const F &f) {
+        factor_list.push_back(f);
+    }
+
     /**
      * @brief Left-multiplies the braid by a braid.
      *
@@ -1700,11 +2175,26 @@ template <class F> class BraidTemplate {
         return rigidity;
     }
 
+    /**
+     * @brief Checks if the braid is rigid.
+     *
+     * That is, if its rigidity is equal to its canonical length, which is
+     * assumed to be non-zero.
+     *
+     * @return If the braid is rigid.
+     */
+    inline bool is_rigid() const {
+        return canonical_length() != 0 &&
+               size_t(rigidity()) == canonical_length();
+    }
+
     /**
      * @brief Randomizes the braid.
      *
      * The result isn't in LCF (so that it may be used to benchmark
-     * `normalize`).
+     * `normalize`). Threads may randomize braids concurrently, each drawing
+     * from its own `random_engine()`.
+     *
      * @param length An upper bound on the braid's new canonical
      * length (it is the number of pushed factors).
      */
@@ -1792,7 +2282,7 @@ template <class F> class BraidTemplate {
      * does not exist (e.g. `4` isn't a legal factor for artin braids on 4
      * strands).
      */
-    void of_string(const std::string str) {
+    void of_string(const std::string &str) {
         size_t pos = 0;
 
         // We use double backslashes, as we want to obtain escape sequences.
@@ -1802,10 +2292,11 @@ template <class F> class BraidTemplate {
         // recognize a single backslash `\`, we would have to escape it as
         // `\\\\`. In C++ `std::regex`, `\s` is a whitespace, `\t` a tab,
         // `\.` a dot and `\^` a chevron (`.` and `^` are special characters
-        // for `std::regex`).
-        std::regex ignore{"[\\s\\.\\t]*"};
-        std::regex power{"[\\s\\t]*\\^[\\s\\t]*(" + number_regex + ")"};
-        std::regex inverse{"![\\s\\t]*"};
+        // for `std::regex`). They are only compiled once, as this is much
+        // more expensive than matching them.
+        static const std::regex ignore{"[\\s\\.\\t]*"};
+        static const std::regex power{"[\\s\\t]*\\^[\\s\\t]*(" +
+                                      number_regex + ")"};
 
         BraidTemplate b = *this;
         b.identity();
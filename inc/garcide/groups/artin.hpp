@@ -30,7 +30,7 @@
 #ifndef ARTIN
 #define ARTIN
 
-#include "garcide/ultra_summit.hpp"
+#include "garcide/instantiation.hpp"
 
 namespace garcide {
 
@@ -67,7 +67,7 @@ class Underlying {
      *
      * Indexes start at \f$1\f$.
      */
-    std::vector<i16> permutation_table;
+    ResourceVector<i16> permutation_table;
 
   public:
     /**
@@ -295,11 +295,91 @@ class Underlying {
      */
     Underlying right_complement(const Underlying &b) const;
 
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Linear in the number of strands.
+     *
+     * @return If `*this` is the identity.
+     */
+    bool is_identity() const;
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Linear in the number of strands.
+     *
+     * @return If `*this` is \f$\Delta_n\f$.
+     */
+    bool is_delta() const;
+
+    /**
+     * @brief Computes the left complement of `*this` under the Garside element.
+     *
+     * Linear in the number of strands.
+     *
+     * @return The left complement of `*this` to \f$\Delta_n\f$.
+     */
+    Underlying left_complement() const;
+
+    /**
+     * @brief Computes the right complement of `*this` under the Garside
+     * element.
+     *
+     * Linear in the number of strands.
+     *
+     * @return The right complement of `*this` to \f$\Delta_n\f$.
+     */
+    Underlying right_complement() const;
+
+    /**
+     * @brief Checks if the left meet of `*this` and `b` is the identity.
+     *
+     * That is to say, if no atom \f$\sigma_i\f$ left-divides both, which is
+     * read on the descents of the permutations.
+     *
+     * Linear in the number of strands.
+     *
+     * @param b Second operand.
+     * @return If the left meet of `*this` and `b` is the identity.
+     */
+    bool left_meet_is_identity(const Underlying &b) const;
+
+    /**
+     * @brief Checks if the `k`-th atom \f$\sigma_{k+1}\f$ left-divides
+     * `*this`.
+     *
+     * That is to say, if \f$k+1\f$ is a descent of the permutation table.
+     *
+     * Constant time.
+     *
+     * @param k The index of the atom.
+     * @return If \f$\sigma_{k+1}\f$ left-divides `*this`.
+     */
+    inline bool is_left_divisible_by_atom(size_t k) const {
+        return permutation_table[k + 1] > permutation_table[k + 2];
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom \f$\sigma_{k+1}\f$ right-divides
+     * `*this`.
+     *
+     * That is to say, if \f$k+2\f$ comes before \f$k+1\f$ in the
+     * permutation table.
+     *
+     * Linear in the number of strands.
+     *
+     * @param k The index of the atom.
+     * @return If \f$\sigma_{k+1}\f$ right-divides `*this`.
+     */
+    bool is_right_divisible_by_atom(size_t k) const;
+
     /**
      * @brief Sets `*this` to a random factor.
      *
      * It is chosen uniformly other \f$\mathfrak S_n\f$, where \f$n\f$ is the
-     * dimension, using Knuth's shuffle algorithm.
+     * dimension, using Knuth's shuffle algorithm. It draws from
+     * `random_engine()`, so that threads may call it concurrently.
      *
      * Linear in the number of strands.
      */
@@ -334,6 +414,35 @@ class Underlying {
      */
     size_t hash() const;
 
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return \f$2n\f$.
+     */
+    inline size_t packed_size() const { return 2 * size_t(get_parameter()); }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is the inverse permutation table, from index \f$1\f$ to
+     * \f$n\f$, as 16-bit little-endian integers.
+     *
+     * Linear in the number of strands.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    void pack(u8 *out) const;
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * Every permutation is a factor. Linear in the number of strands.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    bool unpack(const u8 *in);
+
     /**
      * @brief Computes the tableau associated with a factor.
      *
@@ -384,6 +493,8 @@ enum class ThurstonType { Periodic, Reducible, PseudoAsonov };
  *
  * This was directly copied (mutatis mutandis) from Juan Gonzalez-Meneses' code.
  *
+ * Thread-safe: its tableaux are local to the call.
+ *
  * @param b The braid to be tested.
  * @return Whether `b` preserves a family of circles.
  */
@@ -394,6 +505,8 @@ bool preserves_circles(const Braid &b);
  *
  * This was directly copied (mutatis mutandis) from Juan Gonzalez-Meneses' code.
  *
+ * Thread-safe.
+ *
  * @param b The braid whose Thurston type is to be computed.
  * @param uss The ultra summit set of `b`.
  * @return The Thurston type of `b`.
@@ -406,13 +519,73 @@ ThurstonType thurston_type(const Braid &b,
  *
  * This was directly copied (mutatis mutandis) from Juan Gonzalez-Meneses' code.
  *
+ * If the cache is enabled, the result is looked up there first, and stored
+ * there afterwards. Thread-safe (see `cache` for the cache itself).
+ *
  * @param b The braid whose Thurston type is to be computed.
  * @return the Thurston type of `b`.
  */
 ThurstonType thurston_type(const Braid &b);
 
+/**
+ * @brief `enum` for the summit sets a Thurston type computation can rely on.
+ */
+enum class ThurstonPipeline { UltraSummit, SlidingCircuits };
+
+/**
+ * @brief Outcome of a Thurston type computation, with the work it took.
+ */
+struct ThurstonTypeReport {
+    /**
+     * @brief The Thurston type that was found.
+     */
+    ThurstonType type;
+
+    /**
+     * @brief The summit set that was used.
+     */
+    ThurstonPipeline pipeline;
+
+    /**
+     * @brief The number of orbits (or circuits) that were computed.
+     */
+    size_t number_of_orbits;
+
+    /**
+     * @brief The number of summit elements that were computed.
+     */
+    size_t number_of_elements;
+
+    /**
+     * @brief The number of calls to `preserves_circles`.
+     */
+    size_t number_of_tests;
+};
+
+/**
+ * @brief Computes the Thurston type of a braid, reporting the work done.
+ *
+ * With `ThurstonPipeline::UltraSummit`, this does the same as `thurston_type`.
+ *
+ * With `ThurstonPipeline::SlidingCircuits`, the sliding circuits set of `b` is
+ * explored instead, and each element is tested by `preserves_circles` as soon
+ * as it is discovered: the exploration stops at the first one that preserves a
+ * family of circles. Sliding circuits sets are contained in ultra summit sets,
+ * and are often much smaller.
+ *
+ * @param b The braid whose Thurston type is to be computed.
+ * @param pipeline The summit set to use.
+ * @return The Thurston type of `b`, with the pipeline that was used and the
+ * work done.
+ */
+ThurstonTypeReport thurston_type_report(
+    const Braid &b,
+    ThurstonPipeline pipeline = ThurstonPipeline::SlidingCircuits);
+
 } // namespace artin
 
+GARCIDE_INSTANTIATE(extern, artin::Underlying)
+
 /**
  * @brief Inserts a Thurston type in the output stream.
  *
@@ -423,6 +596,16 @@ template <>
 IndentedOStream &IndentedOStream::operator<< <artin::ThurstonType>(
     const artin::ThurstonType &type);
 
+/**
+ * @brief Inserts a Thurston type pipeline in the output stream.
+ *
+ * @param pipeline The pipeline to be inserted.
+ * @return A reference to `*this`, so that `<<` may be chained.
+ */
+template <>
+IndentedOStream &IndentedOStream::operator<< <artin::ThurstonPipeline>(
+    const artin::ThurstonPipeline &pipeline);
+
 } // namespace garcide
 
 #endif
\ No newline at end of file
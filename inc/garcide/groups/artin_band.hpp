@@ -0,0 +1,176 @@
+/**
+ * @file artin_band.hpp
+ * @author GarCide contributors
+ * @brief Header file for conversions between the classic and dual Garside
+ * structures of standard braid groups.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ARTIN_BAND
+#define ARTIN_BAND
+
+#include "garcide/centralizer.hpp"
+#include "garcide/groups/artin.hpp"
+#include "garcide/groups/band.hpp"
+
+namespace garcide {
+
+/**
+ * @brief Namespace for conversions between `artin` and `band` braids.
+ *
+ * Both describe the braid group \f$\mathrm B_n\f$, with the classic (Garside)
+ * and dual (Birman-Ko-Lee) structures respectively. Summit sets, and thus the
+ * cost of conjugacy and centralizer computations, may differ a lot between
+ * the two, so that this namespace also contains solvers that pick the
+ * structure they work in, and map their results back to `artin` braids.
+ */
+namespace artin_band {
+
+/**
+ * @brief `enum` for the Garside structures of \f$\mathrm B_n\f$.
+ */
+enum class Structure {
+    /** @brief The classic structure (`artin`). */
+    Classic,
+    /** @brief The dual structure (`band`). */
+    Dual
+};
+
+/**
+ * @brief Converts a braid from the classic to the dual structure.
+ *
+ * Each factor is read as a positive word in the \f$\sigma_i\f$, and
+ * \f$\sigma_i\f$ is the band generator \f$a_{i+1,i}\f$. Powers of
+ * \f$\Delta\f$ use \f$\Delta^2=\delta^n\f$.
+ *
+ * @param b The braid to convert.
+ * @return `b`, as a `band` braid.
+ */
+band::Braid band_of_artin(const artin::Braid &b);
+
+/**
+ * @brief Converts a braid from the dual to the classic structure.
+ *
+ * Each factor is read as a word in the band generators, and
+ * \f$a_{t,s}=(\sigma_{t-1}\cdots\sigma_{s+1})\sigma_s(\sigma_{t-1}\cdots
+ * \sigma_{s+1})^{-1}\f$. Powers of \f$\delta\f$ use
+ * \f$\delta^n=\Delta^2\f$.
+ *
+ * @param b The braid to convert.
+ * @return `b`, as an `artin` braid.
+ */
+artin::Braid artin_of_band(const band::Braid &b);
+
+/**
+ * @brief Predicts in which structure summit sets computations on `b1` and
+ * `b2` are cheaper.
+ *
+ * Both braids are sent to their super summit sets in both structures (which
+ * is polynomial). The cost of exploring summit sets is then estimated as the
+ * square of the sum of the canonical lengths, times the number of atoms (the
+ * minimal simple conjugators are searched for among their joins). Ties go
+ * to the classic structure.
+ *
+ * @param b1 First braid.
+ * @param b2 Second braid.
+ * @return The structure that is predicted to be cheaper.
+ */
+Structure cheaper_structure(const artin::Braid &b1, const artin::Braid &b2);
+
+/**
+ * @brief Predicts in which structure summit sets computations on `b` are
+ * cheaper.
+ *
+ * Same as `cheaper_structure(b, b)`.
+ *
+ * @param b A braid.
+ * @return The structure that is predicted to be cheaper.
+ */
+Structure cheaper_structure(const artin::Braid &b);
+
+/**
+ * @brief Conjugacy test, in a given structure.
+ *
+ * Uses sliding circuits, in `structure`.
+ *
+ * @param b1 First braid.
+ * @param b2 Second braid.
+ * @param c Set to a conjugator if `b1` and `b2` are conjugate.
+ * @param structure The structure the test is done in.
+ * @return If `b1` and `b2` are conjugate.
+ */
+bool are_conjugate(const artin::Braid &b1, const artin::Braid &b2,
+                   artin::Braid &c, Structure structure);
+
+/**
+ * @brief Conjugacy test, in the structure predicted to be cheaper.
+ *
+ * @param b1 First braid.
+ * @param b2 Second braid.
+ * @param c Set to a conjugator if `b1` and `b2` are conjugate.
+ * @return If `b1` and `b2` are conjugate.
+ */
+bool are_conjugate(const artin::Braid &b1, const artin::Braid &b2,
+                   artin::Braid &c);
+
+/**
+ * @brief Computes a generating set of the centralizer of `b`, in a given
+ * structure.
+ *
+ * @param b A braid.
+ * @param structure The structure the computation is done in.
+ * @return Generators of the centralizer of `b`, as `artin` braids.
+ */
+centralizer::Centralizer<artin::Braid> centralizer(const artin::Braid &b,
+                                                   Structure structure);
+
+/**
+ * @brief Computes a generating set of the centralizer of `b`, in the
+ * structure predicted to be cheaper.
+ *
+ * Centralizers are computed from ultra summit sets. Should that fail in the
+ * dual structure (`ultra_summit::NotUltraSummit`), the computation is done
+ * again in the classic one.
+ *
+ * @param b A braid.
+ * @return Generators of the centralizer of `b`, as `artin` braids.
+ */
+centralizer::Centralizer<artin::Braid> centralizer(const artin::Braid &b);
+
+} // namespace artin_band
+
+/**
+ * @brief Inserts a structure in the output stream.
+ *
+ * @param structure The structure to be inserted.
+ * @return A reference to `*this`, so that `<<` may be chained.
+ */
+template <>
+IndentedOStream &IndentedOStream::operator<< <artin_band::Structure>(
+    const artin_band::Structure &structure);
+
+} // namespace garcide
+
+#endif
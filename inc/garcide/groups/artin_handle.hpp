@@ -0,0 +1,135 @@
+/**
+ * @file artin_handle.hpp
+ * @author GarCide contributors
+ * @brief Header file for handle reduction of braid words in the
+ * \f$\sigma_i\f$.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ARTIN_HANDLE
+#define ARTIN_HANDLE
+
+#include "garcide/groups/artin.hpp"
+
+namespace garcide {
+
+/**
+ * @brief Namespace for handle reduction of braid words.
+ *
+ * Dehornoy's handle reduction decides if a word in the Artin generators
+ * \f$\sigma_i\f$ represents the trivial braid, and compares braids for the
+ * Dehornoy order, without computing normal forms. A \f$\sigma_i\f$-handle is
+ * a subword \f$\sigma_i^e w\sigma_i^{-e}\f$, with \f$e=\pm1\f$ and \f$w\f$ a
+ * word in the \f$\sigma_j\f$ for \f$j>i\f$. Reducing it means deleting its
+ * ends, and replacing every letter \f$\sigma_{i+1}^d\f$ of \f$w\f$ with
+ * \f$\sigma_{i+1}^{-e}\sigma_i^d\sigma_{i+1}^e\f$, which does not change the
+ * braid. Reducing handles always terminates, on a word that has none. Such a
+ * word is either empty, or \f$\sigma\f$-positive (its letter of least index
+ * only appears with exponent \f$1\f$), or \f$\sigma\f$-negative.
+ *
+ * On long words, this is in practice much faster than computing the left
+ * normal form, although no polynomial bound is known.
+ */
+namespace artin_handle {
+
+/**
+ * @brief Braid words.
+ *
+ * A letter \f$i>0\f$ stands for \f$\sigma_i\f$, and a letter \f$-i<0\f$ for
+ * \f$\sigma_i^{-1}\f$. Letters may not be \f$0\f$.
+ */
+using Word = std::vector<i16>;
+
+/**
+ * @brief Reads a braid as a word.
+ *
+ * Factors are read as positive words in the \f$\sigma_i\f$, the same way
+ * `artin::Underlying::print` does, and \f$\Delta^{-1}\f$ as the inverse of the
+ * word of \f$\Delta\f$.
+ *
+ * Linear in the length of the word.
+ *
+ * @param b A braid.
+ * @return A word representing `b`.
+ */
+Word word_of_braid(const artin::Braid &b);
+
+/**
+ * @brief Computes the inverse of a word.
+ *
+ * @param w A word.
+ * @return The word representing the inverse of `w`.
+ */
+Word inverse(const Word &w);
+
+/**
+ * @brief Reduces all handles of `w`, in place.
+ *
+ * The handle that ends first is reduced, until there is none left. Letters
+ * that precede it need not be read again: the word is a gap buffer, whose left
+ * part is the prefix read so far, that has no handle, and whose right part is
+ * what is left to read, to which reduced handles are pushed back.
+ *
+ * @param w A word. It is set to an equivalent word that has no handle.
+ */
+void reduce(Word &w);
+
+/**
+ * @brief Computes the sign of a braid for the Dehornoy order.
+ *
+ * @param w A word.
+ * @return `1` if `w` represents a \f$\sigma\f$-positive braid, `-1` if it
+ * represents a \f$\sigma\f$-negative one, and `0` if it represents the trivial
+ * braid.
+ */
+i16 sign(Word w);
+
+/**
+ * @brief Checks if a word represents the trivial braid.
+ *
+ * @param w A word.
+ * @return If `w` represents the trivial braid.
+ */
+bool is_trivial(Word w);
+
+/**
+ * @brief Compares two braids for the Dehornoy order.
+ *
+ * \f$\beta_1<\beta_2\f$ if \f$\beta_1^{-1}\beta_2\f$ is
+ * \f$\sigma\f$-positive.
+ *
+ * @param w1 A word.
+ * @param w2 Another word.
+ * @return `-1`, `0` or `1` whether the braid represented by `w1` is
+ * respectively smaller than, equal to or greater than the one represented by
+ * `w2`.
+ */
+i16 compare(const Word &w1, const Word &w2);
+
+} // namespace artin_handle
+
+} // namespace garcide
+
+#endif
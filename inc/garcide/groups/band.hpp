@@ -30,7 +30,7 @@
 #ifndef BAND
 #define BAND
 
-#include "garcide/garcide.hpp"
+#include "garcide/instantiation.hpp"
 
 #ifdef USE_CLN
 
@@ -73,7 +73,7 @@ class Underlying {
      *
      * Indexes start at \f$1\f$.
      */
-    std::vector<i16> permutation_table;
+    ResourceVector<i16> permutation_table;
 
   public:
     /**
@@ -263,7 +263,9 @@ class Underlying {
      * For the dual structure, the left and right meets are equal.
      *
      * Linear in the number of strands, although it uses a `thread_local` square
-     * matrix of dimension `MAX_BRAID_INDEX + 1`.
+     * matrix of dimension \f$n + 1\f$ (that only grows when larger parameters
+     * are seen), so that concurrent calls from different threads do not share
+     * it.
      *
      * @param b Second operand.
      * @return The meet of `*this` and `b`.
@@ -279,7 +281,9 @@ class Underlying {
      * For the dual structure, the left and right meets are equal.
      *
      * Linear in the number of strands, although it uses a `thread_local` square
-     * matrix of dimension `MAX_BRAID_INDEX + 1`.
+     * matrix of dimension \f$n + 1\f$ (that only grows when larger parameters
+     * are seen), so that concurrent calls from different threads do not share
+     * it.
      *
      * @param b Second operand.
      * @return The meet of `*this` and `b`.
@@ -342,6 +346,107 @@ class Underlying {
      */
     Underlying right_complement(const Underlying &b) const;
 
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Linear in the number of strands.
+     *
+     * @return If `*this` is the identity.
+     */
+    bool is_identity() const;
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Linear in the number of strands.
+     *
+     * @return If `*this` is \f$\delta_n\f$.
+     */
+    bool is_delta() const;
+
+    /**
+     * @brief Computes the left complement of `*this` under the Garside element.
+     *
+     * Linear in the number of strands.
+     *
+     * @return The left complement of `*this` to \f$\delta_n\f$.
+     */
+    Underlying left_complement() const;
+
+    /**
+     * @brief Computes the right complement of `*this` under the Garside
+     * element.
+     *
+     * Linear in the number of strands.
+     *
+     * @return The right complement of `*this` to \f$\delta_n\f$.
+     */
+    Underlying right_complement() const;
+
+    /**
+     * @brief Checks if the meet of `*this` and `b` is the identity.
+     *
+     * That is to say, if no two strands lie in the same cell of both
+     * partitions. Unlike `left_meet()`, this does not use the square matrix.
+     *
+     * Linear in the number of strands.
+     *
+     * @param b Second operand.
+     * @return If the meet of `*this` and `b` is the identity.
+     */
+    bool left_meet_is_identity(const Underlying &b) const;
+
+    /**
+     * @brief Checks if the `k`-th atom \f$a_{i,j}\f$ left-divides `*this`.
+     *
+     * That is to say, if \f$i\f$ and \f$j\f$ lie in the same cell of the
+     * partition, which is checked by walking along the cycle of \f$i\f$.
+     *
+     * Linear in the number of strands.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom left-divides `*this`.
+     */
+    bool is_left_divisible_by_atom(size_t k) const;
+
+    /**
+     * @brief Checks if the `k`-th atom \f$a_{i,j}\f$ right-divides `*this`.
+     *
+     * Atoms are reflections, which left-divide a factor if and only if they
+     * right-divide it: see `is_left_divisible_by_atom`.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom right-divides `*this`.
+     */
+    inline bool is_right_divisible_by_atom(size_t k) const {
+        return is_left_divisible_by_atom(k);
+    }
+
+    /**
+     * @brief Calls `fun` on every simple element (with the same parameter as
+     * `*this`), once.
+     *
+     * Ballot sequences are enumerated depth first, and sent to factors by
+     * `of_ballot_sequence`, which is linear in the number of strands.
+     *
+     * The enumeration may be split in chunks, that can run in parallel:
+     * sequences are dealt round-robin, so that every chunk walks through all
+     * of them, but only converts its own.
+     *
+     * @tparam Fun A class of functions that take a factor.
+     * @param fun The function.
+     * @param chunk The index of the chunk to explore.
+     * @param number_of_chunks The number of chunks.
+     */
+    template <class Fun>
+    void for_each_simple(Fun fun, size_t chunk = 0,
+                         size_t number_of_chunks = 1) const {
+        i8 s[2 * MAX_NUMBER_OF_STRANDS + 1];
+        Underlying f = *this;
+        size_t rank = 0;
+        f.extend_ballot_sequence(fun, s, 1, 0, chunk, number_of_chunks, rank);
+    }
+
     /**
      * @brief Sets `*this` to a random factor.
      *
@@ -355,7 +460,8 @@ class Underlying {
      * is planned to switch from _CLN_ to a more specific bigints library, but
      * for the time being the function will just throw `NonRandomizable`.
      *
-     * It should end up being quasilinear in the number of strands.
+     * It should end up being quasilinear in the number of strands. With
+     * _CLN_, draws from its global random state are serialized by a mutex.
      *
      * @exception NonRandomizable Thrown, unless by some miracle you are
      * compiling the project with _CLN_.
@@ -391,6 +497,36 @@ class Underlying {
      */
     size_t hash() const;
 
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return \f$2n\f$.
+     */
+    inline size_t packed_size() const { return 2 * size_t(get_parameter()); }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is the inverse permutation table, from index \f$1\f$ to
+     * \f$n\f$, as 16-bit little-endian integers.
+     *
+     * Linear in the number of strands.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    void pack(u8 *out) const;
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * The permutation must have decreasing cycles, along a non-crossing
+     * partition. Linear in the number of strands.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    bool unpack(const u8 *in);
+
     /**
      * @brief Sets the factor to the one associated with a given ballot
      * sequence.
@@ -410,6 +546,44 @@ class Underlying {
      * `*this`.
      */
     Underlying inverse() const;
+
+    /**
+     * @brief Extends a prefix of a ballot sequence in every possible way, for
+     * `for_each_simple`.
+     *
+     * @tparam Fun A class of functions that take a factor.
+     * @param fun The function.
+     * @param s The sequence, that is set from index \f$1\f$ to `i - 1`.
+     * @param i The next index.
+     * @param height The number of unmatched \f$1\f$s in the prefix.
+     * @param chunk The index of the chunk to explore.
+     * @param number_of_chunks The number of chunks.
+     * @param rank The number of sequences met so far.
+     */
+    template <class Fun>
+    void extend_ballot_sequence(Fun &fun, i8 *s, i16 i, i16 height,
+                                size_t chunk, size_t number_of_chunks,
+                                size_t &rank) {
+        i16 n = get_parameter();
+        if (i > 2 * n) {
+            if (rank++ % number_of_chunks == chunk) {
+                of_ballot_sequence(s);
+                fun(*this);
+            }
+            return;
+        }
+        // There must be room left to match an opening.
+        if (height < 2 * n - i) {
+            s[i] = 1;
+            extend_ballot_sequence(fun, s, i + 1, height + 1, chunk,
+                                   number_of_chunks, rank);
+        }
+        if (height > 0) {
+            s[i] = -1;
+            extend_ballot_sequence(fun, s, i + 1, height - 1, chunk,
+                                   number_of_chunks, rank);
+        }
+    }
 };
 
 /**
@@ -450,4 +624,10 @@ const cln::cl_I &get_catalan_number(i16 n);
 
 } // namespace garcide::band
 
+namespace garcide {
+
+GARCIDE_INSTANTIATE(extern, band::Underlying)
+
+} // namespace garcide
+
 #endif
\ No newline at end of file
@@ -0,0 +1,680 @@
+/**
+ * @file coxeter.hpp
+ * @author GarCide contributors
+ * @brief Header file for table-driven finite type Artin groups (classical and
+ * dual Garside structures).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COXETER
+#define COXETER
+
+#include "garcide/instantiation.hpp"
+
+namespace garcide {
+
+/**
+ * @brief Namespace for Artin groups of arbitrary finite Coxeter type, whose
+ * Garside structure is described by precomputed tables.
+ */
+namespace coxeter {
+
+/**
+ * @brief Garside structure of a `Lattice`.
+ */
+enum class Structure {
+    /** @brief Classical structure: simples are the elements of \f$W\f$. */
+    Classic,
+    /** @brief Dual structure: simples are the non-crossing elements below a
+       Coxeter element. */
+    Dual
+};
+
+/**
+ * @brief The lattice of simple elements of a finite type Garside structure.
+ *
+ * Simple elements are numbered from `0` (the identity) to
+ * `number_of_simples - 1`, and everything the `Underlying` class needs is
+ * read from tables indexed by these numbers and by atoms. Multiplying or
+ * dividing by an atom is a table lookup, and the sets of atoms that divide a
+ * simple element on either side are stored as bitsets, so that meets are
+ * computed greedily one atom at a time.
+ *
+ * Lattices are built once by `CoxeterParameter`'s factory and are never
+ * modified nor freed afterwards, so that they may be freely shared between
+ * threads.
+ */
+struct Lattice {
+    /**
+     * @brief Canonical description, as printed and as parsed back by
+     * `Underlying::parameter_of_string`.
+     */
+    std::string description;
+
+    /** @brief The Garside structure the tables describe. */
+    Structure structure;
+
+    /** @brief Rank of the Coxeter system. */
+    i16 rank;
+
+    /** @brief Coxeter matrix, as a `rank` by `rank` row-major array. */
+    std::vector<i16> coxeter_matrix;
+
+    /**
+     * @brief Number of atoms.
+     *
+     * `rank` for the classical structure, the number of reflections for the
+     * dual one. In the latter case the first `rank` atoms are the simple
+     * reflections, in order.
+     */
+    i16 number_of_atoms;
+
+    /** @brief Number of 64 bits words in an atom bitset. */
+    i16 words;
+
+    /** @brief Number of simple elements. */
+    i32 number_of_simples;
+
+    /** @brief Index of \f$\Delta\f$. */
+    i32 delta;
+
+    /** @brief Length of \f$\Delta\f$ as a word in the atoms. */
+    i16 height;
+
+    /** @brief Order of conjugation by \f$\Delta\f$. */
+    i16 tau_order;
+
+    /**
+     * @brief Atoms, as simple elements indices.
+     */
+    std::vector<i32> atoms;
+
+    /**
+     * @brief `left_multiplication[x * number_of_atoms + a]` is the index of
+     * \f$a x\f$.
+     *
+     * It is `-1` if \f$a x\f$ is not simple.
+     */
+    std::vector<i32> left_multiplication;
+
+    /**
+     * @brief `right_multiplication[x * number_of_atoms + a]` is the index of
+     * \f$x a\f$.
+     *
+     * It is `-1` if \f$x a\f$ is not simple.
+     */
+    std::vector<i32> right_multiplication;
+
+    /**
+     * @brief Bitsets of the atoms left dividing each simple element, `words`
+     * words per element.
+     */
+    std::vector<u64> left_divisors;
+
+    /**
+     * @brief Bitsets of the atoms right dividing each simple element, `words`
+     * words per element.
+     */
+    std::vector<u64> right_divisors;
+
+    /**
+     * @brief Smallest atom left dividing each simple element (`-1` for the
+     * identity).
+     */
+    std::vector<i16> first_atom;
+
+    /**
+     * @brief Smallest atom right dividing each simple element (`-1` for the
+     * identity).
+     */
+    std::vector<i16> last_atom;
+
+    /** @brief Conjugates of the simple elements by \f$\Delta\f$. */
+    std::vector<i32> tau;
+
+    /** @brief Left complements of the simple elements to \f$\Delta\f$. */
+    std::vector<i32> delta_left_complement;
+
+    /** @brief Right complements of the simple elements to \f$\Delta\f$. */
+    std::vector<i32> delta_right_complement;
+
+    /**
+     * @brief Smallest common atom of two bitsets.
+     *
+     * @param u First bitset.
+     * @param v Second bitset.
+     * @return The smallest atom in both `u` and `v`, or `-1` if there is none.
+     */
+    inline i16 common_atom(const u64 *u, const u64 *v) const {
+        for (i16 w = 0; w < words; w++) {
+            u64 c = u[w] & v[w];
+            if (c != 0) {
+                return 64 * w + __builtin_ctzll(c);
+            }
+        }
+        return -1;
+    }
+};
+
+/**
+ * @brief Class for finite type Artin groups parameters.
+ *
+ * A parameter is a (non-owning) pointer to the `Lattice` describing the
+ * structure. Lattices are shared: two parameters built from the same
+ * description point to the same lattice, which is computed only the first
+ * time it is asked for.
+ */
+struct CoxeterParameter {
+    /**
+     * @brief Tables describing the Garside structure.
+     */
+    const Lattice *lattice;
+
+    /**
+     * @brief Construct a new `CoxeterParameter`.
+     *
+     * @param lattice Its `lattice` member.
+     */
+    inline CoxeterParameter(const Lattice *lattice) : lattice(lattice) {}
+
+    /**
+     * @brief Equality check.
+     *
+     * As lattices are shared, this is pointer equality.
+     *
+     * @param p Second operand.
+     * @return If `*this` and `p` are equal.
+     */
+    inline bool compare(const CoxeterParameter &p) const {
+        return lattice == p.lattice;
+    }
+
+    /**
+     * @brief Equality check.
+     *
+     * Syntactic sugar for `compare()`.
+     *
+     * @param p Second operand.
+     * @return If `*this` and `p` are equal.
+     */
+    inline bool operator==(const CoxeterParameter &p) const {
+        return compare(p);
+    }
+
+    /**
+     * @brief Unequality check.
+     *
+     * @param p Second operand.
+     * @return If `*this` and `p` are not equal.
+     */
+    inline bool operator!=(const CoxeterParameter &p) const {
+        return !compare(p);
+    }
+
+    /**
+     * @brief Prints the parameter to output stream `os`.
+     *
+     * @param os The output stream it is printed in.
+     */
+    void print(IndentedOStream &os) const;
+
+    /**
+     * @brief Gets the lattice associated with a Coxeter matrix.
+     *
+     * Builds it on the first call with this `description`, and returns the
+     * cached one afterwards. Thread-safe.
+     *
+     * @param description Canonical description of the lattice.
+     * @param coxeter_matrix Coxeter matrix, row-major.
+     * @param structure Which Garside structure to build.
+     * @return A pointer to the lattice, valid for the whole execution.
+     * @exception InvalidStringError Thrown if the structure has more than
+     * `MAX_NUMBER_OF_SIMPLES` simple elements.
+     */
+    static const Lattice *get_lattice(const std::string &description,
+                                      const std::vector<i16> &coxeter_matrix,
+                                      Structure structure);
+
+    /**
+     * @brief Maximum number of simple elements of a lattice.
+     *
+     * Tables take a few dozen bytes per simple element and atom; this is
+     * enough for \f$\mathrm E_7\f$ in the classical structure, and for every
+     * irreducible type in the dual one.
+     */
+    static const i32 MAX_NUMBER_OF_SIMPLES = 1 << 22;
+};
+
+/**
+ * @brief A class for table-driven canonical factors.
+ *
+ * A factor is an index into the tables of its `Lattice`. It supports any
+ * finite Coxeter group, given either by its type (\f$\mathrm A_n\f$,
+ * \f$\mathrm B_n\f$, \f$\mathrm D_n\f$, \f$\mathrm E_{6,7,8}\f$,
+ * \f$\mathrm F_4\f$, \f$\mathrm G_2\f$, \f$\mathrm H_{3,4}\f$,
+ * \f$\mathrm I_2(m)\f$) or by its Coxeter matrix.
+ *
+ * In the classical structure, atoms are the standard generators
+ * \f$\sigma_1,\ldots,\sigma_n\f$ and simple elements are the elements of the
+ * Coxeter group \f$W\f$. The tables are built by enumerating the orbit of a
+ * regular point under the geometric representation of \f$W\f$.
+ *
+ * In the dual structure, atoms are the reflections of \f$W\f$ and simple
+ * elements are the prefixes of the Coxeter element \f$c=s_1\cdots s_n\f$
+ * for the reflection length (Bessis, _The dual braid monoid_, 2003). The
+ * reflection length of \f$w\f$ is computed as the rank of \f$\mathrm I-w\f$.
+ *
+ * Both enumerations work in floating point and identify elements by rounding
+ * their coordinates; this is exact for every finite Coxeter group of
+ * reasonable rank.
+ *
+ * Operations that only involve the tables are linear in the length of the
+ * factors involved (times the number of bitset words for meets), and do not
+ * depend on the size of the group.
+ */
+class Underlying {
+
+  public:
+    /**
+     * @brief Parameter type.
+     */
+    using Parameter = CoxeterParameter;
+
+  private:
+    /**
+     * @brief Tables describing the structure.
+     */
+    const Lattice *lattice;
+
+    /**
+     * @brief Index of the factor in the tables of `lattice`.
+     */
+    i32 index;
+
+  public:
+    /**
+     * @brief Converts a string to a parameter.
+     *
+     * Accepted strings are an optional `dual` keyword, followed either by a
+     * type (`A<n>`, `B<n>`, `C<n>`, `D<n>`, `E6`, `E7`, `E8`, `F4`, `G2`,
+     * `H3`, `H4`, `I2(<m>)`, possibly with an underscore before the number)
+     * or by a symmetric Coxeter matrix, rows separated by semicolons and
+     * enclosed in brackets (_e.g._ `[1 3 2; 3 1 3; 2 3 1]` for \f$\mathrm
+     * A_3\f$), ignoring whitespaces. Generators are numbered as in Bourbaki.
+     *
+     * The tables are built on the first use of a given parameter, only once
+     * even if several threads use it at the same time.
+     *
+     * @param str The string to read.
+     * @return A parameter matching `str`.
+     * @exception InvalidStringError Thrown if `str` is not recognized, if the
+     * Coxeter group it describes is infinite, or if it is too big.
+     */
+    static Parameter parameter_of_string(const std::string &str);
+
+    /**
+     * @brief Gets the group parameter.
+     *
+     * @return The group parameter.
+     */
+    inline Parameter get_parameter() const { return Parameter(lattice); }
+
+    /**
+     * @brief Height of the lattice.
+     *
+     * (_I.e._ the length of \f$\Delta\f$ as a word in the atoms: the number
+     * of reflections of \f$W\f$ in the classical structure, its rank in the
+     * dual one.)
+     *
+     * @return The height of the lattice.
+     */
+    inline i16 lattice_height() const { return lattice->height; }
+
+    /**
+     * @brief Construct a new `Underlying`.
+     *
+     * Construct a new `Underlying`, with `p` as its parameter.
+     *
+     * It will be initialized as the identity factor.
+     *
+     * @param p The parameter of the factor.
+     */
+    inline Underlying(Parameter p) : lattice(p.lattice), index(0) {}
+
+    /**
+     * @brief Gets the index of the factor in its lattice's tables.
+     *
+     * @return The index of the factor.
+     */
+    inline i32 get_index() const { return index; }
+
+    /**
+     * @brief Extraction from string.
+     *
+     * Reads the string `str`, starting at position `pos`, and sets `this` to
+     * the corresponding atom.
+     *
+     * Letting \f$Z = [\texttt{1} - \texttt{9}] [\texttt{0} - \texttt{9}]^*\f$
+     * be a regular expression representing positive integers, accepted
+     * strings are those represented by regular expression
+     * \f$\texttt{s} \texttt{_}? Z\mid \texttt{r} \texttt{_}? Z\mid
+     * \texttt{D}\f$, ignoring whitespaces.
+     *
+     * \f$\texttt{s}i\f$ is the \f$i\f$-th standard generator. In the dual
+     * structure, \f$\texttt{r}k\f$ is the \f$k\f$-th reflection (the first
+     * ones being the standard generators). \f$\texttt{D}\f$ represents
+     * \f$\Delta\f$.
+     *
+     * @param str The string to extract from.
+     * @param pos The position to start from.
+     * @exception InvalidStringError Thrown when there is no subword starting
+     * from `pos` that matches the expression.
+     */
+    void of_string(const std::string &str, size_t &pos);
+
+    /**
+     * @brief Prints internal representation in `os`.
+     *
+     * Prints the lattice description and the factor's index, typically for
+     * debugging.
+     *
+     * @param os The output stream it is printed in.
+     */
+    void debug(IndentedOStream &os) const;
+
+    /**
+     * @brief Prints the factor to `os`.
+     *
+     * It is printed as a word in the atoms, in the same format as
+     * `of_string()` reads them.
+     *
+     * @param os The output stream it prints to.
+     */
+    void print(IndentedOStream &os) const;
+
+    /**
+     * @brief Sets the factor to the identity.
+     *
+     * Constant time.
+     */
+    inline void identity() { index = 0; }
+
+    /**
+     * @brief Sets the factor to the Garside element.
+     *
+     * Constant time.
+     */
+    inline void delta() { index = lattice->delta; }
+
+    /**
+     * @brief Equality check.
+     *
+     * Constant time.
+     *
+     * @param b Second operand.
+     * @return If `*this` and `b` are equal.
+     */
+    inline bool compare(const Underlying &b) const { return index == b.index; }
+
+    /**
+     * @brief Computes the product of two factors.
+     *
+     * Linear in the length of `b`.
+     *
+     * @param b Second (right) operand.
+     * @return The product of `*this` and `b`, assuming it is simple.
+     */
+    Underlying product(const Underlying &b) const;
+
+    /**
+     * @brief Computes the left complement of a factor.
+     *
+     * Linear in the length of `*this`.
+     *
+     * @param b Second operand.
+     * @return The left complement of `*this` to `b`.
+     */
+    Underlying left_complement(const Underlying &b) const;
+
+    /**
+     * @brief Computes the right complement of a factor.
+     *
+     * Linear in the length of `*this`.
+     *
+     * @param b Second operand.
+     * @return The right complement of `*this` to `b`.
+     */
+    Underlying right_complement(const Underlying &b) const;
+
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Constant time.
+     *
+     * @return If `*this` is the identity.
+     */
+    inline bool is_identity() const { return index == 0; }
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Constant time.
+     *
+     * @return If `*this` is \f$\Delta\f$.
+     */
+    inline bool is_delta() const { return index == lattice->delta; }
+
+    /**
+     * @brief Computes the left complement of `*this` to \f$\Delta\f$.
+     *
+     * Constant time (it is read from the tables).
+     *
+     * @return The left complement of `*this` to \f$\Delta\f$.
+     */
+    inline Underlying left_complement() const {
+        Underlying f = *this;
+        f.index = lattice->delta_left_complement[index];
+        return f;
+    }
+
+    /**
+     * @brief Computes the right complement of `*this` to \f$\Delta\f$.
+     *
+     * Constant time (it is read from the tables).
+     *
+     * @return The right complement of `*this` to \f$\Delta\f$.
+     */
+    inline Underlying right_complement() const {
+        Underlying f = *this;
+        f.index = lattice->delta_right_complement[index];
+        return f;
+    }
+
+    /**
+     * @brief Checks if the left meet of `*this` and `b` is the identity.
+     *
+     * That is to say, if they have no common atom left dividing them: one
+     * intersection of atom bitsets.
+     *
+     * @param b Second operand.
+     * @return If the left meet of `*this` and `b` is the identity.
+     */
+    inline bool left_meet_is_identity(const Underlying &b) const {
+        const u64 *divisors = &lattice->left_divisors[0];
+        return lattice->common_atom(divisors + index * lattice->words,
+                                    divisors + b.index * lattice->words) == -1;
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom left-divides `*this`.
+     *
+     * One bit of the atom bitsets.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom left-divides `*this`.
+     */
+    inline bool is_left_divisible_by_atom(size_t k) const {
+        return lattice->left_divisors[index * lattice->words + k / 64] >>
+                   (k % 64) &
+               1;
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom right-divides `*this`.
+     *
+     * One bit of the atom bitsets.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom right-divides `*this`.
+     */
+    inline bool is_right_divisible_by_atom(size_t k) const {
+        return lattice->right_divisors[index * lattice->words + k / 64] >>
+                   (k % 64) &
+               1;
+    }
+
+    /**
+     * @brief Conjugates by \f$\Delta^k\f$.
+     *
+     * Linear in \f$k\f$ modulo the order of \f$\tau\f$.
+     *
+     * @param k The exponent.
+     */
+    void delta_conjugate_mut(i16 k);
+
+    /**
+     * @brief Computes the meet of two factors.
+     *
+     * Greedily left divides both factors by a common atom while there is one,
+     * each step costing one intersection of atom bitsets and three table
+     * lookups.
+     *
+     * @param b Second operand.
+     * @return The left meet of `*this` and `b`.
+     */
+    Underlying left_meet(const Underlying &b) const;
+
+    /**
+     * @brief Computes the meet of two factors.
+     *
+     * Symmetric of `left_meet()`.
+     *
+     * @param b Second operand.
+     * @return The right meet of `*this` and `b`.
+     */
+    Underlying right_meet(const Underlying &b) const;
+
+    /**
+     * @brief Sets the factor to a uniformly random simple element.
+     *
+     * Constant time. Thread-safe, as it draws from `random_engine()`.
+     */
+    void randomize();
+
+    /**
+     * @brief List of the atoms.
+     *
+     * @return A vector containing the atoms.
+     */
+    std::vector<Underlying> atoms() const;
+
+    /**
+     * @brief Hashes the factor.
+     *
+     * Constant time.
+     *
+     * @return The hash.
+     */
+    inline std::size_t hash() const { return index; }
+
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return `4`.
+     */
+    inline size_t packed_size() const { return 4; }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is `index`, as a 32-bit little-endian integer. Indices depend on
+     * the order in which the lattice is built, which only depends on the
+     * parameter.
+     *
+     * Constant time.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    inline void pack(u8 *out) const {
+        pack_u16(out, u16(index & 0xffff));
+        pack_u16(out + 2, u16((index >> 16) & 0xffff));
+    }
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * Constant time.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    inline bool unpack(const u8 *in) {
+        index = i32(unpack_u16(in)) | (i32(unpack_u16(in + 2)) << 16);
+        return index >= 0 && index < lattice->number_of_simples;
+    }
+};
+
+/**
+ * @brief Class for finite type Artin groups canonical factors.
+ */
+using Factor = FactorTemplate<Underlying>;
+
+/**
+ * @brief Class for finite type Artin groups elements.
+ */
+using Braid = BraidTemplate<Factor>;
+
+} // namespace coxeter
+
+GARCIDE_INSTANTIATE(extern, coxeter::Underlying)
+
+/**
+ * @brief Inserts a parameter in the output stream.
+ *
+ * Syntactic sugar for `coxeter::CoxeterParameter.print()`.
+ *
+ * @param p The parameeter to be inserted.
+ * @return A reference to `*this`, so that `<<` may be chained.
+ */
+template <>
+inline IndentedOStream &IndentedOStream::operator<< <coxeter::CoxeterParameter>(
+    const coxeter::CoxeterParameter &p) {
+    p.print(*this);
+    return *this;
+}
+
+} // namespace garcide
+
+#endif
@@ -28,7 +28,11 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "garcide/garcide.hpp"
+#ifndef DIHEDRAL
+#define DIHEDRAL
+
+#include "garcide/instantiation.hpp"
+#include <deque>
 
 /**
  * @brief Namespace for \f$\mathbf I\f$-series Artin groups, dual Garside
@@ -121,6 +125,15 @@ class Underlying {
      */
     i16 lattice_height() const { return 2; }
 
+    /**
+     * @brief Gets the factor's vertex.
+     *
+     * It is only meaningful if the factor is a reflection.
+     *
+     * @return The factor's vertex.
+     */
+    inline i16 get_vertex() const { return vertex; }
+
     /**
      * @brief Construct a new `Underlying`.
      *
@@ -273,8 +286,103 @@ class Underlying {
      */
     Underlying right_complement(const Underlying &b) const;
 
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Constant time.
+     *
+     * @return If `*this` is the identity.
+     */
+    inline bool is_identity() const { return type == 0; }
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Constant time.
+     *
+     * @return If `*this` is \f$\Delta\f$.
+     */
+    inline bool is_delta() const { return type == 1; }
+
+    /**
+     * @brief Computes the left complement of `*this` under the Garside element.
+     *
+     * Constant time.
+     *
+     * @return The left complement of `*this` to \f$\Delta\f$.
+     */
+    inline Underlying left_complement() const {
+        Underlying f = *this;
+        if (type == 2) {
+            f.vertex = (vertex == number_of_vertices - 1) ? 0 : vertex + 1;
+        } else {
+            f.type = 1 - type;
+        }
+        return f;
+    }
+
+    /**
+     * @brief Computes the right complement of `*this` under the Garside
+     * element.
+     *
+     * Constant time.
+     *
+     * @return The right complement of `*this` to \f$\Delta\f$.
+     */
+    inline Underlying right_complement() const {
+        Underlying f = *this;
+        if (type == 2) {
+            f.vertex = (vertex == 0) ? number_of_vertices - 1 : vertex - 1;
+        } else {
+            f.type = 1 - type;
+        }
+        return f;
+    }
+
+    /**
+     * @brief Checks if the meet of `*this` and `b` is the identity.
+     *
+     * Constant time.
+     *
+     * @param b Second operand.
+     * @return If the meet of `*this` and `b` is the identity.
+     */
+    inline bool left_meet_is_identity(const Underlying &b) const {
+        return (type == 0) || (b.type == 0) ||
+               ((type == 2) && (b.type == 2) && (vertex != b.vertex));
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom (the reflection through vertex `k`)
+     * left-divides `*this`.
+     *
+     * That is to say, if `*this` is \f$\Delta\f$ or that reflection.
+     * Constant time.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom left-divides `*this`.
+     */
+    inline bool is_left_divisible_by_atom(size_t k) const {
+        return (type == 1) || ((type == 2) && (vertex == i16(k)));
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom right-divides `*this`.
+     *
+     * Reflections left-divide a factor if and only if they right-divide it:
+     * see `is_left_divisible_by_atom`.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom right-divides `*this`.
+     */
+    inline bool is_right_divisible_by_atom(size_t k) const {
+        return is_left_divisible_by_atom(k);
+    }
+
     /**
      * @brief Sets `*this` to a random factor.
+     *
+     * Thread-safe, as it draws from `random_engine()`.
      */
     void randomize();
 
@@ -304,6 +412,43 @@ class Underlying {
      * @return The hash. 
      */
     inline std::size_t hash() const { return (size_t)vertex; }
+
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return `4`.
+     */
+    inline size_t packed_size() const { return 4; }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is `type`, then `vertex` (or `0`, if `type` is not `2`), as 16-bit
+     * little-endian integers.
+     *
+     * Constant time.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    inline void pack(u8 *out) const {
+        pack_u16(out, u16(type));
+        pack_u16(out + 2, u16((type == 2) ? vertex : 0));
+    }
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * Constant time.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    inline bool unpack(const u8 *in) {
+        type = i16(unpack_u16(in));
+        vertex = i16(unpack_u16(in + 2));
+        return (type == 2) ? (vertex < number_of_vertices)
+                           : ((type <= 1) && (vertex == 0));
+    }
 };
 
 /**
@@ -317,4 +462,382 @@ using Factor = FactorTemplate<Underlying>;
  */
 using Braid = BraidTemplate<Factor>;
 
-} // namespace garcide::dihedral
\ No newline at end of file
+/**
+ * @brief A class for dual Garside structure \f$\mathbf I\f$-series Artin
+ * groups elements, that does not store factors one by one.
+ *
+ * Non-\f$\Delta\f$ factors in a left normal form are all reflections, and
+ * the normal form of \f$\Delta^p s_{v_1} \cdots s_{v_l}\f$ is characterized
+ * by the fact that \f$v_i - v_{i + 1} \neq 1\f$ (modulo the parameter) for
+ * all \f$i\f$. As a result, products, inverses, conjugacy and summit sets can
+ * be computed with index arithmetic.
+ *
+ * The sequence of vertices is stored as a sequence of arithmetic progressions
+ * (that is stable under inversion), together with a global offset (so that
+ * conjugation by a power of \f$\Delta\f$, that shifts all vertices, is
+ * constant time).
+ *
+ * Results are the same as for `Braid`, and the two can be converted into one
+ * another. Unless stated otherwise, operations are linear in the number of
+ * progressions, rather than in the canonical length.
+ */
+class CompactBraid {
+  public:
+    /**
+     * @brief Parameter type.
+     */
+    using Parameter = Underlying::Parameter;
+
+  private:
+    /**
+     * @brief An arithmetic progression of vertices.
+     *
+     * It represents vertices `start + offset + k * step` (modulo the
+     * parameter), for `k` in \f$[0, \texttt{count}[\f$.
+     */
+    struct Progression {
+        i16 start;
+        i16 step;
+        i32 count;
+    };
+
+    /**
+     * @brief The number of vertices.
+     */
+    Parameter number_of_vertices;
+
+    /**
+     * @brief The power of \f$\Delta\f$.
+     */
+    i32 delta;
+
+    /**
+     * @brief Offset that is added to all vertices.
+     */
+    i16 offset;
+
+    /**
+     * @brief The canonical length.
+     */
+    i32 length;
+
+    /**
+     * @brief The vertices of the reflections in the normal form.
+     */
+    std::deque<Progression> progressions;
+
+    // Reduces v modulo the parameter.
+    i16 reduce(i64 v) const;
+
+    // Pushes count reflections at the end, with vertices in progression from
+    // v with step step, without normalization.
+    void push_back(i16 v, i16 step, i32 count);
+
+    // Removes the last count factors.
+    void pop_back(i32 count);
+
+  public:
+    /**
+     * @brief Construct a new `CompactBraid`, with a group parameter.
+     *
+     * It is initialized as the identity.
+     *
+     * @param n Group parameter.
+     */
+    CompactBraid(Parameter n);
+
+    /**
+     * @brief Construct a new `CompactBraid`, from a braid in LCF.
+     *
+     * Linear in the canonical length.
+     *
+     * @param b The braid to be converted.
+     */
+    CompactBraid(const Braid &b);
+
+    /**
+     * @brief Converts to a `Braid`, in LCF.
+     *
+     * Linear in the canonical length.
+     *
+     * @return The corresponding `Braid`.
+     */
+    Braid to_braid() const;
+
+    /**
+     * @brief Returns the `Parameter` of the braid.
+     *
+     * @return The `Parameter` of the braid.
+     */
+    inline Parameter get_parameter() const { return number_of_vertices; }
+
+    /**
+     * @brief Returns the infimum.
+     *
+     * @return The infimum.
+     */
+    inline i32 inf() const { return delta; }
+
+    /**
+     * @brief Returns the supremum.
+     *
+     * @return The supremum.
+     */
+    inline i32 sup() const { return delta + length; }
+
+    /**
+     * @brief Returns the canonical length.
+     *
+     * @return The canonical length.
+     */
+    inline i32 canonical_length() const { return length; }
+
+    /**
+     * @brief Returns the vertex of the `i`-th factor.
+     *
+     * Linear in the number of progressions.
+     *
+     * @param i An index in \f$[0, l[\f$, where \f$l\f$ is the canonical
+     * length.
+     * @return The vertex of the `i`-th (non-\f$\Delta\f$) factor.
+     */
+    i16 vertex_at(i32 i) const;
+
+    /**
+     * @brief Returns the vertices of the factors.
+     *
+     * Linear in the canonical length.
+     *
+     * @return The vertices of the (non-\f$\Delta\f$) factors, in order.
+     */
+    std::vector<i16> vertices() const;
+
+    /**
+     * @brief Returns the vertex of the initial factor.
+     *
+     * That is, of the first factor conjugated by `-inf()`. The canonical
+     * length must be non-zero. Constant time.
+     *
+     * @return The vertex of the initial factor.
+     */
+    i16 initial_vertex() const;
+
+    /**
+     * @brief Returns the vertex of the final factor.
+     *
+     * The canonical length must be non-zero. Constant time.
+     *
+     * @return The vertex of the final factor.
+     */
+    i16 final_vertex() const;
+
+    /**
+     * @brief Sets the infimum.
+     *
+     * _I.e._ left-multiplies by the `(delta - inf())`-th power of the Garside
+     * element.
+     *
+     * @param delta The new infimum.
+     */
+    inline void set_delta(i32 delta) { (*this).delta = delta; }
+
+    /**
+     * @brief Equality check.
+     *
+     * @param b Second operand.
+     * @return If `*this` and `b` are equal.
+     */
+    bool compare(const CompactBraid &b) const;
+
+    /**
+     * @brief Equality check.
+     *
+     * Syntactic sugar for `compare()`.
+     *
+     * @param b Second operand.
+     * @return If `*this` and `b` are equal.
+     */
+    inline bool operator==(const CompactBraid &b) const { return compare(b); }
+
+    /**
+     * @brief Unequality check.
+     *
+     * @param b Second operand.
+     * @return If `*this` and `b` are not equal.
+     */
+    inline bool operator!=(const CompactBraid &b) const { return !compare(b); }
+
+    /**
+     * @brief Right-multiplies by a reflection.
+     *
+     * Constant time.
+     *
+     * @param v The vertex of the reflection.
+     */
+    void right_multiply_reflection(i16 v);
+
+    /**
+     * @brief Right-multiplies by a braid.
+     *
+     * Linear in the number of progressions of both operands.
+     *
+     * @param b Second operand.
+     */
+    void right_multiply(const CompactBraid &b);
+
+    /**
+     * @brief Computes the product of two braids.
+     *
+     * @param b Second (right) operand.
+     * @return The product of `*this` and `b`.
+     */
+    CompactBraid operator*(const CompactBraid &b) const;
+
+    /**
+     * @brief Computes the inverse of the braid.
+     *
+     * @return The inverse of `*this`.
+     */
+    CompactBraid inverse() const;
+
+    /**
+     * @brief Computes the inverse of the braid.
+     *
+     * Syntactic sugar for `inverse()`.
+     *
+     * @return The inverse of `*this`.
+     */
+    inline CompactBraid operator!() const { return inverse(); }
+
+    /**
+     * @brief Conjugates by a power of \f$\Delta\f$.
+     *
+     * Constant time.
+     *
+     * @param k The exponent.
+     */
+    void delta_conjugate_mut(i32 k);
+
+    /**
+     * @brief Conjugates by a braid.
+     *
+     * _I.e._ sets `*this` to `!c * *this * c`.
+     *
+     * @param c The conjugating braid.
+     */
+    void conjugate(const CompactBraid &c);
+
+    /**
+     * @brief Cycles the braid.
+     *
+     * That is to say, conjugates it by its initial factor. Constant time.
+     */
+    void cycling();
+
+    /**
+     * @brief Prints `*this` to `os`.
+     *
+     * The format is the same as for `Braid`.
+     *
+     * @param os The output stream it prints to.
+     */
+    void print(IndentedOStream &os = ind_cout) const;
+
+    /**
+     * @brief Hashes the braid.
+     *
+     * All the factors are hashed, through the maximal progressions of the
+     * normal form (so that braids that are equal have the same hash, however
+     * their progressions are cut).
+     *
+     * Linear in the number of progressions.
+     *
+     * @return The hash.
+     */
+    std::size_t hash() const;
+};
+
+/**
+ * @brief Inserts a `CompactBraid` in the output stream.
+ *
+ * @param os The output stream.
+ * @param b The braid to be inserted.
+ * @return A reference to `os`, so that `<<` may be chained.
+ */
+inline IndentedOStream &operator<<(IndentedOStream &os, const CompactBraid &b) {
+    b.print(os);
+    return os;
+}
+
+/**
+ * @brief Computes a super summit conjugate of `b`, with a conjugator.
+ *
+ * As the lattice has height 2, a braid is in its super summit set if and only
+ * if cycling does not create a \f$\Delta\f$ between its last factor and its
+ * initial factor. Thus, only cyclings are needed. Linear in the canonical
+ * length.
+ *
+ * @param b The braid of whom a super summit conjugate is computed.
+ * @param c A braid that is set by the function to a conjugator sending `b` to
+ * what is returned.
+ * @return A super summit conjugate of `b`.
+ */
+CompactBraid send_to_super_summit(const CompactBraid &b, CompactBraid &c);
+
+/**
+ * @brief Computes the super summit set of `b`.
+ *
+ * If it has non-zero canonical length, a super summit element is rigid, and
+ * its super summit set (which is then also its ultra summit set and its
+ * sliding circuits set) consists of the conjugates of its cyclings by powers of
+ * \f$\Delta\f$.
+ *
+ * @param b The braid whose super summit set is computed.
+ * @return The super summit set of `b`.
+ */
+std::vector<CompactBraid> super_summit_set(const CompactBraid &b);
+
+/**
+ * @brief Checks if two braids are conjugates, and computes a conjugator.
+ *
+ * `c` is not modified if `b1` and `b2` are not conjugates.
+ *
+ * Super summit conjugates are compared up to cycling and conjugation by powers
+ * of \f$\Delta\f$, by looking for one's sequence of differences between
+ * successive vertices among the rotations of the other's. Linear in the
+ * canonical length.
+ *
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param c A braid, that is set by the function to the conjugator that takes
+ * `b1` to `b2`, if it exists.
+ * @return If `b1` and `b2` are conjugates.
+ */
+bool are_conjugate(const CompactBraid &b1, const CompactBraid &b2,
+                   CompactBraid &c);
+
+} // namespace garcide::dihedral
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(extern, dihedral::Underlying)
+
+} // namespace garcide
+
+/**
+ * @brief Hash `struct` for `garcide::dihedral::CompactBraid`.
+ */
+template <> struct std::hash<garcide::dihedral::CompactBraid> {
+    /**
+     * @brief Hash operator.
+     *
+     * @param b the braid to be hashed.
+     * @return The hash.
+     */
+    std::size_t
+    operator()(garcide::dihedral::CompactBraid const &b) const noexcept {
+        return b.hash();
+    }
+};
+
+#endif
@@ -28,7 +28,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "garcide/garcide.hpp"
+#include "garcide/instantiation.hpp"
 
 namespace garcide {
 
@@ -147,6 +147,18 @@ class Underlying {
      */
     Parameter een_index;
 
+    /**
+     * @brief The induced permutation and the multiplicating coefficients.
+     *
+     * Both tables have length \f$n + 1\f$. They are stored interleaved in a
+     * single vector (the `i`-th entry of the permutation table at `2 * i`, and
+     * the one of the coefficient table at `2 * i + 1`), so that a factor only
+     * needs one allocation, and that products read both tables in a single
+     * pass. They are accessed through `permutation_table` and
+     * `coefficient_table`.
+     */
+    ResourceVector<i16> tables;
+
     /**
      * @brief The induced permutation.
      *
@@ -160,8 +172,19 @@ class Underlying {
      * zero. Thus, in the inverse table, the integer \f$k\f$ at the
      * \f$f\f$-position is the one such that the coefficient at \f$(i,k)\f$ is
      * non zero.
+     *
+     * @param i An index in \f$[\![0, n]\!]\f$.
+     * @return A reference to the `i`-th entry of the table.
      */
-    std::vector<i16> permutation_table;
+    inline i16 &permutation_table(i16 i) { return tables[2 * i]; }
+
+    /**
+     * @brief The induced permutation (read-only).
+     *
+     * @param i An index in \f$[\![0, n]\!]\f$.
+     * @return The `i`-th entry of the table.
+     */
+    inline i16 permutation_table(i16 i) const { return tables[2 * i]; }
 
     /**
      * @brief The multiplicating coefficients.
@@ -171,41 +194,24 @@ class Underlying {
      * represented by integer ranging between \f$0\f$ and \f$e - 1\f$, with
      * \f$i\f$ standing for \f$\zeta_e^i\f$.
      *
-     * `coefficient_table` is the diagonal coefficient matrix, when writing the
-     * matrix as a profuct of a diagonal matrix on the left and a permutation
-     * matrix on the right.
-     */
-    std::vector<i16> coefficient_table;
-
-  public:
-    /**
-     * @brief Maximum value for the \f$n\f$ index.
-     *
-     * The greatest \f$n\f$ value that may be used for factors.
-     *
-     * It is used because we use `thread_local` objects to avoid some
-     * allocations, and their size must be known at compile time.
+     * The coefficient table is the diagonal coefficient matrix, when writing
+     * the matrix as a profuct of a diagonal matrix on the left and a
+     * permutation matrix on the right.
      *
-     * Having too big `thread_local` objects might cause some issue with thread
-     * spawning.
+     * @param i An index in \f$[\![0, n]\!]\f$.
+     * @return A reference to the `i`-th entry of the table.
      */
-    static const i16 MAX_N_PARAMETER = 256;
+    inline i16 &coefficient_table(i16 i) { return tables[2 * i + 1]; }
 
     /**
-     * @brief Maximum value for the \f$e\f$ index.
+     * @brief The multiplicating coefficients (read-only).
      *
-     * Not exactly. This is not a strict bound on \f$e\f$. Rather, the
-     * real condition is \f$en\f$ should be at most MAX_E_PARAMETER *
-     * MAX_N_PARAMETER`.
-     *
-     * It is used because we use `thread_local` objects to avoid some
-     * allocations, and their size must be known at compile time.
-     *
-     * Having too big `thread_local` objects might cause some issue with thread
-     * spawning.
+     * @param i An index in \f$[\![0, n]\!]\f$.
+     * @return The `i`-th entry of the table.
      */
-    static const i16 MAX_E_PARAMETER = 1;
+    inline i16 coefficient_table(i16 i) const { return tables[2 * i + 1]; }
 
+  public:
     /**
      * @brief Converts a string to a parameter.
      *
@@ -308,8 +314,8 @@ class Underlying {
     /**
      * @brief Prints internal representation in `os`.
      *
-     * Prints private members `een_index`, `permutation_table` and
-     * `coefficient_table`, typically for debugging.
+     * Prints private members `een_index` and `tables` (as the permutation and
+     * coefficient tables), typically for debugging.
      *
      * @param os The output stream it is printed in.
      */
@@ -394,8 +400,11 @@ class Underlying {
      *
      * For the dual structure, the left and right meets are equal.
      *
-     * Runs in \f$\mathrm O(en)\f$ time, although it uses a `thread_local`
-     * square matrix of dimension `MAX_N_PARAMETER * MAX_E_PARAMETER + 1`.
+     * Runs in \f$\mathrm O(en)\f$ time: the cells of the meet are obtained
+     * by sorting indexes along the cells of the first partition (a counting
+     * sort), then splitting each of them along the cells of the second one.
+     * Scratch space is `thread_local` (so that threads do not share it), and
+     * only grows when larger parameters are met.
      *
      * @param b Second operand.
      * @return The meet of `*this` and `b`.
@@ -410,8 +419,11 @@ class Underlying {
      *
      * For the dual structure, the left and right meets are equal.
      *
-     * Runs in \f$\mathrm O(en)\f$ time, although it uses a `thread_local`
-     * square matrix of dimension `MAX_N_PARAMETER * MAX_E_PARAMETER + 1`.
+     * Runs in \f$\mathrm O(en)\f$ time: the cells of the meet are obtained
+     * by sorting indexes along the cells of the first partition (a counting
+     * sort), then splitting each of them along the cells of the second one.
+     * Scratch space is `thread_local` (so that threads do not share it), and
+     * only grows when larger parameters are met.
      *
      * @param b Second operand.
      * @return The meet of `*this` and `b`.
@@ -432,8 +444,7 @@ class Underlying {
      * @return If `*this` and `b` are equal.
      */
     inline bool compare(const Underlying &b) const {
-        return (permutation_table == b.permutation_table) &&
-               (coefficient_table == b.coefficient_table);
+        return tables == b.tables;
     }
 
     /**
@@ -475,6 +486,56 @@ class Underlying {
      */
     Underlying right_complement(const Underlying &b) const;
 
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return If `*this` is the identity.
+     */
+    bool is_identity() const;
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return If `*this` is \f$\Delta\f$.
+     */
+    bool is_delta() const;
+
+    /**
+     * @brief Computes the left complement of `*this` under the Garside element.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return The left complement of `*this` to \f$\Delta\f$.
+     */
+    Underlying left_complement() const;
+
+    /**
+     * @brief Computes the right complement of `*this` under the Garside
+     * element.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return The right complement of `*this` to \f$\Delta\f$.
+     */
+    Underlying right_complement() const;
+
+    /**
+     * @brief Checks if the meet of `*this` and `b` is the identity.
+     *
+     * That is to say, if the partition of their meet is discrete. This skips
+     * building the meet from its partition.
+     *
+     * Runs in \f$\mathrm O(en)\f$ time.
+     *
+     * @param b Second operand.
+     * @return If the meet of `*this` and `b` is the identity.
+     */
+    bool left_meet_is_identity(const Underlying &b) const;
+
     /**
      * @brief Sets `*this` to a random factor.
      *
@@ -516,6 +577,42 @@ class Underlying {
      */
     std::size_t hash() const;
 
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return \f$4(n+1)\f$.
+     */
+    inline size_t packed_size() const {
+        return 4 * (size_t(get_parameter().n) + 1);
+    }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is, for each index from \f$0\f$ to \f$n\f$, its entry in the
+     * permutation table then its entry in the coefficient table (that is,
+     * `tables`), as 16-bit little-endian integers.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    void pack(u8 *out) const;
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * The tables must describe an element of \f$\mathrm G(e,e,n+1)\f$, that
+     * `of_partition()` builds from a non-crossing partition (in the sense of
+     * Bessis and Corran). For \f$e=2\f$, only the tables are checked, as
+     * `of_partition()` does not give back all the factors from their
+     * partitions. Linear in \f$en\f$.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    bool unpack(const u8 *in);
+
   private:
     /**
      * @brief Computes the factor associated to the inverse of the matrix
@@ -527,6 +624,18 @@ class Underlying {
      * `*this`.
      */
     Underlying inverse() const;
+
+    /**
+     * @brief Computes the partition associated with the meet of `*this` and
+     * `b`.
+     *
+     * Runs in \f$\mathrm O(en)\f$ time.
+     *
+     * @param b Second operand.
+     * @return A `thread_local` array holding the partition, that is
+     * overwritten by the next call.
+     */
+    const i16 *meet_partition(const Underlying &b) const;
 };
 
 /**
@@ -543,6 +652,8 @@ using Braid = BraidTemplate<Factor>;
 
 } // namespace dual_complex
 
+GARCIDE_INSTANTIATE(extern, dual_complex::Underlying)
+
 /**
  * @brief Inserts a parameter in the output stream.
  *
@@ -30,7 +30,7 @@
 #ifndef EUCLIDEAN_LATTICE
 #define EUCLIDEAN_LATTICE
 
-#include "garcide/garcide.hpp"
+#include "garcide/instantiation.hpp"
 
 /**
  * @brief Namespace for euclidian lattices \f$\mathbb Z^n\f$.
@@ -55,16 +55,36 @@ class Underlying {
      */
     using Parameter = size_t;
 
+    /**
+     * @brief Number of coordinates packed in a word.
+     */
+    static const size_t WORD_SIZE = 64;
+
   private:
+    /**
+     * @brief The factor's dimension.
+     */
+    Parameter dimension;
+
     /**
      * @brief The factor's coordinates.
      *
      * These are its coordinates in the canonical basis of \f$\mathbb Z^n\f$.
-     * As these are all \f$0\f$ or \f$1\f$, we use booleans, as (depending on
-     * implementation) it should be more space efficient (one bit vers one
-     * byte).
+     * As these are all \f$0\f$ or \f$1\f$, they are packed as bits in
+     * 64-bit words, coordinate `i` being bit `i % WORD_SIZE` of word
+     * `i / WORD_SIZE`. Bits past the dimension in the last word are always
+     * `0`, so that operations may work on whole words.
      */
-    std::vector<bool> coordinates;
+    ResourceVector<u64> coordinates;
+
+    /**
+     * @brief Sets the bits past the dimension in the last word to `0`.
+     */
+    inline void mask_last_word() {
+        if (dimension % WORD_SIZE != 0) {
+            coordinates.back() &= (u64(1) << (dimension % WORD_SIZE)) - 1;
+        }
+    }
 
   public:
     /**
@@ -95,13 +115,28 @@ class Underlying {
      * @param i The index that is being accessed.
      * @return The `i`-th coordinate.
      */
-    inline bool at(size_t i) const { return coordinates[i]; }
+    inline bool at(size_t i) const {
+        return (coordinates[i / WORD_SIZE] >> (i % WORD_SIZE)) & 1;
+    }
+
+    /**
+     * @brief Sets i-th coordinate.
+     *
+     * @param i The index that is being set.
+     * @param c The value it is set to.
+     */
+    inline void set_at(size_t i, bool c) {
+        if (c) {
+            coordinates[i / WORD_SIZE] |= u64(1) << (i % WORD_SIZE);
+        } else {
+            coordinates[i / WORD_SIZE] &= ~(u64(1) << (i % WORD_SIZE));
+        }
+    }
 
     /**
      * @brief Construct a new `Underlying`.
      *
-     * Its dimension will be `n`, and it will be initialized as a `n`-length
-     * vector filled with `false`.
+     * Its dimension will be `n`, and it will be initialized as the identity.
      *
      * @param n The dimension.
      */
@@ -143,6 +178,19 @@ class Underlying {
      */
     inline i16 lattice_height() const { return int(get_parameter()); }
 
+    /**
+     * @brief Length of the factor.
+     *
+     * (_I.e._ its length as a word in the base vectors, which is its number of
+     * non-zero coordinates.)
+     *
+     * Linear in the dimension, with a small constant (one popcount per 64
+     * coordinates).
+     *
+     * @return The length of the factor.
+     */
+    size_t length() const;
+
     /**
      * @brief Prints internal data in `os`.
      *
@@ -220,7 +268,7 @@ class Underlying {
      * @return If `*this` and `b` are equal.
      */
     inline bool compare(const Underlying &b) const {
-        return coordinates == b.coordinates;
+        return dimension == b.dimension && coordinates == b.coordinates;
     };
 
     /**
@@ -274,10 +322,89 @@ class Underlying {
         return product(b);
     };
 
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Linear in the dimension.
+     *
+     * @return If `*this` is the identity.
+     */
+    bool is_identity() const;
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Linear in the dimension.
+     *
+     * @return If `*this` is \f$\Delta\f$.
+     */
+    bool is_delta() const;
+
+    /**
+     * @brief Complement computations.
+     *
+     * Computes the complement of `*this` to \f$\Delta\f$ (_i.e._ flips all
+     * coordinates). Left and right variants are the same.
+     *
+     * Linear in the dimension.
+     *
+     * @return The complement of `*this` to \f$\Delta\f$.
+     */
+    Underlying left_complement() const;
+
+    /**
+     * @brief Complement computations.
+     *
+     * Computes the complement of `*this` to \f$\Delta\f$ (_i.e._ flips all
+     * coordinates). Left and right variants are the same.
+     *
+     * Linear in the dimension.
+     *
+     * @return The complement of `*this` to \f$\Delta\f$.
+     */
+    inline Underlying right_complement() const { return left_complement(); }
+
+    /**
+     * @brief Checks if the meet of `*this` and `b` is the identity.
+     *
+     * (_I.e._ if no coordinate is set in both.)
+     *
+     * Linear in the dimension.
+     *
+     * @param b Second operand.
+     * @return If the meet of `*this` and `b` is the identity.
+     */
+    bool left_meet_is_identity(const Underlying &b) const;
+
+    /**
+     * @brief Checks if the `k`-th atom left-divides `*this`.
+     *
+     * That is to say, if coordinate `k` is set. Constant time.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom left-divides `*this`.
+     */
+    inline bool is_left_divisible_by_atom(size_t k) const {
+        return coordinates[k / WORD_SIZE] >> (k % WORD_SIZE) & 1;
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom right-divides `*this`.
+     *
+     * The monoid is commutative: see `is_left_divisible_by_atom`.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom right-divides `*this`.
+     */
+    inline bool is_right_divisible_by_atom(size_t k) const {
+        return is_left_divisible_by_atom(k);
+    }
+
     /**
      * @brief Sets `*this` to a random factor.
      *
-     * It is chosen uniformly other \f$(\mathbb Z/2\mathbb Z)^n\f$.
+     * It is chosen uniformly other \f$(\mathbb Z/2\mathbb Z)^n\f$, with
+     * draws from `random_engine()` (so that it is thread-safe).
      *
      * Linear in the dimension.
      */
@@ -306,15 +433,45 @@ class Underlying {
     /**
      * @brief Hashes the factor.
      *
-     * Done by interpreting it as a polynomial and evaluating
-     * it in \f$2\f$ (yields a bijection between the set of factors and \f$[0,
-     * 2 ^ n[\f$).
+     * Done by interpreting its words as the coefficients of a polynomial and
+     * evaluating it in \f$31\f$ (for \f$n \leq 64\f$, this yields a
+     * bijection between the set of factors and \f$[0, 2 ^ n[\f$).
      *
      * Linear in the dimension.
      *
      * @return The hash.
      */
     size_t hash() const;
+
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return \f$\lceil n/8\rceil\f$.
+     */
+    inline size_t packed_size() const { return (get_parameter() + 7) / 8; }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is its coordinates, as bits: coordinate `i` is bit `i % 8` of byte
+     * `i / 8`.
+     *
+     * Linear in the dimension.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    void pack(u8 *out) const;
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * Bits past the dimension in the last byte must be `0`. Linear in the
+     * dimension.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    bool unpack(const u8 *in);
 };
 
 /**
@@ -327,6 +484,44 @@ using Factor = FactorTemplate<Underlying>;
  */
 using Braid = BraidTemplate<Factor>;
 
+/**
+ * @brief Computes the coordinates of a braid.
+ *
+ * As \f$\mathbb Z^n\f$ is abelian, the `i`-th coordinate is the infimum,
+ * plus the number of factors whose `i`-th coordinate is non-zero.
+ *
+ * Linear in the dimension times the canonical length.
+ *
+ * @param b A braid in LCF.
+ * @return The coordinates of `b` in the canonical basis.
+ */
+std::vector<i32> exponents(const Braid &b);
+
+/**
+ * @brief Builds the braid with given coordinates.
+ *
+ * As \f$\mathbb Z^n\f$ is abelian, the normal form is computed directly:
+ * the infimum is the smallest coordinate \f$m\f$, and the `k`-th factor has
+ * non-zero `i`-th coordinate if and only if `exponents[i] - m >= k`. The
+ * factors are appended as they are (see `push_back_left_weighted`), so that
+ * no meet is computed.
+ *
+ * \f$\mathrm O(n \log n + n\ell)\f$ time, where \f$n\f$ is the dimension and
+ * \f$\ell\f$ the canonical length.
+ *
+ * The dimension is the size of `exponents`, that should not be empty.
+ *
+ * @param exponents The coordinates of the braid in the canonical basis.
+ * @return The braid with coordinates `exponents`, in LCF.
+ */
+Braid braid_of_exponents(const std::vector<i32> &exponents);
+
 } // namespace garcide::euclidean_lattice
 
+namespace garcide {
+
+GARCIDE_INSTANTIATE(extern, euclidean_lattice::Underlying)
+
+} // namespace garcide
+
 #endif
\ No newline at end of file
@@ -31,7 +31,7 @@
 #ifndef OCTAHEDRAL
 #define OCTAHEDRAL
 
-#include "garcide/garcide.hpp"
+#include "garcide/instantiation.hpp"
 
 /**
  * @brief Namespace for \f$\mathbf B\f$-series Artin groups, dual Garside
@@ -43,8 +43,10 @@ namespace garcide::octahedral {
  * @brief A class for dual Garside structure \f$\mathbf B\f$-series Artin groups
  * canonical factors.
  *
- * They are represented by permutations (of \f$[\![1,2n]\!]\f$), stored as
- * inverse permutation tables.
+ * They are represented by permutations (of \f$[\![1,2n]\!]\f$), that commute
+ * with \f$i\mapsto i+n\f$ (mod \f$2n\f$). Only the first half of their
+ * inverse permutation table is stored, the second one being deduced by
+ * symmetry.
  *
  * To a factor one can also associate a partition of \f$[\![1,2n]\!]\f$, where
  * \f$n\f$ is the number of strands. These are represented by integer arrays,
@@ -71,24 +73,43 @@ class Underlying {
      * such that
      * \f$\forall i\in[\![1,2n]\!],\mathrm T_\sigma\f[\sigma(i)]=i\f$.
      *
+     * As \f$\sigma\f$ is centrally symmetric (\f$\sigma(i+n)\equiv
+     * \sigma(i)+n\ [2n]\f$), only \f$\mathrm T_\sigma[i]\f$ for
+     * \f$i\in[\![1,n]\!]\f$ is stored. Use `at()` to read the whole table.
+     *
      * Indexes start at \f$1\f$.
      */
-    std::vector<i16> permutation_table;
+    ResourceVector<i16> permutation_table;
 
-  public:
     /**
-     * @brief Maximum group parameter.
+     * @brief Opposite of a point.
      *
-     * The greatest group parameter (_i.e._, the \f$n\f$ in \f$\mathrm
-     * A_n(\mathbf B)\f$) that may be used for factors.
+     * @param i A point in \f$[\![1,2n]\!]\f$.
+     * @return \f$i+n\f$, mod \f$2n\f$, in \f$[\![1,2n]\!]\f$.
+     */
+    inline i16 opposite(i16 i) const {
+        return (i <= get_parameter()) ? i + get_parameter()
+                                      : i - get_parameter();
+    }
+
+    /**
+     * @brief Sets the `i`-th element of the (full) permutation table.
      *
-     * It is used because we use `thread_local` objects to avoid some
-     * allocations, and their size must be known at compile time.
+     * As the table is centrally symmetric, this also sets the element at the
+     * opposite of `i` to the opposite of `j`.
      *
-     * Having too big `thread_local` objects might cause some issue with thread
-     * spawning.
+     * @param i The index that is being set, in \f$[\![1,2n]\!]\f$.
+     * @param j Its new value, in \f$[\![1,2n]\!]\f$.
      */
-    static const i16 MAX_PARAMETER = 256;
+    inline void set_at(i16 i, i16 j) {
+        if (i <= get_parameter()) {
+            permutation_table[i] = j;
+        } else {
+            permutation_table[i - get_parameter()] = opposite(j);
+        }
+    }
+
+  public:
 
     /**
      * @brief Converts a string to a parameter.
@@ -110,7 +131,7 @@ class Underlying {
      *
      * @return The group parameter.
      */
-    inline i16 get_parameter() const { return permutation_table.size() / 2; }
+    inline i16 get_parameter() const { return permutation_table.size() - 1; }
 
     /**
      * @brief Height of the lattice.
@@ -129,24 +150,29 @@ class Underlying {
      * Construct a new `Underlying`, with `n` as its
      * parameter.
      *
-     * Its permutation table will have length `2 * n`, and will be filled with
-     * zeros (thus this is not a valid factor). It should be initialized it with
-     * `identity()`, `delta()`, or another similar member.
+     * Its (stored half of the) permutation table will have length `n`, and
+     * will be filled with zeros (thus this is not a valid factor). It should be
+     * initialized it with `identity()`, `delta()`, or another similar member.
      *
-     * @param n The parameter of the factor (also the length of
-     * its permutation table, divided by \f$2\f$).
+     * @param n The parameter of the factor (also the length of the stored
+     * half of its permutation table).
      */
     Underlying(i16 n);
 
     /**
      * @brief Access the `i`-th element of the permutation table (read-only).
      *
-     * `i` should be between `1` and the number of strands.
+     * `i` should be between `1` and twice the number of strands. The second
+     * half of the table is deduced from the first one by symmetry.
      *
      * @param i The index that is being accessed.
      * @return The `i`-th element of the permutation table.
      */
-    inline i16 at(size_t i) const { return permutation_table[i]; }
+    inline i16 at(size_t i) const {
+        return (i16(i) <= get_parameter())
+                   ? permutation_table[i]
+                   : opposite(permutation_table[i - get_parameter()]);
+    }
 
     /**
      * @brief Extraction from string.
@@ -193,7 +219,8 @@ class Underlying {
     /**
      * @brief Prints internal representation in `os`.
      *
-     * Prints private member `permutation_table`, typically for debugging.
+     * Prints private member `permutation_table` (that is, the first half of
+     * the permutation table), typically for debugging.
      *
      * @param os The output stream it is printed in.
      */
@@ -269,8 +296,10 @@ class Underlying {
      *
      * For the dual structure, the left and right meets are equal.
      *
-     * Linear in the parameter, although it uses a `thread_local` square
-     * matrix of dimension `2 * MAX_PARAMETER + 1`.
+     * Linear in the parameter: the cycles of `*this` are walked, and split
+     * along the cells of the partition of `b`. Scratch space is
+     * `thread_local` (so that threads do not share it), linear in the
+     * parameter, and only grows when larger parameters are met.
      *
      * @param b Second operand.
      * @return The meet of `*this` and `b`.
@@ -285,8 +314,10 @@ class Underlying {
      *
      * For the dual structure, the left and right meets are equal.
      *
-     * Linear in the parameter, although it uses a `thread_local` square
-     * matrix of dimension `2 * MAX_PARAMETER + 1`.
+     * Linear in the parameter: the cycles of `*this` are walked, and split
+     * along the cells of the partition of `b`. Scratch space is
+     * `thread_local` (so that threads do not share it), linear in the
+     * parameter, and only grows when larger parameters are met.
      *
      * @param b Second operand.
      * @return The meet of `*this` and `b`.
@@ -349,6 +380,83 @@ class Underlying {
      */
     Underlying right_complement(const Underlying &b) const;
 
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Linear in the group parameter.
+     *
+     * @return If `*this` is the identity.
+     */
+    bool is_identity() const;
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Linear in the group parameter.
+     *
+     * @return If `*this` is \f$\Delta\f$.
+     */
+    bool is_delta() const;
+
+    /**
+     * @brief Computes the left complement of `*this` under the Garside element.
+     *
+     * Linear in the group parameter.
+     *
+     * @return The left complement of `*this` to \f$\Delta\f$.
+     */
+    Underlying left_complement() const;
+
+    /**
+     * @brief Computes the right complement of `*this` under the Garside
+     * element.
+     *
+     * Linear in the group parameter.
+     *
+     * @return The right complement of `*this` to \f$\Delta\f$.
+     */
+    Underlying right_complement() const;
+
+    /**
+     * @brief Checks if the meet of `*this` and `b` is the identity.
+     *
+     * That is to say, if no two points lie in the same cell of both
+     * partitions.
+     *
+     * Linear in the group parameter.
+     *
+     * @param b Second operand.
+     * @return If the meet of `*this` and `b` is the identity.
+     */
+    bool left_meet_is_identity(const Underlying &b) const;
+
+    /**
+     * @brief Checks if the `k`-th atom left-divides `*this`.
+     *
+     * That is to say, if the two points the atom sends to each other (and
+     * their opposites) lie in the same cell of the partition, which is
+     * checked by walking along the cycle of one of them.
+     *
+     * Linear in the group parameter.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom left-divides `*this`.
+     */
+    bool is_left_divisible_by_atom(size_t k) const;
+
+    /**
+     * @brief Checks if the `k`-th atom right-divides `*this`.
+     *
+     * Atoms are reflections, which left-divide a factor if and only if they
+     * right-divide it: see `is_left_divisible_by_atom`.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom right-divides `*this`.
+     */
+    inline bool is_right_divisible_by_atom(size_t k) const {
+        return is_left_divisible_by_atom(k);
+    }
+
     /**
      * @brief Sets `*this` to a random factor.
      *
@@ -388,6 +496,38 @@ class Underlying {
      */
     std::size_t hash() const;
 
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return \f$2n\f$.
+     */
+    inline size_t packed_size() const { return 2 * size_t(get_parameter()); }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is the stored half of the inverse permutation table (from index
+     * \f$1\f$ to \f$n\f$, see `permutation_table`), as 16-bit little-endian
+     * integers.
+     *
+     * Linear in the parameter.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    void pack(u8 *out) const;
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * The whole table must be a permutation of \f$[\![1,2n]\!]\f$, that
+     * `of_partition()` builds from a non-crossing partition. Linear in the
+     * parameter.
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    bool unpack(const u8 *in);
+
   private:
     /**
      * @brief Computes the factor associated with the inverse of the permutation
@@ -415,4 +555,10 @@ typedef BraidTemplate<Factor> Braid;
 
 } // namespace garcide::octahedral
 
+namespace garcide {
+
+GARCIDE_INSTANTIATE(extern, octahedral::Underlying)
+
+} // namespace garcide
+
 #endif
\ No newline at end of file
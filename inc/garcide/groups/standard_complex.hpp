@@ -28,7 +28,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "garcide/garcide.hpp"
+#include "garcide/instantiation.hpp"
+#include <algorithm>
 
 namespace garcide {
 
@@ -159,7 +160,7 @@ class Underlying {
      * Structures for the Complex Braid Groups_ \f$B(e,e,n)\f$,
      * [arXiv:1707.06864](https://arxiv.org/abs/1707.06864)).
      */
-    std::vector<i16> permutation_table;
+    ResourceVector<i16> permutation_table;
 
     /**
      * @brief The multiplicating coefficients.
@@ -173,7 +174,7 @@ class Underlying {
      * matrix as a profuct of a diagonal matrix on the left and a permutation
      * matrix on the right.
      */
-    std::vector<i16> coefficient_table;
+    ResourceVector<i16> coefficient_table;
 
   public:
     /**
@@ -324,26 +325,54 @@ class Underlying {
     /**
      * @brief Computes the left meet of `*this` and `b`.
      *
-     * This is done by extracting it atom by atom in Neaime's normal form for
-     * factors.
+     * This is done by extracting it block by block in Neaime's normal form for
+     * factors. Each block is a run of \f$s\f$ generators, possibly followed
+     * by \f$t\f$ generators and another run. Runs are read at once from the
+     * keys of the rows (see `s_key`), and applied to the remainders of both
+     * operands as row rotations; the meet is recovered from the remainder of
+     * `*this` at the end.
      *
-     * Runs in \f$\mathrm O(n^2+en)\f$ time.
+     * Each run costs its length, both to be read and to be applied as a
+     * rotation, so that this runs in \f$\mathrm O(n + \ell)\f$ time, where
+     * \f$\ell\f$ is the length of the meet. As \f$\ell\f$ may be as large as
+     * the length of \f$\lambda_{en}\f$, which is quadratic in \f$n\f$, this
+     * is \f$\mathrm O(n^2)\f$ in the worst case.
      *
      * @param b Second operand.
      * @return The meet of `*this` and `b`.
      */
     Underlying left_meet(const Underlying &b) const;
 
+    /**
+     * @brief Computes the transpose of the matrix of `*this`.
+     *
+     * Transposition reverses words in the atoms, and sends \f$t_i\f$ to
+     * \f$t_{-i}\f$ (the atoms are involutions, and the transpose of a
+     * monomial matrix is the complex conjugate of its inverse). This maps the
+     * relations of the presentation to relations of the presentation, so that
+     * it is an anti-automorphism of the monoid, that exchanges left and right
+     * divisibility.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return The transpose of `*this`.
+     */
+    Underlying transpose() const;
+
     /**
      * @brief Computes the right meet of `*this` and `b`.
      *
-     * Uses an identity to reduce the calculation to the left case.
+     * Uses `transpose` to reduce the calculation to the left case. (The
+     * inverse does not do, as reversing words does not map the presentation
+     * to itself.)
+     *
+     * Runs in the time of `left_meet`.
      *
      * @param b Second operand.
      * @return The right meet of `*this` and `b`.
      */
     inline Underlying right_meet(const Underlying &b) const {
-        return inverse().left_meet(b.inverse()).inverse();
+        return transpose().left_meet(b.transpose()).transpose();
     }
 
     /**
@@ -401,6 +430,87 @@ class Underlying {
      */
     Underlying right_complement(const Underlying &b) const;
 
+    /**
+     * @brief Equality test with the identity.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return If `*this` is the identity.
+     */
+    bool is_identity() const;
+
+    /**
+     * @brief Equality test with the Garside element.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return If `*this` is \f$\lambda_{en}\f$.
+     */
+    bool is_delta() const;
+
+    /**
+     * @brief Computes the left complement of `*this` under the Garside element.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return The left complement of `*this` to \f$\lambda_{en}\f$.
+     */
+    Underlying left_complement() const;
+
+    /**
+     * @brief Computes the right complement of `*this` under the Garside
+     * element.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @return The right complement of `*this` to \f$\lambda_{en}\f$.
+     */
+    Underlying right_complement() const;
+
+    /**
+     * @brief Checks if the left meet of `*this` and `b` is the identity.
+     *
+     * That is to say, if no atom left-divides both, which is checked with
+     * `is_s_left_divisor` and `is_t_left_divisor`.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @param b Second operand.
+     * @return If the left meet of `*this` and `b` is the identity.
+     */
+    bool left_meet_is_identity(const Underlying &b) const;
+
+    /**
+     * @brief Checks if the `k`-th atom left-divides `*this`.
+     *
+     * Atoms are \f$s_3,\ldots,s_n\f$, then \f$t_0,\ldots,t_{e-1}\f$: see
+     * `is_s_left_divisor` and `is_t_left_divisor`. Constant time.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom left-divides `*this`.
+     */
+    inline bool is_left_divisible_by_atom(size_t k) const {
+        i16 n = get_parameter().n;
+        return (i16(k) < n - 2) ? is_s_left_divisor(i16(k) + 3)
+                                : is_t_left_divisor(i16(k) - (n - 2));
+    }
+
+    /**
+     * @brief Checks if the `k`-th atom right-divides `*this`.
+     *
+     * Atoms are involutions, and the length is invariant under inversion:
+     * an atom right-divides a factor if and only if it left-divides its
+     * inverse (in the group, that needs not be simple).
+     *
+     * Linear in \f$n\f$.
+     *
+     * @param k The index of the atom.
+     * @return If the `k`-th atom right-divides `*this`.
+     */
+    inline bool is_right_divisible_by_atom(size_t k) const {
+        return inverse().is_left_divisible_by_atom(k);
+    }
+
     /**
      * @brief Sets `*this` to a random factor.
      *
@@ -442,6 +552,39 @@ class Underlying {
      */
     std::size_t hash() const;
 
+    /**
+     * @brief Size of the packed form of factors, in bytes.
+     *
+     * @return \f$4n\f$.
+     */
+    inline size_t packed_size() const {
+        return 4 * size_t(get_parameter().n);
+    }
+
+    /**
+     * @brief Writes the packed form of the factor.
+     *
+     * That is `permutation_table`, then `coefficient_table`, as 16-bit
+     * little-endian integers.
+     *
+     * Linear in \f$n\f$.
+     *
+     * @param out Where the `packed_size()` bytes are written.
+     */
+    void pack(u8 *out) const;
+
+    /**
+     * @brief Sets the factor to one read in packed form (see `pack()`).
+     *
+     * The tables must describe an element of \f$\mathrm G(e,e,n)\f$ that
+     * left-divides \f$\Delta\f$ (which is checked with `left_meet()`, so
+     * that this is quadratic in \f$n\f$ in the worst case).
+     *
+     * @param in Where the `packed_size()` bytes are read.
+     * @return If the bytes describe a factor.
+     */
+    bool unpack(const u8 *in);
+
   private:
     /**
      * @brief Gets the direct permutation table associated with the factor.
@@ -499,6 +642,57 @@ class Underlying {
                       ((i == 0) ? 0 : get_parameter().e - i));
     }
 
+    /** @brief Key of a row for the order induced by the \f$s\f$ generators.
+     *
+     * Rows with a non zero coefficient come after rows with a zero one. Among
+     * the former, the key grows with the column; among the latter, it
+     * decreases with it.
+     *
+     * Then a case study of `is_s_left_divisor` shows that \f$s_i\f$ left
+     * divides the factor if and only if the key of row \f$i-1\f$ is greater
+     * than the one of row \f$i-2\f$: on rows \f$1\f$ to \f$n-1\f$, the
+     * \f$s\f$ generators behave as in the weak order of the symmetric group,
+     * and a word \f$s_js_{j-1}\cdots s_{i}\f$ left divides the factor if and
+     * only if the key of row \f$j-1\f$ is greater than all the keys of rows
+     * \f$i-2\f$ to \f$j-2\f$.
+     *
+     * @param i The row.
+     * @return Its key, in \f$[\![-n, n-1]\!]\f$.
+     */
+    inline i16 s_key(i16 i) const {
+        return (coefficient_table[i] != 0) ? permutation_table[i]
+                                           : -1 - permutation_table[i];
+    }
+
+    /** @brief Left multiplies by a cycle of \f$s\f$ generators.
+     *
+     * Moves row `from` to position `to`, shifting the rows in between by one.
+     * If `from` is greater than `to`, this is left multiplication by
+     * \f$s_{to+2}\cdots s_{from}s_{from+1}\f$ (and by its reverse otherwise).
+     *
+     * Linear in \f$|from - to|\f$.
+     *
+     * @param from The row that is moved, in \f$[\![1, n-1]\!]\f$.
+     * @param to Its new position, in \f$[\![1, n-1]\!]\f$.
+     */
+    inline void move_row(i16 from, i16 to) {
+        if (from > to) {
+            std::rotate(permutation_table.begin() + to,
+                        permutation_table.begin() + from,
+                        permutation_table.begin() + from + 1);
+            std::rotate(coefficient_table.begin() + to,
+                        coefficient_table.begin() + from,
+                        coefficient_table.begin() + from + 1);
+        } else if (from < to) {
+            std::rotate(permutation_table.begin() + from,
+                        permutation_table.begin() + from + 1,
+                        permutation_table.begin() + to + 1);
+            std::rotate(coefficient_table.begin() + from,
+                        coefficient_table.begin() + from + 1,
+                        coefficient_table.begin() + to + 1);
+        }
+    }
+
     /** @brief Left multiplies by \f$s_i\f$.
      *
      * (Or divides, which is the same as it has order \f$2\f$.)
@@ -527,12 +721,23 @@ class Underlying {
      * \f$t_i\f$.
      */
     inline void t_left_multiply(i16 *dir_perm, i16 i) {
+        t_left_multiply(i);
+        std::swap(dir_perm[permutation_table[0]],
+                  dir_perm[permutation_table[1]]);
+    }
+
+    /** @brief Left multiplies by \f$t_i\f$.
+     *
+     * Same as above, for when the direct table is not needed.
+     *
+     * @param i The integer \f$i\f$ for which we multiply the factor by
+     * \f$t_i\f$.
+     */
+    inline void t_left_multiply(i16 i) {
         std::swap(coefficient_table[0], coefficient_table[1]);
         std::swap(permutation_table[0], permutation_table[1]);
         coefficient_table[0] = rem(coefficient_table[0] - i, get_parameter().e);
         coefficient_table[1] = rem(coefficient_table[1] + i, get_parameter().e);
-        std::swap(dir_perm[permutation_table[0]],
-                  dir_perm[permutation_table[1]]);
     }
 
     /** @brief Right multiplies by \f$s_i\f$.
@@ -586,6 +791,8 @@ using Braid = BraidTemplate<Factor>;
 
 } // namespace standard_complex
 
+GARCIDE_INSTANTIATE(extern, standard_complex::Underlying)
+
 /**
  * @brief Inserts a parameter in the output stream.
  *
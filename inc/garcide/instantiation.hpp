@@ -0,0 +1,129 @@
+/**
+ * @file instantiation.hpp
+ * @author GarCide contributors
+ * @brief Header file for explicit instantiations of the summit algorithms.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INSTANTIATION
+#define INSTANTIATION
+
+#include "garcide/centralizer.hpp"
+#include "garcide/sliding_circuits.hpp"
+#include "garcide/super_summit.hpp"
+#include "garcide/ultra_summit.hpp"
+
+/**
+ * @brief Declares (or defines) the explicit instantiations of the braid
+ * classes and summit algorithms for a class of underlying factors.
+ *
+ * Each group header expands it as `GARCIDE_INSTANTIATE(extern, U)`, after
+ * declaring its `Underlying` class, so that code including it does not
+ * instantiate the summit algorithms again. The matching implementation file
+ * expands it as `GARCIDE_INSTANTIATE(, U)`, so that they are compiled (once,
+ * with the library's optimization options) into _GarCide_.
+ *
+ * Only the entry points of the algorithms are listed: the functions they call
+ * are then only instantiated in the library. Inline member functions may still
+ * be instantiated in client code, for inlining.
+ *
+ * It must be expanded in namespace `garcide`.
+ *
+ * @param EXTERN Either `extern` or nothing.
+ * @param U A class representing underlying factors.
+ */
+#define GARCIDE_INSTANTIATE(EXTERN, U)                                         \
+    EXTERN template class FactorTemplate<U>;                                   \
+    EXTERN template class BraidTemplate<FactorTemplate<U>>;                    \
+                                                                               \
+    EXTERN template class super_summit::SuperSummitSet<                        \
+        BraidTemplate<FactorTemplate<U>>>;                                     \
+    EXTERN template BraidTemplate<FactorTemplate<U>>                           \
+    super_summit::send_to_super_summit(                                        \
+        const BraidTemplate<FactorTemplate<U>> &b);                            \
+    EXTERN template BraidTemplate<FactorTemplate<U>>                           \
+    super_summit::send_to_super_summit(                                        \
+        const BraidTemplate<FactorTemplate<U>> &b,                             \
+        BraidTemplate<FactorTemplate<U>> &c);                                  \
+    EXTERN template super_summit::SuperSummitSet<                              \
+        BraidTemplate<FactorTemplate<U>>>                                      \
+    super_summit::super_summit_set(const BraidTemplate<FactorTemplate<U>> &b); \
+    EXTERN template class super_summit::LazySuperSummitSet<FactorTemplate<U>>; \
+    EXTERN template bool super_summit::are_conjugate(                          \
+        const BraidTemplate<FactorTemplate<U>> &b1,                            \
+        const BraidTemplate<FactorTemplate<U>> &b2,                            \
+        BraidTemplate<FactorTemplate<U>> &c);                                  \
+                                                                               \
+    EXTERN template class ultra_summit::UltraSummitSet<                        \
+        BraidTemplate<FactorTemplate<U>>>;                                     \
+    EXTERN template std::vector<BraidTemplate<FactorTemplate<U>>>              \
+    ultra_summit::trajectory(BraidTemplate<FactorTemplate<U>> b);              \
+    EXTERN template BraidTemplate<FactorTemplate<U>>                           \
+    ultra_summit::send_to_ultra_summit(                                        \
+        const BraidTemplate<FactorTemplate<U>> &b);                            \
+    EXTERN template BraidTemplate<FactorTemplate<U>>                           \
+    ultra_summit::send_to_ultra_summit(                                        \
+        const BraidTemplate<FactorTemplate<U>> &b,                             \
+        BraidTemplate<FactorTemplate<U>> &c);                                  \
+    EXTERN template ultra_summit::UltraSummitSet<                              \
+        BraidTemplate<FactorTemplate<U>>>                                      \
+    ultra_summit::ultra_summit_set(const BraidTemplate<FactorTemplate<U>> &b); \
+    EXTERN template class ultra_summit::LazyUltraSummitSet<FactorTemplate<U>>; \
+    EXTERN template bool ultra_summit::are_conjugate(                          \
+        const BraidTemplate<FactorTemplate<U>> &b1,                            \
+        const BraidTemplate<FactorTemplate<U>> &b2,                            \
+        BraidTemplate<FactorTemplate<U>> &c);                                  \
+                                                                               \
+    EXTERN template class sliding_circuits::SlidingCircuitsSet<                \
+        BraidTemplate<FactorTemplate<U>>>;                                     \
+    EXTERN template std::vector<BraidTemplate<FactorTemplate<U>>>              \
+    sliding_circuits::trajectory(BraidTemplate<FactorTemplate<U>> b);          \
+    EXTERN template std::vector<BraidTemplate<FactorTemplate<U>>>              \
+    sliding_circuits::trajectory(BraidTemplate<FactorTemplate<U>> b,           \
+                                 BraidTemplate<FactorTemplate<U>> &c, i16 &d); \
+    EXTERN template BraidTemplate<FactorTemplate<U>>                           \
+    sliding_circuits::send_to_sliding_circuits(                                \
+        const BraidTemplate<FactorTemplate<U>> &b);                            \
+    EXTERN template BraidTemplate<FactorTemplate<U>>                           \
+    sliding_circuits::send_to_sliding_circuits(                                \
+        const BraidTemplate<FactorTemplate<U>> &b,                             \
+        BraidTemplate<FactorTemplate<U>> &c);                                  \
+    EXTERN template sliding_circuits::SlidingCircuitsSet<                      \
+        BraidTemplate<FactorTemplate<U>>>                                      \
+    sliding_circuits::sliding_circuits_set(                                    \
+        const BraidTemplate<FactorTemplate<U>> &b);                            \
+    EXTERN template class sliding_circuits::LazySlidingCircuitsSet<            \
+        FactorTemplate<U>>;                                                    \
+    EXTERN template bool sliding_circuits::are_conjugate(                      \
+        const BraidTemplate<FactorTemplate<U>> &b1,                            \
+        const BraidTemplate<FactorTemplate<U>> &b2,                            \
+        BraidTemplate<FactorTemplate<U>> &c);                                  \
+                                                                               \
+    EXTERN template class centralizer::Centralizer<                            \
+        BraidTemplate<FactorTemplate<U>>>;                                     \
+    EXTERN template centralizer::Centralizer<BraidTemplate<FactorTemplate<U>>> \
+    centralizer::centralizer(const BraidTemplate<FactorTemplate<U>> &b);
+
+#endif
@@ -30,6 +30,8 @@
 #ifndef SLIDING_CIRCUITS
 #define SLIDING_CIRCUITS
 
+#include "garcide/cache.hpp"
+#include "garcide/summit_search.hpp"
 #include "garcide/super_summit.hpp"
 
 /**
@@ -364,13 +366,31 @@ std::vector<F> min_sliding_circuits(const BraidTemplate<F> &b,
 
     std::transform(
         atoms.begin(), atoms.end(), factors.begin(),
-        [&b, &b_rcf](F &atom) { return min_sliding_circuits(b, b_rcf, atom); });
+        [&b, &b_rcf](F &atom) {
+            // The result is assigned to a factor from outside the arena, that
+            // braids and factors created for this atom then do not outlive.
+            F f = atom;
+            {
+                ScratchArena arena;
+                f = min_sliding_circuits(b, b_rcf, atom);
+            }
+            return f;
+        });
 
 #else
 
     std::transform(
         std::execution::par, atoms.begin(), atoms.end(), factors.begin(),
-        [&b, &b_rcf](F &atom) { return min_sliding_circuits(b, b_rcf, atom); });
+        [&b, &b_rcf](F &atom) {
+            // The result is assigned to a factor from outside the arena, that
+            // braids and factors created for this atom then do not outlive.
+            F f = atom;
+            {
+                ScratchArena arena;
+                f = min_sliding_circuits(b, b_rcf, atom);
+            }
+            return f;
+        });
 
 #endif
 
@@ -755,70 +775,212 @@ template <class B> class SlidingCircuitsSet {
 };
 
 /**
- * @brief Computes the sliding circuits set of `b`.
+ * @brief Appends a sliding circuits set to `str`, for the cache.
+ *
+ * Only the first element of each circuit is written.
  *
  * @tparam F A class representing factors.
- * @param b The braid whose sliding circuits set is computed.
- * @return The sliding circuits set of `b`.
+ * @param str The string to append to.
+ * @param scs The sliding circuits set.
  */
 template <class F>
-SlidingCircuitsSet<BraidTemplate<F>>
-sliding_circuits_set(const BraidTemplate<F> &b) {
-    SlidingCircuitsSet<BraidTemplate<F>> scs;
-    std::list<BraidTemplate<F>> queue, queue_rcf;
-
-    BraidTemplate<F> b2 = send_to_sliding_circuits(b);
-    BraidTemplate<F> b2_rcf = b2;
-    b2_rcf.lcf_to_rcf();
-
-    scs.insert(trajectory(b2));
-    queue.push_back(b2);
-    queue_rcf.push_back(b2_rcf);
-
-    F delta = F(b.get_parameter());
-    delta.delta();
+void write(std::string &str, const SlidingCircuitsSet<BraidTemplate<F>> &scs) {
+    cache::write(str, u64(scs.number_of_circuits()));
+    for (size_t circuit_index = 0; circuit_index < scs.number_of_circuits();
+         circuit_index++) {
+        cache::write(str, scs.at(circuit_index, 0));
+    }
+}
 
-    b2.conjugate(delta);
+/**
+ * @brief Reads a sliding circuits set, written by `write`.
+ *
+ * @tparam F A class representing factors.
+ * @param pos The position to read from, that is moved past the set.
+ * @param end The end of the buffer.
+ * @param n The parameter of the braids in the set.
+ * @return The sliding circuits set.
+ * @exception cache::CorruptEntry Thrown if the buffer does not hold a sliding
+ * circuits set.
+ */
+template <class F>
+SlidingCircuitsSet<BraidTemplate<F>> read(const char *&pos, const char *end,
+                                          typename F::Parameter n) {
+    SlidingCircuitsSet<BraidTemplate<F>> scs;
+    BraidTemplate<F> b = BraidTemplate<F>(n);
+    u64 number_of_circuits = cache::read(pos, end);
+    for (u64 circuit_index = 0; circuit_index < number_of_circuits;
+         circuit_index++) {
+        cache::read(pos, end, b);
+        scs.insert(trajectory(b));
+    }
+    return scs;
+}
 
-    if (!scs.mem(b2)) {
-        b2_rcf.conjugate_rcf(delta);
+/**
+ * @brief Looks the sliding circuits set of `b` up in the cache, with the tree
+ * of the graph BFS that computed it.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid in its sliding circuits set, that the BFS started from.
+ * @param set Set by the function to the sliding circuits set of `b`, if it is
+ * found.
+ * @param mins Set by the function as by `sliding_circuits_set`, if it is found.
+ * @param prev Set by the function as by `sliding_circuits_set`, if it is found.
+ * @return If the set was found.
+ */
+template <class F>
+bool load_from_cache(const BraidTemplate<F> &b,
+                     SlidingCircuitsSet<BraidTemplate<F>> &set,
+                     std::vector<F> &mins, std::vector<i16> &prev) {
+    cache::Entry entry;
+    if (!cache::is_enabled() ||
+        !cache::load(cache::key("sliding_circuits_tree 1", b), entry)) {
+        return false;
+    }
+    const char *pos = entry.data(), *end = pos + entry.size();
+    typename F::Parameter n = b.get_parameter();
+    try {
+        SlidingCircuitsSet<BraidTemplate<F>> s = read<F>(pos, end, n);
+        std::vector<F> m(1, F(n));
+        std::vector<i16> p(1, 0);
+        m[0].identity();
+        F f = F(n);
+        std::vector<F> atoms = f.atoms();
+        for (size_t i = 1; i < s.number_of_circuits(); i++) {
+            cache::read(pos, end, f, atoms);
+            u64 j = cache::read(pos, end);
+            if (j >= i) {
+                throw cache::CorruptEntry();
+            }
+            m.push_back(f);
+            p.push_back(i16(j));
+        }
+        set = s;
+        mins = m;
+        prev = p;
+        return true;
+    } catch (cache::CorruptEntry const &) {
+        return false;
+    }
+}
 
-        scs.insert(trajectory(b2));
-        queue.push_back(b2);
-        queue_rcf.push_back(b2_rcf);
+/**
+ * @brief Stores the sliding circuits set of `b` in the cache, with the tree of
+ * the graph BFS that computed it.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid in its sliding circuits set, that the BFS started from.
+ * @param set The sliding circuits set of `b`.
+ * @param mins As set by `sliding_circuits_set`.
+ * @param prev As set by `sliding_circuits_set`.
+ */
+template <class F>
+void store_in_cache(const BraidTemplate<F> &b,
+                    const SlidingCircuitsSet<BraidTemplate<F>> &set,
+                    const std::vector<F> &mins, const std::vector<i16> &prev) {
+    if (!cache::is_enabled()) {
+        return;
+    }
+    std::vector<F> atoms = F(b.get_parameter()).atoms();
+    std::string value;
+    write(value, set);
+    for (size_t i = 1; i < mins.size(); i++) {
+        cache::write(value, mins[i], atoms);
+        cache::write(value, u64(prev[i]));
     }
+    cache::store(cache::key("sliding_circuits_tree 1", b), value);
+}
 
-    while (!queue.empty()) {
-        std::vector<F> min =
-            min_sliding_circuits(queue.front(), queue_rcf.front());
+/**
+ * @brief The graph of sliding circuits sets, for
+ * `summit_search::BreadthFirstSearch`.
+ *
+ * Its vertices are circuits for sliding, and its edges are given by
+ * `min_sliding_circuits`.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> struct SlidingCircuitsGraph {
+    /**
+     * @brief Factor type.
+     */
+    using Factor = F;
 
-        for (typename std::vector<F>::iterator itf = min.begin();
-             itf != min.end(); itf++) {
-            b2 = queue.front();
+    /**
+     * @brief Braid type.
+     */
+    using Braid = BraidTemplate<F>;
 
-            b2.conjugate(*itf);
+    /**
+     * @brief Vertex set type.
+     */
+    using Set = SlidingCircuitsSet<BraidTemplate<F>>;
 
-            if (!scs.mem(b2)) {
-                b2_rcf = queue_rcf.front();
-                b2_rcf.conjugate_rcf(*itf);
+    /**
+     * @brief Computes the circuit of `b`.
+     *
+     * @param b A braid in its sliding circuits set.
+     * @return The circuit of `b`.
+     */
+    static inline std::vector<Braid> trajectory(const Braid &b) {
+        return sliding_circuits::trajectory(b);
+    }
 
-                scs.insert(trajectory(b2));
-                queue.push_back(b2);
-                queue_rcf.push_back(b2_rcf);
+    /**
+     * @brief Computes the minimal simple conjugators at `b` that stay in the
+     * sliding circuits set.
+     *
+     * @param b A braid in its sliding circuits set.
+     * @param b_rcf `b` in RCF.
+     * @return The minimal conjugators at `b`.
+     */
+    static inline std::vector<F> neighbours(const Braid &b,
+                                            const Braid &b_rcf) {
+        return min_sliding_circuits(b, b_rcf);
+    }
+};
 
-                b2.conjugate(delta);
-                if (!scs.mem(b2)) {
-                    b2_rcf.conjugate_rcf(delta);
+/**
+ * @brief Computes the sliding circuits set of `b`.
+ *
+ * If the cache is enabled, the result is looked up there first, and stored
+ * there afterwards.
+ *
+ * @tparam F A class representing factors.
+ * @param b The braid whose sliding circuits set is computed.
+ * @return The sliding circuits set of `b`.
+ */
+template <class F>
+SlidingCircuitsSet<BraidTemplate<F>>
+sliding_circuits_set(const BraidTemplate<F> &b) {
+    BraidTemplate<F> b2 = send_to_sliding_circuits(b);
 
-                    scs.insert(trajectory(b2));
-                    queue.push_back(b2);
-                    queue_rcf.push_back(b2_rcf);
-                }
+    std::string key;
+    if (cache::is_enabled()) {
+        key = cache::key("sliding_circuits_set 1", b2);
+        cache::Entry entry;
+        if (cache::load(key, entry)) {
+            const char *pos = entry.data();
+            try {
+                return read<F>(pos, pos + entry.size(), b.get_parameter());
+            } catch (cache::CorruptEntry const &) {
             }
         }
-        queue.pop_front();
-        queue_rcf.pop_front();
     }
+
+    // Circuits are found along with their conjugates by Delta.
+    summit_search::BreadthFirstSearch<
+        SlidingCircuitsGraph<F>, summit_search::NoHooks<BraidTemplate<F>, F>>
+        search(b2, {}, true);
+    SlidingCircuitsSet<BraidTemplate<F>> &scs = search.run().set();
+
+    if (cache::is_enabled()) {
+        std::string value;
+        write(value, scs);
+        cache::store(key, value);
+    }
+
     return scs;
 }
 
@@ -831,6 +993,9 @@ sliding_circuits_set(const BraidTemplate<F> &b) {
  * one in the graph BFS of its sliding circuits set, and `mins[i]` the
  * corresponding conjugator.
  *
+ * If the cache is enabled, the result (with `mins` and `prev`) is looked up
+ * there first, and stored there afterwards.
+ *
  * @tparam F A class representing factors.
  * @param b The braid whose sliding circuits set is computed.
  * @param mins A vector that is set to contain, for each `i`, an element that
@@ -845,50 +1010,207 @@ SlidingCircuitsSet<BraidTemplate<F>>
 sliding_circuits_set(const BraidTemplate<F> &b, std::vector<F> &mins,
                      std::vector<i16> &prev) {
     SlidingCircuitsSet<BraidTemplate<F>> scs;
-    std::list<BraidTemplate<F>> queue, queue_rcf;
-
-    i16 current = 0;
     mins.clear();
     prev.clear();
-    mins.push_back(F(b.get_parameter()));
-    mins[0].identity();
-    prev.push_back(0);
 
     BraidTemplate<F> b2 = send_to_sliding_circuits(b);
-    BraidTemplate<F> b2_rcf = b2;
-    b2_rcf.lcf_to_rcf();
+    if (load_from_cache(b2, scs, mins, prev)) {
+        return scs;
+    }
 
-    scs.insert(trajectory(b2));
-    queue.push_back(b2);
-    queue_rcf.push_back(b2_rcf);
+    summit_search::BreadthFirstSearch<
+        SlidingCircuitsGraph<F>, summit_search::TreeHooks<BraidTemplate<F>, F>>
+        search(b2, {&mins, &prev});
+    scs = search.run().set();
 
-    while (!queue.empty()) {
-        std::vector<F> min =
-            min_sliding_circuits(queue.front(), queue_rcf.front());
+    store_in_cache(b2, scs, mins, prev);
 
-        for (typename std::vector<F>::iterator itf = min.begin();
-             itf != min.end(); itf++) {
-            b2 = queue.front();
-            b2.conjugate(*itf);
+    return scs;
+}
 
-            if (!scs.mem(b2)) {
-                b2_rcf = queue_rcf.front();
-                b2_rcf.conjugate_rcf(*itf);
+/**
+ * @brief A sliding circuit, with a conjugator.
+ *
+ * @tparam B A class representing braids.
+ */
+template <class B> struct Circuit {
+    /**
+     * @brief The circuit, in sliding order.
+     */
+    std::vector<B> circuit;
 
-                scs.insert(trajectory(b2));
-                queue.push_back(b2);
-                queue_rcf.push_back(b2_rcf);
+    /**
+     * @brief A conjugator \f$c\f$, such that \f$c^{-1}bc\f$ is the first
+     * element of `circuit`, where \f$b\f$ is the braid the circuit was computed
+     * from.
+     *
+     * Conjugators to the other elements follow by appending the preferred
+     * prefixes of the preceding ones (that is, by sliding).
+     */
+    B conjugator;
+};
 
-                mins.push_back(*itf);
-                prev.push_back(current);
-            }
+/**
+ * @brief A lazy range over the sliding circuits set of a braid.
+ *
+ * The sliding circuits set is explored breadth-first, as in
+ * `sliding_circuits_set`, but only as far as is needed to yield the circuits
+ * that are pulled: each circuit is yielded with a conjugator, as soon as it is
+ * found. Iterating only through the first circuits is then much cheaper than
+ * computing the whole set, and the exploration may be stopped at any point.
+ *
+ * The cache is not used.
+ *
+ * This is a single-pass range: circuits are pulled from it, and are not
+ * yielded again by a second iteration.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> class LazySlidingCircuitsSet {
+  public:
+    /**
+     * @brief Type of the yielded values.
+     */
+    using value_type = Circuit<BraidTemplate<F>>;
+
+    /**
+     * @brief Iterator type.
+     */
+    using Iterator = PullIterator<LazySlidingCircuitsSet>;
+
+  private:
+    /**
+     * @brief Type of the search.
+     */
+    using Search = summit_search::BreadthFirstSearch<
+        SlidingCircuitsGraph<F>,
+        summit_search::PendingHooks<BraidTemplate<F>, F, value_type>>;
+
+    /**
+     * @brief The parameter.
+     */
+    typename F::Parameter parameter;
+
+    /**
+     * @brief The search, whose hooks keep the circuits that were found but
+     * not yielded yet.
+     */
+    Search search;
+
+    /**
+     * @brief Starts the search from a sliding circuits conjugate of `b`.
+     *
+     * Circuits are found along with their conjugates by \f$\Delta\f$.
+     *
+     * @param b A braid.
+     * @return The search.
+     */
+    static Search start(const BraidTemplate<F> &b) {
+        BraidTemplate<F> c = BraidTemplate<F>(b.get_parameter());
+        BraidTemplate<F> b2 = send_to_sliding_circuits(b, c);
+        return Search(
+            b2, summit_search::PendingHooks<BraidTemplate<F>, F, value_type>(c),
+            true);
+    }
+
+  public:
+    /**
+     * @brief Constructs a lazy range over the sliding circuits set of `b`.
+     *
+     * Only a sliding circuit conjugate of `b` (and its circuit, and their
+     * conjugates by \f$\Delta\f$) is computed.
+     *
+     * @param b The braid whose sliding circuits set is iterated through.
+     */
+    LazySlidingCircuitsSet(const BraidTemplate<F> &b)
+        : parameter(b.get_parameter()), search(start(b)) {}
+
+    /**
+     * @brief Pulls the next circuit.
+     *
+     * @param value Set to the next circuit, with its conjugator (if there is
+     * one).
+     * @return If there was a next circuit.
+     */
+    bool next(value_type &value) {
+        std::list<value_type> &pending = search.hooks().pending;
+        while (pending.empty() && search.step()) {
+        }
+        if (pending.empty()) {
+            return false;
         }
-        queue.pop_front();
-        queue_rcf.pop_front();
+        value = pending.front();
+        pending.pop_front();
+        return true;
+    }
 
-        current++;
+    /**
+     * @brief Iterator to the next circuit.
+     *
+     * @return An iterator, that pulls circuits from `*this`.
+     */
+    inline Iterator begin() {
+        return Iterator(*this, value_type{{}, parameter});
     }
-    return scs;
+
+    /**
+     * @brief End iterator.
+     *
+     * @return The end iterator.
+     */
+    inline Iterator end() const { return Iterator(); }
+};
+
+/**
+ * @brief Lazily iterates through the sliding circuits set of `b`, circuit by
+ * circuit.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid.
+ * @return A lazy range over the circuits of the sliding circuits set of `b`,
+ * that come with conjugators from `b`.
+ */
+template <class F>
+inline LazySlidingCircuitsSet<F>
+lazy_sliding_circuits_set(const BraidTemplate<F> &b) {
+    return LazySlidingCircuitsSet<F>(b);
+}
+
+/**
+ * @brief Explores the rigid part of the sliding circuits set of `b`, until `b2`
+ * is reached.
+ *
+ * This is the same graph BFS as for `sliding_circuits_set`, except that `b` is
+ * assumed to be rigid and in its sliding circuits set (it is not sent there
+ * again), that edges whose target is not rigid are pruned, and that the
+ * exploration stops as soon as the circuit of `b2` is found.
+ *
+ * `mins` and `prev` are set as in `sliding_circuits_set`, so that `tree_path`
+ * can be used on the result.
+ *
+ * @tparam F A class representing factors.
+ * @param b A rigid braid, in its sliding circuits set.
+ * @param b2 The braid that is searched for.
+ * @param mins A vector that is set to contain, for each `i`, an element that
+ * conjugates the base of circuit `prev[i]` to the base of circuit `i`.
+ * @param prev A vector that is set to contain integers, such that, for each
+ * `i`, `mins[i]` conjugates the base of circuit `prev[i]` to the base of
+ * circuit `i`.
+ * @return The part of the rigid sliding circuits conjugates of `b` that was
+ * explored. It contains `b2` if and only if `b2` was found.
+ */
+template <class F>
+SlidingCircuitsSet<BraidTemplate<F>>
+rigid_sliding_circuits_set(const BraidTemplate<F> &b,
+                           const BraidTemplate<F> &b2, std::vector<F> &mins,
+                           std::vector<i16> &prev) {
+    mins.clear();
+    prev.clear();
+
+    summit_search::BreadthFirstSearch<
+        SlidingCircuitsGraph<F>, summit_search::TreeHooks<BraidTemplate<F>, F>>
+        search(b, {&mins, &prev, true, &b2});
+    return search.run().set();
 }
 
 /**
@@ -932,49 +1254,109 @@ BraidTemplate<F> tree_path(const BraidTemplate<F> &b,
 }
 
 /**
- * @brief Checks if two braids are conjugates, and computes a conjugator.
+ * @brief Checks if two braids, that are in their sliding circuits sets, are
+ * conjugates, and computes a conjugator.
  *
- * `c` is not modified if `b1` and `b2` are not conjugates.
+ * `c` is not modified if `bt1` and `bt2` are not conjugates.
+ *
+ * If both braids are rigid, only rigid elements are explored at first, and the
+ * whole sliding circuits set is only computed if that is inconclusive. If the
+ * cache holds the sliding circuits set, it is used directly instead; complete
+ * rigid explorations are stored there.
  *
- * This function uses sliding circuits sets.
+ * @warning Neither braid is sent to its sliding circuits set. This is not
+ * checked.
  *
  * @tparam F A class representing factors.
- * @param b1 A braid.
- * @param b2 Another braid.
+ * @param bt1 A braid in its sliding circuits set.
+ * @param bt2 Another braid in its sliding circuits set.
  * @param c A braid, that is set by the function to the conjugator that takes
- * `b1` to `b2`, if it exists.
- * @return If `b1` and `b2` are conjugates.
+ * `bt1` to `bt2`, if it exists.
+ * @return If `bt1` and `bt2` are conjugates.
  */
 template <class F>
-bool are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
-                   BraidTemplate<F> &c) {
-    typename F::Parameter n = b1.get_parameter();
-    BraidTemplate<F> c1 = BraidTemplate<F>(n), c2 = BraidTemplate<F>(n);
-
-    BraidTemplate<F> bt1 = send_to_sliding_circuits(b1, c1),
-                     bt2 = send_to_sliding_circuits(b2, c2);
-
+bool are_conjugate_summits(const BraidTemplate<F> &bt1,
+                           const BraidTemplate<F> &bt2, BraidTemplate<F> &c) {
     if (bt1.canonical_length() != bt2.canonical_length() ||
         bt1.sup() != bt2.sup()) {
         return false;
     }
 
     if (bt1.canonical_length() == 0) {
-        c = c1 * !c2;
+        c = BraidTemplate<F>(bt1.get_parameter());
         return true;
     }
 
     std::vector<F> mins;
     std::vector<i16> prev;
 
-    SlidingCircuitsSet<BraidTemplate<F>> scs =
-        sliding_circuits_set(bt1, mins, prev);
+    // A cached sliding circuits set is cheaper to use than any exploration.
+    SlidingCircuitsSet<BraidTemplate<F>> scs;
+    bool cached = load_from_cache(bt1, scs, mins, prev);
+
+    // If both braids are rigid, we first look for a conjugator among rigid
+    // elements only. When the canonical length is at least 2, every element of
+    // the sliding circuits set is then rigid, so there is no need to fall back
+    // to the general case.
+    if (!cached && bt1.is_rigid() && bt2.is_rigid()) {
+        SlidingCircuitsSet<BraidTemplate<F>> rscs =
+            rigid_sliding_circuits_set(bt1, bt2, mins, prev);
+
+        if (rscs.mem(bt2)) {
+            c = tree_path(bt2, rscs, mins, prev);
+            return true;
+        }
+
+        if (bt1.canonical_length() > 1) {
+            // The exploration was then complete, so that it is worth keeping.
+            store_in_cache(bt1, rscs, mins, prev);
+            return false;
+        }
+    }
+
+    if (!cached) {
+        scs = sliding_circuits_set(bt1, mins, prev);
+    }
 
     if (!scs.mem(bt2)) {
         return false;
     }
 
-    c = c1 * tree_path(bt2, scs, mins, prev) * !c2;
+    c = tree_path(bt2, scs, mins, prev);
+
+    return true;
+}
+
+/**
+ * @brief Checks if two braids are conjugates, and computes a conjugator.
+ *
+ * `c` is not modified if `b1` and `b2` are not conjugates.
+ *
+ * This function sends both braids to their sliding circuits sets, and then
+ * uses `are_conjugate_summits`.
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param c A braid, that is set by the function to the conjugator that takes
+ * `b1` to `b2`, if it exists.
+ * @return If `b1` and `b2` are conjugates.
+ */
+template <class F>
+bool are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
+                   BraidTemplate<F> &c) {
+    typename F::Parameter n = b1.get_parameter();
+    BraidTemplate<F> c1 = BraidTemplate<F>(n), c2 = BraidTemplate<F>(n),
+                     ct = BraidTemplate<F>(n);
+
+    BraidTemplate<F> bt1 = send_to_sliding_circuits(b1, c1),
+                     bt2 = send_to_sliding_circuits(b2, c2);
+
+    if (!are_conjugate_summits(bt1, bt2, ct)) {
+        return false;
+    }
+
+    c = c1 * ct * !c2;
 
     return true;
 }
@@ -0,0 +1,262 @@
+/**
+ * @file stream.hpp
+ * @author GarCide contributors
+ * @brief Header file for streaming braids from large files.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STREAM
+#define STREAM
+
+#include "garcide/garcide.hpp"
+#include <exception>
+#include <future>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ * @brief Namespace for streaming braids from large files.
+ */
+namespace garcide::stream {
+
+/**
+ * @brief Exception thrown when a file cannot be read.
+ */
+struct FileError {
+    /**
+     * @brief Source of the error.
+     *
+     * An error message, used to explain what went wrong.
+     */
+    std::string error_source;
+
+    /**
+     * @brief Construct a new `FileError` exception.
+     *
+     * It will hold `error_source` as its error message.
+     *
+     * @param error_source Source of the error.
+     */
+    FileError(std::string error_source) : error_source(error_source) {}
+};
+
+/**
+ * @brief A read-only file, mapped in memory.
+ */
+class MappedFile {
+  private:
+    /**
+     * @brief Start of the mapping.
+     */
+    char *mapping;
+
+    /**
+     * @brief Size of the file.
+     */
+    size_t size;
+
+  public:
+    /**
+     * @brief Maps a file in memory.
+     *
+     * @param path The path to the file.
+     * @exception FileError Thrown if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path);
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Contents of the file.
+     *
+     * @return A view of the contents of the file.
+     */
+    inline std::string_view contents() const {
+        return std::string_view(mapping, size);
+    }
+
+    /**
+     * @brief Tells the system that a range of the file will not be read
+     * anymore.
+     *
+     * Pages that are entirely within `[begin, end)` may then be dropped from
+     * memory, so that reading a file sequentially does not make the resident
+     * memory grow with its size.
+     *
+     * @param begin Start of the range.
+     * @param end End of the range.
+     */
+    void release(size_t begin, size_t end) const;
+};
+
+/**
+ * @brief Splits lines off the start of `text`.
+ *
+ * A final line that is empty is ignored, and carriage returns at the end of
+ * lines are dropped.
+ *
+ * @param text The text to split lines from. It is moved past the lines that
+ * were split.
+ * @param max_lines The maximal number of lines to split.
+ * @return The lines that were split.
+ */
+std::vector<std::string_view> split_lines(std::string_view &text,
+                                          size_t max_lines);
+
+/**
+ * @brief Parses a batch of lines as braids.
+ *
+ * This is done in parallel if `USE_PAR` is defined.
+ *
+ * @tparam B A class representing braids.
+ * @param lines The lines to parse.
+ * @param n The parameter of the braids.
+ * @param first_line The number of the first line in the file (starting from
+ * 1), for error messages.
+ * @return The parsed braids.
+ * @exception InvalidStringError Thrown if a line is not a braid (including if
+ * a power does not fit in an integer). Its error message holds the number of
+ * the first such line, followed by the message of the original error.
+ * Other exceptions thrown while parsing the first failing line are rethrown
+ * as they are.
+ */
+template <class B>
+std::vector<B> parse_lines(const std::vector<std::string_view> &lines,
+                           typename B::Parameter n, size_t first_line) {
+    std::vector<B> braids(lines.size(), B(n));
+    std::vector<std::exception_ptr> failures(lines.size());
+
+    // Exceptions cannot cross std::execution::par (std::terminate would be
+    // called), so that all of them are recorded and rethrown afterwards.
+    auto parse = [&braids, &failures, &lines](size_t i) {
+        try {
+            braids[i].of_string(std::string(lines[i]));
+        } catch (...) {
+            failures[i] = std::current_exception();
+        }
+    };
+
+    std::vector<size_t> indices(lines.size());
+    for (size_t i = 0; i < lines.size(); i++) {
+        indices[i] = i;
+    }
+
+#ifndef USE_PAR
+
+    std::for_each(indices.begin(), indices.end(), parse);
+
+#else
+
+    std::for_each(std::execution::par, indices.begin(), indices.end(), parse);
+
+#endif
+
+    for (size_t i = 0; i < lines.size(); i++) {
+        if (!failures[i]) {
+            continue;
+        }
+        std::string where =
+            "Line " + std::to_string(first_line + i) + " is not a braid: ";
+        try {
+            std::rethrow_exception(failures[i]);
+        } catch (InvalidStringError const &error) {
+            throw InvalidStringError(where + error.error_source);
+        } catch (std::logic_error const &error) {
+            // `std::stoi` throws `std::out_of_range` or
+            // `std::invalid_argument` on powers that are not integers.
+            throw InvalidStringError(where + "invalid number (" +
+                                     error.what() + ")!");
+        }
+    }
+
+    return braids;
+}
+
+/**
+ * @brief Applies `consume` to each braid in a file, one braid per line.
+ *
+ * The file is mapped in memory, and read by batches of `batch_size` lines.
+ * Each batch is parsed (in parallel, if `USE_PAR` is defined) while the
+ * previous one is fed to `consume`, so that at most two batches are held at
+ * any time, and pages of the file that were consumed are released. Memory use
+ * thus does not depend on the size of the file.
+ *
+ * Braids are fed to `consume` in the order of the file.
+ *
+ * @tparam B A class representing braids.
+ * @tparam Consumer A class of functions of signature `void _(B &)`.
+ * @param path The path to the file.
+ * @param n The parameter of the braids.
+ * @param consume The function braids are fed to.
+ * @param batch_size The number of lines in a batch.
+ * @exception FileError Thrown if the file cannot be read.
+ * @exception InvalidStringError Thrown if a line is not a braid. Braids on
+ * previous batches have been consumed by then.
+ */
+template <class B, class Consumer>
+void for_each_braid(const std::string &path, typename B::Parameter n,
+                    Consumer consume, size_t batch_size = 1 << 14) {
+    MappedFile file(path);
+    std::string_view text = file.contents();
+
+    size_t line = 1, released = 0;
+    std::vector<std::string_view> lines = split_lines(text, batch_size);
+
+    std::future<std::vector<B>> pending =
+        std::async(std::launch::async, parse_lines<B>, lines, n, line);
+
+    while (true) {
+        std::vector<B> braids = pending.get();
+        line += braids.size();
+        size_t consumed = text.data() - file.contents().data();
+
+        lines = split_lines(text, batch_size);
+        if (!lines.empty()) {
+            pending =
+                std::async(std::launch::async, parse_lines<B>, lines, n, line);
+        }
+
+        for (B &b : braids) {
+            consume(b);
+        }
+        file.release(released, consumed);
+        released = consumed;
+
+        if (lines.empty()) {
+            return;
+        }
+    }
+}
+
+} // namespace garcide::stream
+
+#endif
@@ -0,0 +1,400 @@
+/**
+ * @file summit_search.hpp
+ * @author GarCide contributors
+ * @brief Header (and implementation) file for the breadth-first search of the
+ * graphs of summit sets.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SUMMIT_SEARCH
+#define SUMMIT_SEARCH
+
+#include "garcide/garcide.hpp"
+#include <list>
+#include <vector>
+
+/**
+ * @brief Namespace for the breadth-first search of the graphs of summit sets.
+ *
+ * Ultra summit sets and sliding circuits sets are explored the same way: the
+ * vertices of their graphs are the orbits (for cycling) or circuits (for
+ * sliding) of their elements, and the edges out of a vertex are given by the
+ * minimal simple conjugators at its base. `BreadthFirstSearch` runs that
+ * search once, for both kinds of sets, and hooks decide which edges are
+ * followed, what is recorded for each vertex, and when the search stops.
+ */
+namespace garcide::summit_search {
+
+/**
+ * @brief A breadth-first search of the graph of a summit set.
+ *
+ * `Graph` describes the summit set. It must define types `Factor`, `Braid`
+ * and `Set` (the set of vertices found so far, with member functions
+ * `void insert(const std::vector<Braid> &)` and `bool mem(const Braid &)`),
+ * and static member functions
+ * `std::vector<Braid> trajectory(const Braid &b)`, that computes the vertex of
+ * `b`, and
+ * `std::vector<Factor> neighbours(const Braid &b, const Braid &b_rcf)`, that
+ * computes the minimal simple conjugators at `b` (given in LCF and in RCF).
+ *
+ * `Hooks` has member functions `bool filter(const Braid &b)`, that says if an
+ * edge to `b` (which was not found yet) is followed, and
+ * `bool found(const Set &set, const std::vector<Braid> &t, size_t index,
+ * size_t parent, const Factor &f)`, that is called when vertex `t` is found,
+ * with its index (in the order vertices are found) and the index of the
+ * vertex it was found from through an edge labelled `f`. The first vertex has
+ * index 0, and is found from itself through the identity. If `found` returns
+ * `true`, the search stops.
+ *
+ * @tparam Graph A class describing the graph.
+ * @tparam Hooks A class of hooks.
+ */
+template <class Graph, class Hooks> class BreadthFirstSearch {
+  public:
+    /**
+     * @brief Factor type.
+     */
+    using Factor = typename Graph::Factor;
+
+    /**
+     * @brief Braid type.
+     */
+    using Braid = typename Graph::Braid;
+
+    /**
+     * @brief Vertex set type.
+     */
+    using Set = typename Graph::Set;
+
+  private:
+    /**
+     * @brief The vertices that were found so far.
+     */
+    Set visited;
+
+    /**
+     * @brief The hooks.
+     */
+    Hooks callbacks;
+
+    /**
+     * @brief Whether vertices are closed under conjugation by \f$\Delta\f$.
+     */
+    bool with_delta;
+
+    /**
+     * @brief Whether a hook stopped the search.
+     */
+    bool stopped = false;
+
+    /**
+     * @brief The number of vertices that were found so far.
+     */
+    size_t number_of_vertices = 0;
+
+    /**
+     * @brief Bases of vertices that were found, but whose neighbours were
+     * not.
+     */
+    std::list<Braid> queue;
+
+    /**
+     * @brief The elements of `queue`, in RCF.
+     */
+    std::list<Braid> queue_rcf;
+
+    /**
+     * @brief The indices of the elements of `queue`.
+     */
+    std::list<size_t> queue_indices;
+
+    /**
+     * @brief Adds the vertex of `b`, if it was not found already (and its
+     * conjugate by \f$\Delta\f$, if `with_delta` is set).
+     *
+     * @param b A braid in the summit set.
+     * @param b_rcf `b` in RCF.
+     * @param parent The index of the vertex `b` is found from.
+     * @param f The label of the edge `b` is found through.
+     */
+    void visit(Braid b, Braid b_rcf, size_t parent, const Factor &f) {
+        if (stopped || visited.mem(b)) {
+            return;
+        }
+
+        std::vector<Braid> t = Graph::trajectory(b);
+        visited.insert(t);
+        size_t index = number_of_vertices++;
+        queue.push_back(b);
+        queue_rcf.push_back(b_rcf);
+        queue_indices.push_back(index);
+        if (callbacks.found(visited, t, index, parent, f)) {
+            stopped = true;
+            return;
+        }
+
+        if (with_delta) {
+            Factor delta = Factor(b.get_parameter());
+            delta.delta();
+            b.conjugate(delta);
+            if (!visited.mem(b) && callbacks.filter(b)) {
+                b_rcf.conjugate_rcf(delta);
+                visit(b, b_rcf, index, delta);
+            }
+        }
+    }
+
+  public:
+    /**
+     * @brief Starts a search from `b`.
+     *
+     * Only the vertex of `b` (and, if `with_delta` is set, of its conjugate
+     * by \f$\Delta\f$) is found.
+     *
+     * @param b A braid in the summit set, which is not sent there.
+     * @param hooks The hooks.
+     * @param with_delta Whether vertices are closed under conjugation by
+     * \f$\Delta\f$ (each one is then found along with its conjugate).
+     */
+    BreadthFirstSearch(const Braid &b, Hooks hooks, bool with_delta = false)
+        : callbacks(hooks), with_delta(with_delta) {
+        Braid b_rcf = b;
+        b_rcf.lcf_to_rcf();
+        Factor identity = Factor(b.get_parameter());
+        identity.identity();
+        visit(b, b_rcf, 0, identity);
+    }
+
+    /**
+     * @brief Finds the neighbours of the first vertex in the queue.
+     *
+     * @return If there was a vertex to expand (that is, if the search was
+     * neither over nor stopped).
+     */
+    bool step() {
+        if (stopped || queue.empty()) {
+            return false;
+        }
+        checkpoint();
+        std::vector<Factor> min =
+            Graph::neighbours(queue.front(), queue_rcf.front());
+
+        for (typename std::vector<Factor>::iterator itf = min.begin();
+             itf != min.end() && !stopped; itf++) {
+            Braid b2 = queue.front();
+            b2.conjugate(*itf);
+
+            if (!visited.mem(b2) && callbacks.filter(b2)) {
+                Braid b2_rcf = queue_rcf.front();
+                b2_rcf.conjugate_rcf(*itf);
+                visit(b2, b2_rcf, queue_indices.front(), *itf);
+            }
+        }
+
+        queue.pop_front();
+        queue_rcf.pop_front();
+        queue_indices.pop_front();
+        return true;
+    }
+
+    /**
+     * @brief Runs the search until it is over, or a hook stops it.
+     *
+     * @return A reference to `*this`.
+     */
+    inline BreadthFirstSearch &run() {
+        while (step()) {
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Checks if a hook stopped the search.
+     *
+     * @return If a hook stopped the search.
+     */
+    inline bool is_stopped() const { return stopped; }
+
+    /**
+     * @brief The vertices that were found so far.
+     *
+     * @return A reference to the set of the vertices found so far.
+     */
+    inline Set &set() { return visited; }
+
+    /**
+     * @brief The hooks.
+     *
+     * @return A reference to the hooks.
+     */
+    inline Hooks &hooks() { return callbacks; }
+};
+
+/**
+ * @brief Hooks that follow every edge, record nothing and never stop.
+ *
+ * @tparam B A class representing braids.
+ * @tparam F A class representing factors.
+ */
+template <class B, class F> struct NoHooks {
+    /**
+     * @brief Follows every edge.
+     *
+     * @return `true`.
+     */
+    inline bool filter(const B &) const { return true; }
+
+    /**
+     * @brief Never stops.
+     *
+     * @return `false`.
+     */
+    template <class Set>
+    inline bool found(const Set &, const std::vector<B> &, size_t, size_t,
+                      const F &) const {
+        return false;
+    }
+};
+
+/**
+ * @brief Hooks that record the BFS tree, as `mins` and `prev` vectors.
+ *
+ * `prev[i]` is the index of the vertex the `i`-th one was found from, and
+ * `mins[i]` the label of the edge between them (that conjugates the base of
+ * the former to the base of the latter). `mins[0]` is the identity, and
+ * `prev[0]` is 0.
+ *
+ * If `rigid_only` is set, only edges to rigid braids are followed. If
+ * `target` is not null, the search stops as soon as the vertex of `*target`
+ * is found.
+ *
+ * @tparam B A class representing braids.
+ * @tparam F A class representing factors.
+ */
+template <class B, class F> struct TreeHooks {
+    /**
+     * @brief The labels of the edges of the tree.
+     */
+    std::vector<F> *mins;
+
+    /**
+     * @brief The indices of the parents in the tree.
+     */
+    std::vector<i16> *prev;
+
+    /**
+     * @brief Whether only edges to rigid braids are followed.
+     */
+    bool rigid_only = false;
+
+    /**
+     * @brief A braid whose vertex stops the search when it is found, or null.
+     */
+    const B *target = nullptr;
+
+    /**
+     * @brief Says if an edge is followed.
+     *
+     * @param b The target of the edge.
+     * @return If `b` is rigid, or `rigid_only` is not set.
+     */
+    inline bool filter(const B &b) const { return !rigid_only || b.is_rigid(); }
+
+    /**
+     * @brief Records a vertex in the tree.
+     *
+     * @param set The vertices found so far.
+     * @param parent The index of the vertex it was found from.
+     * @param f The label of the edge it was found through.
+     * @return If `*target` was found.
+     */
+    template <class Set>
+    bool found(const Set &set, const std::vector<B> &, size_t,
+               size_t parent, const F &f) {
+        mins->push_back(f);
+        prev->push_back(i16(parent));
+        return target != nullptr && set.mem(*target);
+    }
+};
+
+/**
+ * @brief Hooks that compute a conjugator to each vertex, and keep the
+ * vertices that were found, for lazy ranges to yield.
+ *
+ * @tparam B A class representing braids.
+ * @tparam F A class representing factors.
+ * @tparam V The type of the yielded values, that must be constructible from
+ * the trajectory of a vertex and a conjugator to it.
+ */
+template <class B, class F, class V> struct PendingHooks {
+    /**
+     * @brief The conjugators to the vertices, by index.
+     */
+    std::vector<B> conjugators;
+
+    /**
+     * @brief The vertices that were found, but not yielded yet.
+     */
+    std::list<V> pending;
+
+    /**
+     * @brief Constructs the hooks.
+     *
+     * @param c The conjugator to the first vertex.
+     */
+    PendingHooks(const B &c) : conjugators(1, c) {}
+
+    /**
+     * @brief Follows every edge.
+     *
+     * @return `true`.
+     */
+    inline bool filter(const B &) const { return true; }
+
+    /**
+     * @brief Computes a conjugator to a vertex, and keeps it.
+     *
+     * @param t The vertex.
+     * @param index The index of the vertex.
+     * @param parent The index of the vertex it was found from.
+     * @param f The label of the edge it was found through.
+     * @return `false`.
+     */
+    template <class Set>
+    bool found(const Set &, const std::vector<B> &t, size_t index,
+               size_t parent, const F &f) {
+        if (index > 0) {
+            B c = conjugators[parent];
+            c.right_multiply(f);
+            conjugators.push_back(c);
+        }
+        pending.push_back(V{t, conjugators[index]});
+        return false;
+    }
+};
+
+} // namespace garcide::summit_search
+
+#endif
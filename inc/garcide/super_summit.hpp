@@ -117,7 +117,7 @@ BraidTemplate<F> send_to_super_summit(const BraidTemplate<F> &b,
             return b2;
         }
 
-        c2.right_multiply(b2.first().delta_conjugate(b2.inf()));
+        c2.right_multiply(b2.initial());
         b2.cycling();
 
         if (b2.inf() == p) {
@@ -232,13 +232,31 @@ std::vector<F> min_super_summit(const BraidTemplate<F> &b,
 
     std::transform(
         atoms.begin(), atoms.end(), factors.begin(),
-        [&b, &b_rcf](F &atom) { return min_super_summit(b, b_rcf, atom); });
+        [&b, &b_rcf](F &atom) {
+            // The result is assigned to a factor from outside the arena, that
+            // braids and factors created for this atom then do not outlive.
+            F f = atom;
+            {
+                ScratchArena arena;
+                f = min_super_summit(b, b_rcf, atom);
+            }
+            return f;
+        });
 
 #else
 
     std::transform(
         std::execution::par, atoms.begin(), atoms.end(), factors.begin(),
-        [&b, &b_rcf](F &atom) { return min_super_summit(b, b_rcf, atom); });
+        [&b, &b_rcf](F &atom) {
+            // The result is assigned to a factor from outside the arena, that
+            // braids and factors created for this atom then do not outlive.
+            F f = atom;
+            {
+                ScratchArena arena;
+                f = min_super_summit(b, b_rcf, atom);
+            }
+            return f;
+        });
 
 #endif
 
@@ -421,6 +439,7 @@ SuperSummitSet<BraidTemplate<F>> super_summit_set(const BraidTemplate<F> &b) {
     sss.insert(b2);
 
     while (!queue.empty()) {
+        checkpoint();
         std::vector<F> min = min_super_summit(queue.front(), queue_rcf.front());
 
         for (typename std::vector<F>::iterator itf = min.begin();
@@ -445,6 +464,183 @@ SuperSummitSet<BraidTemplate<F>> super_summit_set(const BraidTemplate<F> &b) {
     return sss;
 }
 
+/**
+ * @brief A super summit conjugate, with a conjugator.
+ *
+ * @tparam B A class representing braids.
+ */
+template <class B> struct Conjugate {
+    /**
+     * @brief The conjugate.
+     */
+    B braid;
+
+    /**
+     * @brief A conjugator \f$c\f$, such that \f$c^{-1}bc\f$ is `braid`, where
+     * \f$b\f$ is the braid the conjugate was computed from.
+     */
+    B conjugator;
+};
+
+/**
+ * @brief A lazy range over the super summit set of a braid.
+ *
+ * The super summit set is explored breadth-first, as in `super_summit_set`,
+ * but only as far as is needed to yield the elements that are pulled: each
+ * element is yielded with a conjugator, as soon as it is found. Iterating only
+ * through the first elements is then much cheaper than computing the whole
+ * set, and the exploration may be stopped at any point.
+ *
+ * This is a single-pass range: elements are pulled from it, and are not
+ * yielded again by a second iteration.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> class LazySuperSummitSet {
+  public:
+    /**
+     * @brief Type of the yielded values.
+     */
+    using value_type = Conjugate<BraidTemplate<F>>;
+
+    /**
+     * @brief Iterator type.
+     */
+    using Iterator = PullIterator<LazySuperSummitSet>;
+
+  private:
+    /**
+     * @brief The parameter.
+     */
+    typename F::Parameter parameter;
+
+    /**
+     * @brief The elements that were found so far.
+     */
+    SuperSummitSet<BraidTemplate<F>> visited;
+
+    /**
+     * @brief Elements that were found, but whose neighbours were not.
+     */
+    std::list<BraidTemplate<F>> queue;
+
+    /**
+     * @brief The elements of `queue`, in RCF.
+     */
+    std::list<BraidTemplate<F>> queue_rcf;
+
+    /**
+     * @brief Conjugators to the elements of `queue`.
+     */
+    std::list<BraidTemplate<F>> queue_conjugators;
+
+    /**
+     * @brief Elements that were found, but not yielded yet.
+     */
+    std::list<value_type> pending;
+
+    /**
+     * @brief Finds the neighbours of the first element of `queue`.
+     */
+    void expand() {
+        checkpoint();
+        std::vector<F> min = min_super_summit(queue.front(), queue_rcf.front());
+
+        for (typename std::vector<F>::iterator itf = min.begin();
+             itf != min.end(); itf++) {
+            BraidTemplate<F> b2 = queue.front();
+            b2.conjugate(*itf);
+
+            if (!visited.mem(b2)) {
+                BraidTemplate<F> b2_rcf = queue_rcf.front();
+                b2_rcf.conjugate_rcf(*itf);
+                BraidTemplate<F> c2 = queue_conjugators.front();
+                c2.right_multiply(*itf);
+
+                visited.insert(b2);
+                queue.push_back(b2);
+                queue_rcf.push_back(b2_rcf);
+                queue_conjugators.push_back(c2);
+                pending.push_back(value_type{b2, c2});
+            }
+        }
+
+        queue.pop_front();
+        queue_rcf.pop_front();
+        queue_conjugators.pop_front();
+    }
+
+  public:
+    /**
+     * @brief Constructs a lazy range over the super summit set of `b`.
+     *
+     * Only a super summit conjugate of `b` is computed.
+     *
+     * @param b The braid whose super summit set is iterated through.
+     */
+    LazySuperSummitSet(const BraidTemplate<F> &b)
+        : parameter(b.get_parameter()) {
+        BraidTemplate<F> c = BraidTemplate<F>(parameter);
+        BraidTemplate<F> b2 = send_to_super_summit(b, c);
+        BraidTemplate<F> b2_rcf = b2;
+        b2_rcf.lcf_to_rcf();
+
+        visited.insert(b2);
+        queue.push_back(b2);
+        queue_rcf.push_back(b2_rcf);
+        queue_conjugators.push_back(c);
+        pending.push_back(value_type{b2, c});
+    }
+
+    /**
+     * @brief Pulls the next element.
+     *
+     * @param value Set to the next element, with its conjugator (if there is
+     * one).
+     * @return If there was a next element.
+     */
+    bool next(value_type &value) {
+        while (pending.empty() && !queue.empty()) {
+            expand();
+        }
+        if (pending.empty()) {
+            return false;
+        }
+        value = pending.front();
+        pending.pop_front();
+        return true;
+    }
+
+    /**
+     * @brief Iterator to the next element.
+     *
+     * @return An iterator, that pulls elements from `*this`.
+     */
+    inline Iterator begin() {
+        return Iterator(*this, value_type{parameter, parameter});
+    }
+
+    /**
+     * @brief End iterator.
+     *
+     * @return The end iterator.
+     */
+    inline Iterator end() const { return Iterator(); }
+};
+
+/**
+ * @brief Lazily iterates through the super summit set of `b`.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid.
+ * @return A lazy range over the super summit set of `b`, whose elements come
+ * with conjugators from `b`.
+ */
+template <class F>
+inline LazySuperSummitSet<F> lazy_super_summit_set(const BraidTemplate<F> &b) {
+    return LazySuperSummitSet<F>(b);
+}
+
 /**
  * @brief Checks if two braids are conjugates.
  *
@@ -458,10 +654,99 @@ SuperSummitSet<BraidTemplate<F>> super_summit_set(const BraidTemplate<F> &b) {
 template <class F>
 inline bool are_conjugate(const BraidTemplate<F> &u,
                           const BraidTemplate<F> &v) {
-    std::unordered_set<BraidTemplate<F>> u_sss = super_summit_set(u);
+    SuperSummitSet<BraidTemplate<F>> u_sss = super_summit_set(u);
     return u_sss.mem(send_to_super_summit(v));
 }
 
+/**
+ * @brief Checks if two braids are conjugates, and computes a conjugator.
+ *
+ * `c` is not modified if `b1` and `b2` are not conjugates.
+ *
+ * This function uses super summit sets. The super summit set of `b1` is
+ * explored breadth-first, keeping track of the conjugators that were used,
+ * until the super summit representative of `b2` is met.
+ *
+ * @tparam F A class representing factors.
+ * @param b1 A braid.
+ * @param b2 Another braid.
+ * @param c A braid, that is set by the function to the conjugator that takes
+ * `b1` to `b2`, if it exists.
+ * @return If `b1` and `b2` are conjugates.
+ */
+template <class F>
+bool are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
+                   BraidTemplate<F> &c) {
+    typename F::Parameter n = b1.get_parameter();
+    BraidTemplate<F> c1 = BraidTemplate<F>(n), c2 = BraidTemplate<F>(n);
+
+    BraidTemplate<F> bt1 = send_to_super_summit(b1, c1),
+                     bt2 = send_to_super_summit(b2, c2);
+
+    if (bt1.canonical_length() != bt2.canonical_length() ||
+        bt1.inf() != bt2.inf()) {
+        return false;
+    }
+
+    // Elements of the super summit set, in the order they are found, with
+    // for each of them the factor that conjugates its parent to it.
+    std::vector<BraidTemplate<F>> elements, elements_rcf;
+    std::vector<F> mins;
+    std::vector<size_t> prev;
+    SuperSummitSet<BraidTemplate<F>> sss;
+
+    BraidTemplate<F> b3 = bt1, b3_rcf = bt1;
+    b3_rcf.lcf_to_rcf();
+
+    elements.push_back(b3);
+    elements_rcf.push_back(b3_rcf);
+    mins.push_back(F(n));
+    prev.push_back(0);
+    sss.insert(b3);
+
+    for (size_t current = 0; !sss.mem(bt2); current++) {
+        checkpoint();
+        if (current == elements.size()) {
+            return false;
+        }
+
+        std::vector<F> min =
+            min_super_summit(elements[current], elements_rcf[current]);
+
+        for (typename std::vector<F>::iterator itf = min.begin();
+             itf != min.end(); itf++) {
+            b3 = elements[current];
+            b3.conjugate(*itf);
+
+            if (!sss.mem(b3)) {
+                b3_rcf = elements_rcf[current];
+                b3_rcf.conjugate_rcf(*itf);
+
+                sss.insert(b3);
+                elements.push_back(b3);
+                elements_rcf.push_back(b3_rcf);
+                mins.push_back(*itf);
+                prev.push_back(current);
+            }
+        }
+    }
+
+    size_t current = 0;
+    while (elements[current] != bt2) {
+        current++;
+    }
+
+    BraidTemplate<F> c3 = BraidTemplate<F>(n);
+    while (current != 0) {
+        c3.left_multiply(mins[current]);
+        current = prev[current];
+    }
+
+    c = c1 * c3 * !c2;
+
+    return true;
+}
+
 } // namespace garcide::super_summit
 
 #endif
\ No newline at end of file
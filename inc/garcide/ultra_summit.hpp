@@ -29,7 +29,10 @@
 #ifndef ULTRA_SUMMIT
 #define ULTRA_SUMMIT
 
+#include "garcide/cache.hpp"
+#include "garcide/summit_search.hpp"
 #include "garcide/super_summit.hpp"
+#include <exception>
 
 /**
  * @brief Namespace for ultra summit sets.
@@ -53,9 +56,12 @@ template <class B> struct NotUltraSummit {
     /**
      * @brief Construct a new `NotUltraSummit` exception.
      *
+     * The braid is copied out of any scratch arena, as the exception may
+     * outlive it.
+     *
      * @param b The braid that should have been in its ultra summit set.
      */
-    NotUltraSummit(const B &b) : not_ultra_summit(b) {}
+    NotUltraSummit(const B &b) : not_ultra_summit(copy_outside_arena(b)) {}
 };
 
 /**
@@ -158,7 +164,7 @@ BraidTemplate<F> send_to_ultra_summit(const BraidTemplate<F> &b,
 
     for (typename std::vector<BraidTemplate<F>>::iterator it = t.begin();
          *it != b_uss; it++) {
-        c.right_multiply((*it).first().delta_conjugate(b_sss.inf()));
+        c.right_multiply((*it).initial());
     }
 
     return b_uss;
@@ -206,11 +212,11 @@ std::list<F> transports_sending_to_trajectory(const BraidTemplate<F> &b,
     i16 i, n = 1;
     F f1 = f;
 
-    BraidTemplate<F> c1 = BraidTemplate(b1.first().delta_conjugate(b1.inf()));
+    BraidTemplate<F> c1 = BraidTemplate(b1.initial());
     b1.cycling();
 
     while (b1 != b) {
-        c1.right_multiply(BraidTemplate(b1.first().delta_conjugate(b1.inf())));
+        c1.right_multiply(BraidTemplate(b1.initial()));
         b1.cycling();
         n++;
     }
@@ -222,7 +228,7 @@ std::list<F> transports_sending_to_trajectory(const BraidTemplate<F> &b,
         b1.conjugate(f1);
         c2.identity();
         for (i = 0; i < n; i++) {
-            c2.right_multiply(b1.first().delta_conjugate(b1.inf()));
+            c2.right_multiply(b1.initial());
             b1.cycling();
         }
 
@@ -357,7 +363,7 @@ F min_ultra_summit(const BraidTemplate<F> &b, const BraidTemplate<F> &b_rcf,
 
     std::list<F> ret = transports_sending_to_trajectory(b, f2);
 
-    typename BraidTemplate<F>::FactorItr it;
+    typename std::list<F>::iterator it;
 
     for (it = ret.begin(); it != ret.end(); it++) {
         if ((f ^ *it) == f) {
@@ -402,13 +408,44 @@ std::vector<F> min_ultra_summit(const BraidTemplate<F> &b,
 
     std::transform(
         atoms.begin(), atoms.end(), factors.begin(),
-        [&b, &b_rcf](F &atom) { return min_ultra_summit(b, b_rcf, atom); });
+        [&b, &b_rcf](F &atom) {
+            // The result is assigned to a factor from outside the arena, that
+            // braids and factors created for this atom then do not outlive.
+            F f = atom;
+            {
+                ScratchArena arena;
+                f = min_ultra_summit(b, b_rcf, atom);
+            }
+            return f;
+        });
 
 #else
 
+    // Exceptions cannot cross std::execution::par (`NotUltraSummit` would
+    // terminate the program), so that they are recorded and the first one is
+    // rethrown afterwards.
+    std::vector<std::exception_ptr> failures(atoms.size());
+
     std::transform(
         std::execution::par, atoms.begin(), atoms.end(), factors.begin(),
-        [&b, &b_rcf](F &atom) { return min_ultra_summit(b, b_rcf, atom); });
+        [&b, &b_rcf, &atoms, &failures](F &atom) {
+            // The result is assigned to a factor from outside the arena, that
+            // braids and factors created for this atom then do not outlive.
+            F f = atom;
+            try {
+                ScratchArena arena;
+                f = min_ultra_summit(b, b_rcf, atom);
+            } catch (...) {
+                failures[&atom - atoms.data()] = std::current_exception();
+            }
+            return f;
+        });
+
+    for (const std::exception_ptr &failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
 
 #endif
 
@@ -800,45 +837,208 @@ template <class B> class UltraSummitSet {
 };
 
 /**
- * @brief Computes the ultra summit set of `b`.
+ * @brief Appends an ultra summit set to `str`, for the cache.
+ *
+ * Only the first element of each orbit is written.
  *
  * @tparam F A class representing factors.
- * @param b The braid whose ultra summit set is computed.
- * @return The ultra summit set of `b`.
+ * @param str The string to append to.
+ * @param uss The ultra summit set.
  */
 template <class F>
-UltraSummitSet<BraidTemplate<F>> ultra_summit_set(const BraidTemplate<F> &b) {
+void write(std::string &str, const UltraSummitSet<BraidTemplate<F>> &uss) {
+    cache::write(str, u64(uss.number_of_orbits()));
+    for (size_t orbit_index = 0; orbit_index < uss.number_of_orbits();
+         orbit_index++) {
+        cache::write(str, uss.at(orbit_index, 0));
+    }
+}
+
+/**
+ * @brief Reads an ultra summit set, written by `write`.
+ *
+ * @tparam F A class representing factors.
+ * @param pos The position to read from, that is moved past the set.
+ * @param end The end of the buffer.
+ * @param n The parameter of the braids in the set.
+ * @return The ultra summit set.
+ * @exception cache::CorruptEntry Thrown if the buffer does not hold an ultra
+ * summit set.
+ */
+template <class F>
+UltraSummitSet<BraidTemplate<F>> read(const char *&pos, const char *end,
+                                      typename F::Parameter n) {
     UltraSummitSet<BraidTemplate<F>> uss;
-    std::list<BraidTemplate<F>> queue, queue_rcf;
+    BraidTemplate<F> b = BraidTemplate<F>(n);
+    u64 number_of_orbits = cache::read(pos, end);
+    for (u64 orbit_index = 0; orbit_index < number_of_orbits; orbit_index++) {
+        cache::read(pos, end, b);
+        uss.insert(trajectory(b));
+    }
+    return uss;
+}
 
-    BraidTemplate<F> b2 = send_to_ultra_summit(b);
-    BraidTemplate<F> b2_rcf = b2;
-    b2_rcf.lcf_to_rcf();
+/**
+ * @brief Looks the ultra summit set of `b` up in the cache, with the tree
+ * of the graph BFS that computed it.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid in its ultra summit set, that the BFS started from.
+ * @param set Set by the function to the ultra summit set of `b`, if it is
+ * found.
+ * @param mins Set by the function as by `ultra_summit_set`, if it is found.
+ * @param prev Set by the function as by `ultra_summit_set`, if it is found.
+ * @return If the set was found.
+ */
+template <class F>
+bool load_from_cache(const BraidTemplate<F> &b,
+                     UltraSummitSet<BraidTemplate<F>> &set,
+                     std::vector<F> &mins, std::vector<i16> &prev) {
+    cache::Entry entry;
+    if (!cache::is_enabled() ||
+        !cache::load(cache::key("ultra_summit_tree 1", b), entry)) {
+        return false;
+    }
+    const char *pos = entry.data(), *end = pos + entry.size();
+    typename F::Parameter n = b.get_parameter();
+    try {
+        UltraSummitSet<BraidTemplate<F>> s = read<F>(pos, end, n);
+        std::vector<F> m(1, F(n));
+        std::vector<i16> p(1, 0);
+        m[0].identity();
+        F f = F(n);
+        std::vector<F> atoms = f.atoms();
+        for (size_t i = 1; i < s.number_of_orbits(); i++) {
+            cache::read(pos, end, f, atoms);
+            u64 j = cache::read(pos, end);
+            if (j >= i) {
+                throw cache::CorruptEntry();
+            }
+            m.push_back(f);
+            p.push_back(i16(j));
+        }
+        set = s;
+        mins = m;
+        prev = p;
+        return true;
+    } catch (cache::CorruptEntry const &) {
+        return false;
+    }
+}
 
-    uss.insert(trajectory(b2));
-    queue.push_back(b2);
-    queue_rcf.push_back(b2_rcf);
+/**
+ * @brief Stores the ultra summit set of `b` in the cache, with the tree of
+ * the graph BFS that computed it.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid in its ultra summit set, that the BFS started from.
+ * @param set The ultra summit set of `b`.
+ * @param mins As set by `ultra_summit_set`.
+ * @param prev As set by `ultra_summit_set`.
+ */
+template <class F>
+void store_in_cache(const BraidTemplate<F> &b,
+                    const UltraSummitSet<BraidTemplate<F>> &set,
+                    const std::vector<F> &mins, const std::vector<i16> &prev) {
+    if (!cache::is_enabled()) {
+        return;
+    }
+    std::vector<F> atoms = F(b.get_parameter()).atoms();
+    std::string value;
+    write(value, set);
+    for (size_t i = 1; i < mins.size(); i++) {
+        cache::write(value, mins[i], atoms);
+        cache::write(value, u64(prev[i]));
+    }
+    cache::store(cache::key("ultra_summit_tree 1", b), value);
+}
 
-    while (!queue.empty()) {
-        std::vector<F> min = min_ultra_summit(queue.front(), queue_rcf.front());
+/**
+ * @brief The graph of ultra summit sets, for
+ * `summit_search::BreadthFirstSearch`.
+ *
+ * Its vertices are orbits for cycling, and its edges are given by
+ * `min_ultra_summit`.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> struct UltraSummitGraph {
+    /**
+     * @brief Factor type.
+     */
+    using Factor = F;
+
+    /**
+     * @brief Braid type.
+     */
+    using Braid = BraidTemplate<F>;
+
+    /**
+     * @brief Vertex set type.
+     */
+    using Set = UltraSummitSet<BraidTemplate<F>>;
 
-        for (typename std::vector<F>::iterator itf = min.begin();
-             itf != min.end(); itf++) {
-            b2 = queue.front();
-            b2.conjugate(*itf);
+    /**
+     * @brief Computes the orbit of `b`.
+     *
+     * @param b A braid in its ultra summit set.
+     * @return The orbit of `b`.
+     */
+    static inline std::vector<Braid> trajectory(const Braid &b) {
+        return ultra_summit::trajectory(b);
+    }
+
+    /**
+     * @brief Computes the ultra summit indecomposable conjugators at `b`.
+     *
+     * @param b A braid in its ultra summit set.
+     * @param b_rcf `b` in RCF.
+     * @return The ultra summit indecomposable conjugators at `b`.
+     */
+    static inline std::vector<F> neighbours(const Braid &b,
+                                            const Braid &b_rcf) {
+        return min_ultra_summit(b, b_rcf);
+    }
+};
 
-            if (!uss.mem(b2)) {
-                b2_rcf = queue_rcf.front();
-                b2_rcf.conjugate_rcf(*itf);
+/**
+ * @brief Computes the ultra summit set of `b`.
+ *
+ * If the cache is enabled, the result is looked up there first, and stored
+ * there afterwards.
+ *
+ * @tparam F A class representing factors.
+ * @param b The braid whose ultra summit set is computed.
+ * @return The ultra summit set of `b`.
+ */
+template <class F>
+UltraSummitSet<BraidTemplate<F>> ultra_summit_set(const BraidTemplate<F> &b) {
+    BraidTemplate<F> b2 = send_to_ultra_summit(b);
 
-                uss.insert(trajectory(b2));
-                queue.push_back(b2);
-                queue_rcf.push_back(b2_rcf);
+    std::string key;
+    if (cache::is_enabled()) {
+        key = cache::key("ultra_summit_set 1", b2);
+        cache::Entry entry;
+        if (cache::load(key, entry)) {
+            const char *pos = entry.data();
+            try {
+                return read<F>(pos, pos + entry.size(), b.get_parameter());
+            } catch (cache::CorruptEntry const &) {
             }
         }
-        queue.pop_front();
-        queue_rcf.pop_front();
     }
+
+    summit_search::BreadthFirstSearch<
+        UltraSummitGraph<F>, summit_search::NoHooks<BraidTemplate<F>, F>>
+        search(b2, {});
+    UltraSummitSet<BraidTemplate<F>> &uss = search.run().set();
+
+    if (cache::is_enabled()) {
+        std::string value;
+        write(value, uss);
+        cache::store(key, value);
+    }
+
     return uss;
 }
 
@@ -850,6 +1050,9 @@ UltraSummitSet<BraidTemplate<F>> ultra_summit_set(const BraidTemplate<F> &b) {
  * one in the graph BFS of its ultra summit set, and `mins[i]` the corresponding
  * conjugator.
  *
+ * If the cache is enabled, the result (with `mins` and `prev`) is looked up
+ * there first, and stored there afterwards.
+ *
  * @tparam F A class representing factors.
  * @param b The braid whose ultra summit set is computed.
  * @param mins A vector that is set to contain, for each `i`, an element that
@@ -864,49 +1067,200 @@ UltraSummitSet<BraidTemplate<F>> ultra_summit_set(const BraidTemplate<F> &b,
                                                   std::vector<F> &mins,
                                                   std::vector<i16> &prev) {
     UltraSummitSet<BraidTemplate<F>> uss;
-    std::list<BraidTemplate<F>> queue, queue_rcf;
-
-    i16 current = 0;
     mins.clear();
     prev.clear();
-    mins.push_back(F(b.get_parameter()));
-    mins[0].identity();
-    prev.push_back(0);
 
     BraidTemplate<F> b2 = send_to_ultra_summit(b);
-    BraidTemplate<F> b2_rcf = b2;
-    b2_rcf.lcf_to_rcf();
+    if (load_from_cache(b2, uss, mins, prev)) {
+        return uss;
+    }
 
-    uss.insert(trajectory(b2));
-    queue.push_back(b2);
-    queue_rcf.push_back(b2_rcf);
+    summit_search::BreadthFirstSearch<
+        UltraSummitGraph<F>, summit_search::TreeHooks<BraidTemplate<F>, F>>
+        search(b2, {&mins, &prev});
+    uss = search.run().set();
 
-    while (!queue.empty()) {
-        std::vector<F> min = min_ultra_summit(queue.front(), queue_rcf.front());
+    store_in_cache(b2, uss, mins, prev);
 
-        for (typename std::vector<F>::iterator itf = min.begin();
-             itf != min.end(); itf++) {
-            b2 = queue.front();
-            b2.conjugate(*itf);
+    return uss;
+}
 
-            if (!uss.mem(b2)) {
-                b2_rcf = queue_rcf.front();
-                b2_rcf.conjugate_rcf(*itf);
+/**
+ * @brief An orbit for cycling in an ultra summit set, with a conjugator.
+ *
+ * @tparam B A class representing braids.
+ */
+template <class B> struct Orbit {
+    /**
+     * @brief The orbit, in cycling order.
+     */
+    std::vector<B> orbit;
 
-                uss.insert(trajectory(b2));
-                queue.push_back(b2);
-                queue_rcf.push_back(b2_rcf);
+    /**
+     * @brief A conjugator \f$c\f$, such that \f$c^{-1}bc\f$ is the first
+     * element of `orbit`, where \f$b\f$ is the braid the orbit was computed
+     * from.
+     *
+     * Conjugators to the other elements follow by appending the initial
+     * factors of the preceding ones (that is, by cycling).
+     */
+    B conjugator;
+};
 
-                mins.push_back(*itf);
-                prev.push_back(current);
-            }
+/**
+ * @brief A lazy range over the ultra summit set of a braid.
+ *
+ * The ultra summit set is explored breadth-first, as in `ultra_summit_set`,
+ * but only as far as is needed to yield the orbits that are pulled: each orbit
+ * is yielded with a conjugator, as soon as it is found. Iterating only through
+ * the first orbits is then much cheaper than computing the whole set, and the
+ * exploration may be stopped at any point.
+ *
+ * The cache is not used.
+ *
+ * This is a single-pass range: orbits are pulled from it, and are not yielded
+ * again by a second iteration.
+ *
+ * @tparam F A class representing factors.
+ */
+template <class F> class LazyUltraSummitSet {
+  public:
+    /**
+     * @brief Type of the yielded values.
+     */
+    using value_type = Orbit<BraidTemplate<F>>;
+
+    /**
+     * @brief Iterator type.
+     */
+    using Iterator = PullIterator<LazyUltraSummitSet>;
+
+  private:
+    /**
+     * @brief Type of the search.
+     */
+    using Search = summit_search::BreadthFirstSearch<
+        UltraSummitGraph<F>,
+        summit_search::PendingHooks<BraidTemplate<F>, F, value_type>>;
+
+    /**
+     * @brief The parameter.
+     */
+    typename F::Parameter parameter;
+
+    /**
+     * @brief The search, whose hooks keep the orbits that were found but not
+     * yielded yet.
+     */
+    Search search;
+
+    /**
+     * @brief Starts the search from an ultra summit conjugate of `b`.
+     *
+     * @param b A braid.
+     * @return The search.
+     */
+    static Search start(const BraidTemplate<F> &b) {
+        BraidTemplate<F> c = BraidTemplate<F>(b.get_parameter());
+        BraidTemplate<F> b2 = send_to_ultra_summit(b, c);
+        return Search(
+            b2, summit_search::PendingHooks<BraidTemplate<F>, F, value_type>(c));
+    }
+
+  public:
+    /**
+     * @brief Constructs a lazy range over the ultra summit set of `b`.
+     *
+     * Only an ultra summit conjugate of `b` (and its orbit) is computed.
+     *
+     * @param b The braid whose ultra summit set is iterated through.
+     */
+    LazyUltraSummitSet(const BraidTemplate<F> &b)
+        : parameter(b.get_parameter()), search(start(b)) {}
+
+    /**
+     * @brief Pulls the next orbit.
+     *
+     * @param value Set to the next orbit, with its conjugator (if there is
+     * one).
+     * @return If there was a next orbit.
+     */
+    bool next(value_type &value) {
+        std::list<value_type> &pending = search.hooks().pending;
+        while (pending.empty() && search.step()) {
+        }
+        if (pending.empty()) {
+            return false;
         }
-        queue.pop_front();
-        queue_rcf.pop_front();
+        value = pending.front();
+        pending.pop_front();
+        return true;
+    }
 
-        current++;
+    /**
+     * @brief Iterator to the next orbit.
+     *
+     * @return An iterator, that pulls orbits from `*this`.
+     */
+    inline Iterator begin() {
+        return Iterator(*this, value_type{{}, parameter});
     }
-    return uss;
+
+    /**
+     * @brief End iterator.
+     *
+     * @return The end iterator.
+     */
+    inline Iterator end() const { return Iterator(); }
+};
+
+/**
+ * @brief Lazily iterates through the ultra summit set of `b`, orbit by orbit.
+ *
+ * @tparam F A class representing factors.
+ * @param b A braid.
+ * @return A lazy range over the orbits of the ultra summit set of `b`, that
+ * come with conjugators from `b`.
+ */
+template <class F>
+inline LazyUltraSummitSet<F> lazy_ultra_summit_set(const BraidTemplate<F> &b) {
+    return LazyUltraSummitSet<F>(b);
+}
+
+/**
+ * @brief Explores the rigid part of the ultra summit set of `b`, until `b2` is
+ * reached.
+ *
+ * This is the same graph BFS as for `ultra_summit_set`, except that `b` is
+ * assumed to be rigid and in its ultra summit set (it is not sent there
+ * again), that edges whose target is not rigid are pruned, and that the
+ * exploration stops as soon as the orbit of `b2` is found.
+ *
+ * `mins` and `prev` are set as in `ultra_summit_set`, so that `tree_path` can
+ * be used on the result.
+ *
+ * @tparam F A class representing factors.
+ * @param b A rigid braid, in its ultra summit set.
+ * @param b2 The braid that is searched for.
+ * @param mins A vector that is set to contain, for each `i`, an element that
+ * conjugates the base of orbit `prev[i]` to the base of orbit `i`.
+ * @param prev A vector that is set to contain integers, such that, for each
+ * `i`, `mins[i]` conjugates the base of orbit `prev[i]` to the base of orbit
+ * `i`.
+ * @return The part of the rigid ultra summit conjugates of `b` that was
+ * explored. It contains `b2` if and only if `b2` was found.
+ */
+template <class F>
+UltraSummitSet<BraidTemplate<F>>
+rigid_ultra_summit_set(const BraidTemplate<F> &b, const BraidTemplate<F> &b2,
+                       std::vector<F> &mins, std::vector<i16> &prev) {
+    mins.clear();
+    prev.clear();
+
+    summit_search::BreadthFirstSearch<
+        UltraSummitGraph<F>, summit_search::TreeHooks<BraidTemplate<F>, F>>
+        search(b, {&mins, &prev, true, &b2});
+    return search.run().set();
 }
 
 /**
@@ -953,7 +1307,10 @@ BraidTemplate<F> tree_path(const BraidTemplate<F> &b,
  *
  * `c` is not modified if `b1` and `b2` are not conjugates.
  *
- * This function uses ultra summit sets.
+ * This function uses ultra summit sets. If the ultra summit representatives
+ * that are computed are both rigid, only rigid elements are explored at first,
+ * and the whole ultra summit set is only computed if that fails. If the cache
+ * holds the ultra summit set, it is used directly instead.
  *
  * @tparam F A class representing factors.
  * @param b1 A braid.
@@ -965,7 +1322,7 @@ BraidTemplate<F> tree_path(const BraidTemplate<F> &b,
 template <class F>
 bool are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
                    BraidTemplate<F> &c) {
-    i16 n = b1.get_parameter();
+    typename F::Parameter n = b1.get_parameter();
     BraidTemplate<F> c1 = BraidTemplate<F>(n), c2 = BraidTemplate<F>(n);
 
     BraidTemplate<F> bt1 = send_to_ultra_summit(b1, c1),
@@ -984,7 +1341,26 @@ bool are_conjugate(const BraidTemplate<F> &b1, const BraidTemplate<F> &b2,
     std::vector<F> mins;
     std::vector<i16> prev;
 
-    UltraSummitSet<BraidTemplate<F>> uss = ultra_summit_set(bt1, mins, prev);
+    // A cached ultra summit set is cheaper to use than any exploration.
+    UltraSummitSet<BraidTemplate<F>> uss;
+    bool cached = load_from_cache(bt1, uss, mins, prev);
+
+    // If both ultra summit representatives are rigid, we first look for a
+    // conjugator among rigid elements only, which are often much fewer than
+    // the whole ultra summit set.
+    if (!cached && bt1.is_rigid() && bt2.is_rigid()) {
+        UltraSummitSet<BraidTemplate<F>> rss =
+            rigid_ultra_summit_set(bt1, bt2, mins, prev);
+
+        if (rss.mem(bt2)) {
+            c = c1 * tree_path(bt2, rss, mins, prev) * !c2;
+            return true;
+        }
+    }
+
+    if (!cached) {
+        uss = ultra_summit_set(bt1, mins, prev);
+    }
 
     if (!uss.mem(bt2)) {
         return false;
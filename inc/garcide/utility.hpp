@@ -36,11 +36,18 @@
 
 #endif
 
+#include <atomic>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
 #include <ostream>
+#include <random>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace garcide {
 
@@ -163,6 +170,54 @@ inline i16 rem(i16 a, i16 b) {
     return r >= 0 ? r : r + (b >= 0 ? b : -b);
 };
 
+/**
+ * @brief Writes a 16-bit integer, little-endian (for packed factors).
+ *
+ * @param out Where the 2 bytes are written.
+ * @param x The integer, in \f$[\![0, 2^{16}-1]\!]\f$.
+ */
+inline void pack_u16(u8 *out, u16 x) {
+    out[0] = u8(x & 0xff);
+    out[1] = u8((x >> 8) & 0xff);
+}
+
+/**
+ * @brief Reads a 16-bit integer, little-endian (for packed factors).
+ *
+ * @param in Where the 2 bytes are read.
+ * @return The integer.
+ */
+inline u16 unpack_u16(const u8 *in) { return u16(in[0]) | (u16(in[1]) << 8); }
+
+/**
+ * @brief Checks if a table is a permutation of \f$[\![a, b]\!]\f$.
+ *
+ * Used to validate packed factors.
+ *
+ * @param table The table, whose entries `table[a]` to `table[b]` are read.
+ * @param a The first index.
+ * @param b The last index.
+ * @return If these entries are the integers from `a` to `b`, each once.
+ */
+bool is_permutation_table(const i16 *table, i16 a, i16 b);
+
+/**
+ * @brief Checks if a partition of \f$[\![1, m]\!]\f$ is non-crossing, when
+ * the integers are placed around a circle.
+ *
+ * Used to validate packed factors, for dual structures. The partition is
+ * represented by an array `x`, such that `x[i]` and `x[j]` are equal if and
+ * only if `i` and `j` are in the same cell, with entries in
+ * \f$[\![0, m]\!]\f$.
+ *
+ * Linear in \f$m\f$.
+ *
+ * @param x The array, whose entries `x[1]` to `x[m]` are read.
+ * @param m The number of integers.
+ * @return If the partition is non-crossing.
+ */
+bool is_noncrossing(const i16 *x, i16 m);
+
 /**
  * @brief Exception thrown in case of bad input.
  *
@@ -196,6 +251,285 @@ struct InvalidStringError {
  */
 struct NonRandomizable {};
 
+/**
+ * @brief The random number generator used by `randomize` member functions.
+ *
+ * Each thread has its own generator, seeded from `std::random_device` the
+ * first time the thread uses it, so that threads may randomize concurrently.
+ *
+ * @return A reference to the generator of the calling thread.
+ */
+std::mt19937_64 &random_engine();
+
+/**
+ * @brief Seeds the random number generator of the calling thread.
+ *
+ * This makes the factors and braids it then randomizes reproducible. Other
+ * threads are not affected.
+ *
+ * @param seed The seed.
+ */
+void seed_random_engine(u64 seed);
+
+/**
+ * @brief Draws an integer uniformly at random.
+ *
+ * Thread-safe, as it draws from `random_engine()`.
+ *
+ * @warning `bound` must be positive.
+ *
+ * @param bound An upper bound.
+ * @return An integer in \f$[0, \mathtt{bound}[\f$.
+ */
+inline u64 random_below(u64 bound) {
+    return std::uniform_int_distribution<u64>(0, bound - 1)(random_engine());
+}
+
+/**
+ * @brief Enables or disables the vectorized kernels of the library.
+ *
+ * Meets in `artin` and products in `dual_complex` and `standard_complex` have
+ * vectorized kernels, that are used if the machine supports them. Disabling
+ * them makes these operations fall back to their scalar code, so that both
+ * can be compared. They are enabled by default.
+ *
+ * The switch is shared by all threads (it is atomic, so that this is safe),
+ * and is meant to be flipped between computations rather than during them.
+ *
+ * @param enabled Whether the kernels may be used.
+ */
+void set_simd_kernels(bool enabled);
+
+/**
+ * @brief Checks if the vectorized kernels of the library may be used.
+ *
+ * Thread-safe.
+ *
+ * @return The value last passed to `set_simd_kernels`, `true` by default.
+ */
+bool simd_kernels();
+
+/**
+ * @brief Size of the buffer that each thread keeps for its scratch arenas, in
+ * bytes.
+ */
+const size_t SCRATCH_BUFFER_SIZE = size_t(1) << 16;
+
+/**
+ * @brief The memory resource that braids and factors allocate from, by
+ * default, on the calling thread.
+ *
+ * This is the arena of the innermost live `ScratchArena` on the calling
+ * thread, if there is one, and `std::pmr::get_default_resource()` otherwise.
+ *
+ * @return A pointer to the resource.
+ */
+std::pmr::memory_resource *current_resource();
+
+/**
+ * @brief Scratch arena for short-lived braids and factors.
+ *
+ * While it lives, braids and factors that are created on the calling thread
+ * (including copies) allocate from a monotonic arena, that is released at once
+ * when it is destroyed. The first `SCRATCH_BUFFER_SIZE` bytes are taken from a
+ * buffer that the thread keeps from one arena to the next, so that small
+ * computations do not allocate at all.
+ *
+ * It must only be used around computations whose braids and factors do not
+ * outlive it: results that should be kept must be assigned to objects that
+ * were created before it (assignment keeps the memory resource of the target),
+ * or copied with an explicit memory resource.
+ */
+class ScratchArena {
+  private:
+    /**
+     * @brief The resource braids used before.
+     */
+    std::pmr::memory_resource *outer;
+
+    /**
+     * @brief Whether this arena uses the buffer of the thread.
+     */
+    bool owns_buffer;
+
+    /**
+     * @brief The arena.
+     */
+    std::pmr::monotonic_buffer_resource arena;
+
+  public:
+    /**
+     * @brief Makes braids allocate from a new arena on the calling thread.
+     */
+    ScratchArena();
+
+    /**
+     * @brief Releases the arena, and restores the previous resource.
+     */
+    ~ScratchArena();
+
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+};
+
+/**
+ * @brief Suspends the scratch arenas of the calling thread.
+ *
+ * While it lives, braids and factors that are created on the calling thread
+ * allocate from the default resource again, even within a scratch arena.
+ */
+class ScratchArenaPause {
+  private:
+    /**
+     * @brief The resource braids used before.
+     */
+    std::pmr::memory_resource *outer;
+
+  public:
+    /**
+     * @brief Makes braids allocate from the default resource on the calling
+     * thread.
+     */
+    ScratchArenaPause();
+
+    /**
+     * @brief Restores the previous resource.
+     */
+    ~ScratchArenaPause();
+
+    ScratchArenaPause(const ScratchArenaPause &) = delete;
+    ScratchArenaPause &operator=(const ScratchArenaPause &) = delete;
+};
+
+/**
+ * @brief Copies an object out of the scratch arenas of the calling thread.
+ *
+ * The copy (including the tables of its factors) only allocates from the
+ * default resource, so that it may outlive the current scratch arena.
+ *
+ * @tparam T The type of the object.
+ * @param x The object to be copied.
+ * @return A copy of `x`.
+ */
+template <class T> T copy_outside_arena(const T &x) {
+    ScratchArenaPause pause;
+    return T(x);
+}
+
+/**
+ * @brief A vector, that allocates from `current_resource()`.
+ *
+ * Unlike a `std::pmr::vector`, copies also allocate from the current resource
+ * of the thread that makes them (and not from the one of the original), so
+ * that classes representing underlying factors may use it for their tables
+ * and be copied within scratch arenas. Assignments keep the resource of the
+ * target.
+ *
+ * @tparam T The type of the elements.
+ */
+template <class T> class ResourceVector : public std::pmr::vector<T> {
+  public:
+    /**
+     * @brief Constructs an empty vector.
+     */
+    ResourceVector() : std::pmr::vector<T>(current_resource()) {}
+
+    /**
+     * @brief Constructs a vector of `n` value-initialized elements.
+     *
+     * @param n The size of the vector.
+     */
+    explicit ResourceVector(size_t n)
+        : std::pmr::vector<T>(n, current_resource()) {}
+
+    /**
+     * @brief Constructs a vector of `n` copies of `value`.
+     *
+     * @param n The size of the vector.
+     * @param value The value of the elements.
+     */
+    ResourceVector(size_t n, const T &value)
+        : std::pmr::vector<T>(n, value, current_resource()) {}
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param v The vector to be copied.
+     */
+    ResourceVector(const ResourceVector &v)
+        : std::pmr::vector<T>(v, current_resource()) {}
+
+    /**
+     * @brief Move constructor.
+     *
+     * @param v The vector to be moved.
+     */
+    ResourceVector(ResourceVector &&v) = default;
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * @param v The vector to be copied.
+     * @return A reference to `*this`.
+     */
+    ResourceVector &operator=(const ResourceVector &v) = default;
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param v The vector to be moved.
+     * @return A reference to `*this`.
+     */
+    ResourceVector &operator=(ResourceVector &&v) = default;
+};
+
+/**
+ * @brief Exception thrown by `checkpoint` when the computation that calls it
+ * was cancelled.
+ */
+struct Cancelled {};
+
+/**
+ * @brief Shared state of a computation that runs in the background.
+ *
+ * It is shared between the thread that runs the computation, and the threads
+ * that hold a handle to it (see `async`).
+ */
+struct TaskControl {
+    /**
+     * @brief Whether the computation should stop.
+     */
+    std::atomic<bool> cancelled{false};
+
+    /**
+     * @brief Number of steps of the computation that were taken so far.
+     */
+    std::atomic<u64> steps{0};
+};
+
+/**
+ * @brief The computation that the calling thread runs.
+ *
+ * @return A reference to the control of the computation that the calling
+ * thread runs in the background, or to null.
+ */
+TaskControl *&current_task();
+
+/**
+ * @brief Marks a step of a long computation.
+ *
+ * Algorithms call it once for every vertex of the graphs they explore. If the
+ * calling thread runs a computation in the background, its step count is
+ * incremented, and `Cancelled` is thrown if it was cancelled. Otherwise, this
+ * does nothing.
+ *
+ * It must not be called from within parallel sections (that cannot carry
+ * exceptions).
+ *
+ * @exception Cancelled Thrown if the computation was cancelled.
+ */
+void checkpoint();
+
 /**
  * @brief Forward iterates applications of `f` on pairs of successive elements.
  *
@@ -278,6 +612,130 @@ inline void bubble_sort(ForItr first, ForItr last, BinFun f) {
         apply_binfun(--i, last, f);
 }
 
+/**
+ * @brief Input iterator over the values pulled from a generator.
+ *
+ * A generator is a class `G` with a type member `value_type` and a member
+ * function `bool next(value_type &)`, that sets its argument to the next value
+ * and returns `true`, or returns `false` if there are no more values. Values
+ * are pulled one at a time, as the iterator is incremented, so that a range of
+ * such iterators may be lazy.
+ *
+ * The end iterator is the default-constructed one.
+ *
+ * @tparam G A class of generators.
+ */
+template <class G> class PullIterator {
+  public:
+    /**
+     * @brief Iterator category.
+     */
+    using iterator_category = std::input_iterator_tag;
+
+    /**
+     * @brief Difference type.
+     */
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     * @brief Value type.
+     */
+    using value_type = typename G::value_type;
+
+    /**
+     * @brief Pointer type.
+     */
+    using pointer = const value_type *;
+
+    /**
+     * @brief Reference type.
+     */
+    using reference = const value_type &;
+
+  private:
+    /**
+     * @brief The generator values are pulled from (null at the end).
+     */
+    G *generator;
+
+    /**
+     * @brief The last value that was pulled.
+     */
+    std::optional<value_type> value;
+
+    /**
+     * @brief Pulls the next value, or moves to the end.
+     */
+    void pull() {
+        if (!value.has_value() || !generator->next(*value)) {
+            generator = nullptr;
+            value.reset();
+        }
+    }
+
+  public:
+    /**
+     * @brief Constructs the end iterator.
+     */
+    PullIterator() : generator(nullptr) {}
+
+    /**
+     * @brief Constructs an iterator, pulling the first value of `generator`.
+     *
+     * @param generator The generator values are pulled from.
+     * @param blank A value, that is overwritten by the values pulled.
+     */
+    PullIterator(G &generator, const value_type &blank)
+        : generator(&generator), value(blank) {
+        pull();
+    }
+
+    /**
+     * @brief Dereference operator.
+     *
+     * @return A reference to the last value that was pulled.
+     */
+    reference operator*() const { return *value; }
+
+    /**
+     * @brief Structure dereference operator.
+     *
+     * @return A pointer to the last value that was pulled.
+     */
+    pointer operator->() const { return &*value; }
+
+    /**
+     * @brief Prefix incrementation operator.
+     *
+     * @return A reference to `*this`, after having pulled the next value.
+     */
+    PullIterator &operator++() {
+        pull();
+        return *this;
+    }
+
+    /**
+     * @brief Equality check.
+     *
+     * As for all input iterators, this is only meaningful against the end
+     * iterator.
+     *
+     * @param it Second argument.
+     * @return If `*this` and `it` are both at the end, or both not.
+     */
+    bool operator==(const PullIterator &it) const {
+        return (generator == nullptr) == (it.generator == nullptr);
+    }
+
+    /**
+     * @brief Unequality check.
+     *
+     * @param it Second argument.
+     * @return The negation of `*this == it`.
+     */
+    bool operator!=(const PullIterator &it) const { return !(*this == it); }
+};
+
 /**
  * @brief A struct that represents a endline character.
  *
@@ -387,8 +845,11 @@ IndentedOStream &IndentedOStream::operator<< <EndLine>(const EndLine &el);
 
 /**
  * @brief Indented version of `std::cout`.
+ *
+ * Each thread has its own, so that indentation levels set by different
+ * threads do not interfere (their output may still be interleaved).
  */
-static IndentedOStream ind_cout(std::cout);
+extern thread_local IndentedOStream ind_cout;
 
 } // namespace garcide
 
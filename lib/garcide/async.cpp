@@ -0,0 +1,252 @@
+/**
+ * @file async.cpp
+ * @author GarCide contributors
+ * @brief Implementation file for computations that run in the background.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/async.hpp"
+
+#ifdef USE_PAR
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <tbb/task_arena.h>
+
+#else
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#endif
+
+namespace garcide::async {
+
+/**
+ * @brief Runs `job`, as a part of the computation controlled by `task`.
+ *
+ * `current_task()` is restored afterwards, as a thread that waits within a
+ * parallel section may run another job in the meantime.
+ *
+ * @param task The control of the computation.
+ * @param job The job.
+ */
+static void run(TaskControl *task, const std::function<void()> &job) {
+    TaskControl *outer = current_task();
+    current_task() = task;
+    job();
+    current_task() = outer;
+}
+
+#ifdef USE_PAR
+
+/**
+ * @brief The arena jobs are submitted to.
+ *
+ * @return The arena.
+ */
+static tbb::task_arena &arena() {
+    static tbb::task_arena a;
+    return a;
+}
+
+/**
+ * @brief Guards `jobs()`.
+ *
+ * @return The mutex.
+ */
+static std::mutex &jobs_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+/**
+ * @brief Jobs that were not started yet, in the order they were queued.
+ *
+ * `tbb::task_arena::enqueue` does not keep that order, so that the arena is
+ * only given anonymous tasks, one per job, that each run the oldest job of
+ * the queue.
+ *
+ * @return The queue.
+ */
+static std::deque<std::pair<std::shared_ptr<TaskControl>,
+                            std::function<void()>>> &
+jobs() {
+    static std::deque<
+        std::pair<std::shared_ptr<TaskControl>, std::function<void()>>>
+        q;
+    return q;
+}
+
+void enqueue(std::shared_ptr<TaskControl> task, std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(jobs_mutex());
+        jobs().emplace_back(std::move(task), std::move(job));
+    }
+    arena().enqueue([]() {
+        std::pair<std::shared_ptr<TaskControl>, std::function<void()>> job;
+        {
+            std::lock_guard<std::mutex> lock(jobs_mutex());
+            job = std::move(jobs().front());
+            jobs().pop_front();
+        }
+        run(job.first.get(), job.second);
+    });
+}
+
+unsigned int number_of_workers() {
+    // One slot is reserved for threads that join the arena, which those that
+    // submit jobs never do.
+    return std::max(1, arena().max_concurrency() - 1);
+}
+
+#else
+
+/**
+ * @brief A fixed set of threads, that run jobs in the order they were queued.
+ */
+class Pool {
+  private:
+    /**
+     * @brief Guards `jobs` and `stopping`.
+     */
+    std::mutex mutex;
+
+    /**
+     * @brief Signals that a job was queued, or that the pool stops.
+     */
+    std::condition_variable condition;
+
+    /**
+     * @brief Jobs that were not started yet.
+     */
+    std::deque<std::pair<std::shared_ptr<TaskControl>, std::function<void()>>>
+        jobs;
+
+    /**
+     * @brief Whether the pool stops.
+     */
+    bool stopping;
+
+    /**
+     * @brief The threads.
+     */
+    std::vector<std::thread> workers;
+
+    /**
+     * @brief What threads do: run jobs until the pool stops.
+     */
+    void work() {
+        while (true) {
+            std::pair<std::shared_ptr<TaskControl>, std::function<void()>>
+                job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock,
+                               [this]() { return stopping || !jobs.empty(); });
+                if (stopping) {
+                    return;
+                }
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            run(job.first.get(), job.second);
+        }
+    }
+
+  public:
+    /**
+     * @brief Starts one thread per core.
+     */
+    Pool() : stopping(false) {
+        unsigned int n = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int _ = 0; _ < n; _++) {
+            workers.emplace_back([this]() { work(); });
+        }
+    }
+
+    /**
+     * @brief Stops the threads.
+     *
+     * Jobs that were not started are dropped, and running ones are waited
+     * for.
+     */
+    ~Pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief The number of threads.
+     *
+     * @return The number of threads.
+     */
+    unsigned int size() const { return workers.size(); }
+
+    /**
+     * @brief Queues a job.
+     *
+     * @param task The control of the computation.
+     * @param job The job.
+     */
+    void push(std::shared_ptr<TaskControl> task, std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.emplace_back(std::move(task), std::move(job));
+        }
+        condition.notify_one();
+    }
+};
+
+/**
+ * @brief The pool jobs are submitted to.
+ *
+ * @return The pool.
+ */
+static Pool &pool() {
+    static Pool p;
+    return p;
+}
+
+void enqueue(std::shared_ptr<TaskControl> task, std::function<void()> job) {
+    pool().push(std::move(task), std::move(job));
+}
+
+unsigned int number_of_workers() { return pool().size(); }
+
+#endif
+
+} // namespace garcide::async
@@ -0,0 +1,515 @@
+/**
+ * @file c_api.cpp
+ * @author GarCide contributors
+ * @brief Implementation file for the C interface of the library.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/c_api.h"
+#include "garcide/centralizer.hpp"
+#include "garcide/groups/artin.hpp"
+#include "garcide/groups/band.hpp"
+#include "garcide/groups/coxeter.hpp"
+#include "garcide/groups/dihedral.hpp"
+#include "garcide/groups/dual_complex.hpp"
+#include "garcide/groups/euclidean_lattice.hpp"
+#include "garcide/groups/octahedral.hpp"
+#include "garcide/groups/standard_complex.hpp"
+#include <cstring>
+#include <limits>
+
+using namespace garcide;
+
+// Kinds of summit sets, for `garcide_group::summit_set`.
+enum class Summit { Super, Ultra, SlidingCircuits };
+
+// A group handle. Each operation is implemented once for all groups, in
+// `Group`, so that this only dispatches on the group.
+struct garcide_group {
+    virtual ~garcide_group() = default;
+
+    virtual size_t number_of_atoms() const = 0;
+
+    virtual size_t factor_size() const = 0;
+
+    virtual std::string atom(size_t index) const = 0;
+
+    virtual std::string normalize(const unsigned char *braid,
+                                  size_t braid_size) const = 0;
+
+    virtual std::string product(const unsigned char *left, size_t left_size,
+                                const unsigned char *right,
+                                size_t right_size) const = 0;
+
+    virtual std::string inverse(const unsigned char *braid,
+                                size_t braid_size) const = 0;
+
+    virtual std::string meet(const unsigned char *left, size_t left_size,
+                             const unsigned char *right, size_t right_size,
+                             bool left_meet) const = 0;
+
+    virtual void summit_set(const unsigned char *braid, size_t braid_size,
+                            Summit kind, garcide_braid_callback callback,
+                            void *user_data) const = 0;
+
+    virtual bool are_conjugate(const unsigned char *left, size_t left_size,
+                               const unsigned char *right, size_t right_size,
+                               std::string &conjugator) const = 0;
+
+    virtual void centralizer(const unsigned char *braid, size_t braid_size,
+                             garcide_braid_callback callback,
+                             void *user_data) const = 0;
+};
+
+namespace {
+
+// Thrown when an input buffer does not hold a braid.
+struct InvalidBuffer {};
+
+// Thrown when an atom index is out of range.
+struct InvalidIndex {};
+
+// Reads little-endian integers and packed factors from a buffer, checking
+// its bounds.
+class Reader {
+  private:
+    const u8 *pos, *end;
+
+  public:
+    Reader(const unsigned char *buffer, size_t size)
+        : pos(buffer), end(buffer + size) {}
+
+    const u8 *take(size_t size) {
+        if (size_t(end - pos) < size) {
+            throw InvalidBuffer();
+        }
+        const u8 *taken = pos;
+        pos += size;
+        return taken;
+    }
+
+    u64 integer(size_t size) {
+        const u8 *bytes = take(size);
+        u64 x = 0;
+        for (size_t i = size; i > 0; i--) {
+            x = (x << 8) | u64(bytes[i - 1]);
+        }
+        return x;
+    }
+
+    inline size_t remaining() const { return size_t(end - pos); }
+};
+
+void write_integer(std::string &str, u64 x, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        str.push_back(char(u8(x >> (8 * i))));
+    }
+}
+
+template <class F> class Group : public garcide_group {
+  private:
+    using B = BraidTemplate<F>;
+
+    typename F::Parameter parameter;
+
+    std::vector<F> atoms;
+
+    // The parameter, as it was passed to `garcide_group_new`.
+    std::string parameter_string;
+
+    size_t packed_size;
+
+    // The header of buffers: the parameter and the size of packed factors.
+    std::string header;
+
+    // Reads a braid, factor by factor. Factors that do not form a left
+    // weighted decomposition with the preceding one are multiplied, so that
+    // normal forms are read in linear time.
+    B read(const unsigned char *buffer, size_t size) const {
+        Reader reader(buffer, size);
+        u64 parameter_size = reader.integer(4);
+        std::string str(reinterpret_cast<const char *>(
+                            reader.take(parameter_size)),
+                        parameter_size);
+        if (str != parameter_string) {
+            try {
+                if (!(F::parameter_of_string(str) == parameter)) {
+                    throw InvalidBuffer();
+                }
+            } catch (InvalidStringError const &) {
+                throw InvalidBuffer();
+            }
+        }
+        if (reader.integer(4) != packed_size) {
+            throw InvalidBuffer();
+        }
+
+        i64 delta = i64(reader.integer(8));
+        if (delta < std::numeric_limits<i16>::min() ||
+            delta > std::numeric_limits<i16>::max()) {
+            throw InvalidBuffer();
+        }
+        u64 length = reader.integer(8);
+        if (length > reader.remaining() / packed_size ||
+            length * packed_size != reader.remaining()) {
+            throw InvalidBuffer();
+        }
+
+        B b(parameter);
+        b.identity();
+        b.set_delta(i16(delta));
+        F f(parameter);
+        for (u64 k = 0; k < length; k++) {
+            if (!f.unpack(reader.take(packed_size))) {
+                throw InvalidBuffer();
+            }
+            if (!f.is_identity() && !f.is_delta() &&
+                (b.cbegin() == b.cend() || (*b.crbegin()).is_left_weighted(f))) {
+                b.push_back_left_weighted(f);
+            } else {
+                b.right_multiply(f);
+            }
+        }
+        return b;
+    }
+
+    std::string write(const B &b) const {
+        std::string str = header;
+        write_integer(str, u64(i64(b.inf())), 8);
+        write_integer(str, u64(b.canonical_length()), 8);
+        size_t pos = str.size();
+        str.resize(pos + b.canonical_length() * packed_size);
+        for (typename B::ConstFactorItr it = b.cbegin(); it != b.cend();
+             it++, pos += packed_size) {
+            (*it).pack(reinterpret_cast<u8 *>(&str[pos]));
+        }
+        return str;
+    }
+
+    // Feeds a braid to a callback, and tells if it asked to stop.
+    bool feed(const B &b, garcide_braid_callback callback,
+              void *user_data) const {
+        std::string str = write(b);
+        return callback(reinterpret_cast<const unsigned char *>(str.data()),
+                        str.size(), user_data) != 0;
+    }
+
+  public:
+    Group(typename F::Parameter parameter, const std::string &str)
+        : parameter(parameter), atoms(F(parameter).atoms()),
+          parameter_string(str), packed_size(F(parameter).packed_size()) {
+        write_integer(header, str.size(), 4);
+        header += str;
+        write_integer(header, packed_size, 4);
+    }
+
+    size_t number_of_atoms() const override { return atoms.size(); }
+
+    size_t factor_size() const override { return packed_size; }
+
+    std::string atom(size_t index) const override {
+        if (index >= atoms.size()) {
+            throw InvalidIndex();
+        }
+        return write(B(atoms[index]));
+    }
+
+    std::string normalize(const unsigned char *braid,
+                          size_t braid_size) const override {
+        return write(read(braid, braid_size));
+    }
+
+    std::string product(const unsigned char *left, size_t left_size,
+                        const unsigned char *right,
+                        size_t right_size) const override {
+        return write(read(left, left_size).product(read(right, right_size)));
+    }
+
+    std::string inverse(const unsigned char *braid,
+                        size_t braid_size) const override {
+        return write(read(braid, braid_size).inverse());
+    }
+
+    std::string meet(const unsigned char *left, size_t left_size,
+                     const unsigned char *right, size_t right_size,
+                     bool left_meet) const override {
+        B b1 = read(left, left_size), b2 = read(right, right_size);
+        return write(left_meet ? b1.left_meet(b2) : b1.right_meet(b2));
+    }
+
+    // Summit sets are pulled from lazy ranges, so that the exploration stops
+    // with the callback.
+    void summit_set(const unsigned char *braid, size_t braid_size,
+                    Summit kind, garcide_braid_callback callback,
+                    void *user_data) const override {
+        B b = read(braid, braid_size);
+        if (kind == Summit::Super) {
+            for (const super_summit::Conjugate<B> &conjugate :
+                 super_summit::lazy_super_summit_set(b)) {
+                if (feed(conjugate.braid, callback, user_data)) {
+                    return;
+                }
+            }
+        } else if (kind == Summit::Ultra) {
+            for (const ultra_summit::Orbit<B> &orbit :
+                 ultra_summit::lazy_ultra_summit_set(b)) {
+                for (const B &element : orbit.orbit) {
+                    if (feed(element, callback, user_data)) {
+                        return;
+                    }
+                }
+            }
+        } else {
+            for (const sliding_circuits::Circuit<B> &circuit :
+                 sliding_circuits::lazy_sliding_circuits_set(b)) {
+                for (const B &element : circuit.circuit) {
+                    if (feed(element, callback, user_data)) {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+
+    bool are_conjugate(const unsigned char *left, size_t left_size,
+                       const unsigned char *right, size_t right_size,
+                       std::string &conjugator) const override {
+        B c(parameter);
+        if (sliding_circuits::are_conjugate(read(left, left_size),
+                                            read(right, right_size), c)) {
+            conjugator = write(c);
+            return true;
+        }
+        return false;
+    }
+
+    void centralizer(const unsigned char *braid, size_t braid_size,
+                     garcide_braid_callback callback,
+                     void *user_data) const override {
+        centralizer::Centralizer<B> z =
+            centralizer::centralizer(read(braid, braid_size));
+        for (const B &generator : z) {
+            if (feed(generator, callback, user_data)) {
+                return;
+            }
+        }
+    }
+};
+
+template <class F> garcide_group *new_group(const std::string &parameter) {
+    return new Group<F>(F::parameter_of_string(parameter), parameter);
+}
+
+// Runs `f`, turning exceptions into status codes.
+template <class Function> garcide_status guard(Function f) {
+    try {
+        return f();
+    } catch (InvalidBuffer const &) {
+        return GARCIDE_INVALID_BUFFER;
+    } catch (InvalidStringError const &) {
+        return GARCIDE_INVALID_ARGUMENT;
+    } catch (InvalidIndex const &) {
+        return GARCIDE_INVALID_ARGUMENT;
+    } catch (...) {
+        return GARCIDE_ERROR;
+    }
+}
+
+// Copies `value` to the output buffer, if it is large enough.
+garcide_status output(const std::string &value, unsigned char *out,
+                      size_t capacity, size_t *size) {
+    *size = value.size();
+    if (value.size() > capacity) {
+        return GARCIDE_BUFFER_TOO_SMALL;
+    }
+    std::memcpy(out, value.data(), value.size());
+    return GARCIDE_OK;
+}
+
+} // namespace
+
+extern "C" {
+
+garcide_status garcide_group_new(const char *group, const char *parameter,
+                                 garcide_group **out) {
+    *out = nullptr;
+    return guard([group, parameter, out]() {
+        std::string name(group), str(parameter);
+        if (name == "artin") {
+            *out = new_group<artin::Factor>(str);
+        } else if (name == "band") {
+            *out = new_group<band::Factor>(str);
+        } else if (name == "octahedral") {
+            *out = new_group<octahedral::Factor>(str);
+        } else if (name == "dihedral") {
+            *out = new_group<dihedral::Factor>(str);
+        } else if (name == "dual_complex") {
+            *out = new_group<dual_complex::Factor>(str);
+        } else if (name == "standard_complex") {
+            *out = new_group<standard_complex::Factor>(str);
+        } else if (name == "euclidean_lattice") {
+            *out = new_group<euclidean_lattice::Factor>(str);
+        } else if (name == "coxeter") {
+            *out = new_group<coxeter::Factor>(str);
+        } else {
+            return GARCIDE_INVALID_ARGUMENT;
+        }
+        return GARCIDE_OK;
+    });
+}
+
+void garcide_group_free(garcide_group *group) { delete group; }
+
+size_t garcide_number_of_atoms(const garcide_group *group) {
+    return group->number_of_atoms();
+}
+
+size_t garcide_factor_size(const garcide_group *group) {
+    return group->factor_size();
+}
+
+garcide_status garcide_atom(const garcide_group *group, size_t index,
+                            unsigned char *out, size_t capacity, size_t *size) {
+    return guard([&]() {
+        return output(group->atom(index), out, capacity, size);
+    });
+}
+
+garcide_status garcide_normalize(const garcide_group *group,
+                                 const unsigned char *braid, size_t braid_size,
+                                 unsigned char *out, size_t capacity,
+                                 size_t *size) {
+    return guard([&]() {
+        return output(group->normalize(braid, braid_size), out, capacity,
+                      size);
+    });
+}
+
+garcide_status garcide_product(const garcide_group *group,
+                               const unsigned char *left, size_t left_size,
+                               const unsigned char *right, size_t right_size,
+                               unsigned char *out, size_t capacity,
+                               size_t *size) {
+    return guard([&]() {
+        return output(group->product(left, left_size, right, right_size), out,
+                      capacity, size);
+    });
+}
+
+garcide_status garcide_inverse(const garcide_group *group,
+                               const unsigned char *braid, size_t braid_size,
+                               unsigned char *out, size_t capacity,
+                               size_t *size) {
+    return guard([&]() {
+        return output(group->inverse(braid, braid_size), out, capacity, size);
+    });
+}
+
+garcide_status garcide_left_meet(const garcide_group *group,
+                                 const unsigned char *left, size_t left_size,
+                                 const unsigned char *right, size_t right_size,
+                                 unsigned char *out, size_t capacity,
+                                 size_t *size) {
+    return guard([&]() {
+        return output(group->meet(left, left_size, right, right_size, true),
+                      out, capacity, size);
+    });
+}
+
+garcide_status garcide_right_meet(const garcide_group *group,
+                                  const unsigned char *left, size_t left_size,
+                                  const unsigned char *right,
+                                  size_t right_size, unsigned char *out,
+                                  size_t capacity, size_t *size) {
+    return guard([&]() {
+        return output(group->meet(left, left_size, right, right_size, false),
+                      out, capacity, size);
+    });
+}
+
+garcide_status garcide_super_summit_set(const garcide_group *group,
+                                        const unsigned char *braid,
+                                        size_t braid_size,
+                                        garcide_braid_callback callback,
+                                        void *user_data) {
+    return guard([&]() {
+        group->summit_set(braid, braid_size, Summit::Super, callback,
+                          user_data);
+        return GARCIDE_OK;
+    });
+}
+
+garcide_status garcide_ultra_summit_set(const garcide_group *group,
+                                        const unsigned char *braid,
+                                        size_t braid_size,
+                                        garcide_braid_callback callback,
+                                        void *user_data) {
+    return guard([&]() {
+        group->summit_set(braid, braid_size, Summit::Ultra, callback,
+                          user_data);
+        return GARCIDE_OK;
+    });
+}
+
+garcide_status garcide_sliding_circuits_set(const garcide_group *group,
+                                            const unsigned char *braid,
+                                            size_t braid_size,
+                                            garcide_braid_callback callback,
+                                            void *user_data) {
+    return guard([&]() {
+        group->summit_set(braid, braid_size, Summit::SlidingCircuits,
+                          callback, user_data);
+        return GARCIDE_OK;
+    });
+}
+
+garcide_status garcide_are_conjugate(const garcide_group *group,
+                                     const unsigned char *left,
+                                     size_t left_size,
+                                     const unsigned char *right,
+                                     size_t right_size, int *conjugate,
+                                     unsigned char *out, size_t capacity,
+                                     size_t *size) {
+    return guard([&]() {
+        std::string conjugator;
+        *conjugate = group->are_conjugate(left, left_size, right, right_size,
+                                          conjugator)
+                         ? 1
+                         : 0;
+        return output(conjugator, out, capacity, size);
+    });
+}
+
+garcide_status garcide_centralizer(const garcide_group *group,
+                                   const unsigned char *braid,
+                                   size_t braid_size,
+                                   garcide_braid_callback callback,
+                                   void *user_data) {
+    return guard([&]() {
+        group->centralizer(braid, braid_size, callback, user_data);
+        return GARCIDE_OK;
+    });
+}
+}
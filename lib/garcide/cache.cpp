@@ -0,0 +1,357 @@
+/**
+ * @file cache.cpp
+ * @author GarCide contributors
+ * @brief Implementation file for the on-disk cache of summit sets
+ * computations.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/cache.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CACHE_USE_MMAP
+#endif
+
+namespace fs = std::filesystem;
+
+namespace garcide::cache {
+
+// Every entry starts with this, followed by the length of the key, the key,
+// the length of the value, the value and the FNV-1a hash of the value (in
+// little-endian order).
+static const std::string MAGIC = "GarCide cache 2\n";
+
+// Temporary files older than this were left by writers that crashed.
+static const std::chrono::hours TEMPORARY_LIFETIME(1);
+
+static std::mutex mutex;
+static bool enabled = false;
+static fs::path directory;
+static std::uintmax_t max_size = DEFAULT_MAX_SIZE;
+
+// Size of the entries of the directory, as of the last scan, plus the sizes of
+// the entries that were stored since. Other processes may store entries too,
+// so that this is only an estimate, that is corrected by the scan that
+// `evict` does once it exceeds the bound.
+static std::uintmax_t total_size = 0;
+
+// Whether a scan of the directory is running. Scans run outside of `mutex`,
+// one at a time.
+static bool evicting = false;
+
+// 64-bits FNV-1a, which does not depend on the platform (unlike std::hash).
+static u64 fnv1a(const char *begin, const char *end) {
+    u64 h = 0xcbf29ce484222325ull;
+    for (const char *c = begin; c != end; c++) {
+        h ^= u64((unsigned char)*c);
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+static u64 fnv1a(const std::string &str) {
+    return fnv1a(str.data(), str.data() + str.size());
+}
+
+static void write_checksum(std::string &str, u64 h) {
+    for (i16 i = 0; i < 8; i++) {
+        str.push_back(char((h >> (8 * i)) & 0xff));
+    }
+}
+
+static u64 read_checksum(const char *pos) {
+    u64 h = 0;
+    for (i16 i = 0; i < 8; i++) {
+        h |= u64((unsigned char)pos[i]) << (8 * i);
+    }
+    return h;
+}
+
+static fs::path path_of_key(const fs::path &dir, const std::string &key) {
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", fnv1a(key));
+    return dir / (std::string(name) + ".entry");
+}
+
+// Scans the directory, removes stale temporary files and, if the entries do
+// not fit in `bound`, removes the least recently used ones until they fit in
+// 7/8 of it (so that scans stay rare). Returns the size of the entries that
+// are left.
+static std::uintmax_t evict(const fs::path &dir, std::uintmax_t bound) {
+    std::error_code ec;
+    std::vector<std::pair<fs::file_time_type, fs::path>> entries;
+    std::uintmax_t total = 0;
+    fs::file_time_type now = fs::file_time_type::clock::now();
+
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        std::uintmax_t size = it->file_size(ec);
+        fs::file_time_type time = it->last_write_time(ec);
+        if (ec) {
+            ec.clear();
+            continue;
+        }
+        if (it->path().extension() == ".tmp") {
+            if (now - time > TEMPORARY_LIFETIME) {
+                fs::remove(it->path(), ec);
+                ec.clear();
+            }
+            continue;
+        }
+        if (it->path().extension() != ".entry") {
+            continue;
+        }
+        entries.emplace_back(time, it->path());
+        total += size;
+    }
+
+    if (total <= bound) {
+        return total;
+    }
+
+    std::sort(entries.begin(), entries.end());
+    for (auto &[time, path] : entries) {
+        if (total <= bound - bound / 8) {
+            break;
+        }
+        std::uintmax_t size = fs::file_size(path, ec);
+        if (!ec && fs::remove(path, ec)) {
+            total -= size;
+        }
+        ec.clear();
+    }
+    return total;
+}
+
+// Runs `evict` outside of `mutex`, unless another scan is running, and then
+// sets `total_size` to its result, unless the cache was moved meanwhile. Must
+// be called with `lock` held, that is held again when it returns.
+static void evict_unlocked(std::unique_lock<std::mutex> &lock,
+                           const fs::path &dir, std::uintmax_t bound) {
+    if (evicting) {
+        return;
+    }
+    evicting = true;
+    lock.unlock();
+    std::uintmax_t total = evict(dir, bound);
+    lock.lock();
+    evicting = false;
+    if (enabled && directory == dir) {
+        total_size = total;
+    }
+}
+
+void enable(const std::string &dir, std::uintmax_t bound) {
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    std::unique_lock<std::mutex> lock(mutex);
+    directory = dir;
+    max_size = bound;
+    enabled = true;
+    total_size = 0;
+    evict_unlocked(lock, directory, max_size);
+}
+
+void disable() {
+    std::lock_guard<std::mutex> lock(mutex);
+    enabled = false;
+}
+
+bool is_enabled() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return enabled;
+}
+
+void Entry::release() {
+#ifdef CACHE_USE_MMAP
+    if (mapping != nullptr) {
+        munmap(mapping, mapping_size);
+    }
+#else
+    delete[] static_cast<char *>(mapping);
+#endif
+    mapping = nullptr;
+    mapping_size = 0;
+    value = nullptr;
+    value_size = 0;
+}
+
+Entry::~Entry() { release(); }
+
+bool load(const std::string &key, Entry &entry) {
+    fs::path path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!enabled) {
+            return false;
+        }
+        path = path_of_key(directory, key);
+    }
+
+#ifdef CACHE_USE_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    size_t size = size_t(st.st_size);
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    size_t size = size_t(file.tellg());
+    char *mapping = new char[size];
+    file.seekg(0);
+    if (!file.read(mapping, size)) {
+        delete[] mapping;
+        return false;
+    }
+#endif
+
+    // `entry` now owns the mapping, and releases it even if it is invalid.
+    entry.release();
+    entry.mapping = mapping;
+    entry.mapping_size = size;
+
+    const char *pos = static_cast<const char *>(mapping), *end = pos + size;
+    try {
+        if (size < MAGIC.size() ||
+            std::memcmp(pos, MAGIC.data(), MAGIC.size()) != 0) {
+            return false;
+        }
+        pos += MAGIC.size();
+        u64 key_size = read(pos, end);
+        if (u64(end - pos) < key_size ||
+            key.compare(0, std::string::npos, pos, key_size) != 0) {
+            return false;
+        }
+        pos += key_size;
+        u64 value_size = read(pos, end);
+        if (u64(end - pos) < 8 || u64(end - pos) - 8 != value_size ||
+            read_checksum(pos + value_size) !=
+                fnv1a(pos, pos + value_size)) {
+            return false;
+        }
+        entry.value = pos;
+        entry.value_size = value_size;
+    } catch (CorruptEntry const &) {
+        return false;
+    }
+
+    // Marks the entry as the most recently used one.
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+
+    return true;
+}
+
+void store(const std::string &key, const std::string &value) {
+    fs::path dir;
+    std::uintmax_t bound;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!enabled) {
+            return;
+        }
+        dir = directory;
+        bound = max_size;
+    }
+
+    fs::path path = path_of_key(dir, key);
+
+    // The temporary file has a unique name, so that concurrent writers (in
+    // this process or in others) do not step on each other.
+    static std::atomic<u64> counter{0};
+    std::random_device rd;
+    fs::path tmp = path;
+    tmp += "." + std::to_string(rd()) + "." + std::to_string(counter++) +
+           ".tmp";
+
+    std::string header = MAGIC, checksum;
+    write(header, u64(key.size()));
+    header += key;
+    write(header, u64(value.size()));
+    write_checksum(checksum, fnv1a(value));
+
+    {
+        std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+        file.write(header.data(), header.size());
+        file.write(value.data(), value.size());
+        file.write(checksum.data(), checksum.size());
+        file.close();
+        if (!file) {
+            std::error_code ec;
+            fs::remove(tmp, ec);
+            return;
+        }
+    }
+
+    // The entry may replace an older one, with the same key.
+    std::error_code ec;
+    std::uintmax_t replaced = fs::file_size(path, ec);
+    if (ec) {
+        replaced = 0;
+    }
+    fs::rename(tmp, path, ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!enabled || directory != dir) {
+        return;
+    }
+    total_size += header.size() + value.size() + checksum.size();
+    total_size -= std::min(total_size, replaced);
+    if (total_size > bound) {
+        evict_unlocked(lock, dir, bound);
+    }
+}
+
+} // namespace garcide::cache
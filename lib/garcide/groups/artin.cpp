@@ -30,6 +30,11 @@
 
 #include "garcide/groups/artin.hpp"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_MEET
+#include <immintrin.h>
+#endif
+
 namespace garcide {
 
 namespace artin {
@@ -64,6 +69,112 @@ Underlying::Parameter Underlying::parameter_of_string(const std::string &str) {
     }
 }
 
+namespace {
+
+#ifdef SIMD_MEET
+
+// Largest number of strands for which meets are computed in SSE registers,
+// one byte per strand.
+const i16 SIMD_MEET_MAX_STRANDS = 16;
+
+// Same as Underlying::MeetSub(a, b, r, 1, n), for n <= 16 and r the identity.
+//
+// This is the same merge sort, but bottom-up on blocks of size 1, 2, 4, 8, and
+// without branches. The suffix minima and prefix maxima of blocks are
+// computed by shifting scans. As the merge predicate is monotonic, the rank of
+// an element in a merged block is its rank in its block plus the number of
+// elements of the other block that go before it, that is counted for all
+// lanes at once. Lanes beyond n hold 127, and stay at the end.
+__attribute__((target("sse4.1"))) void meet_sse(const i16 *a, const i16 *b,
+                                                i16 *r, i16 n) {
+    alignas(16) i8 ta[16], tb[16], tr[16], tp[16], ts[16];
+    for (i16 i = 0; i < 16; i++) {
+        ta[i] = i < n ? i8(a[i + 1]) : i8(127);
+        tb[i] = i < n ? i8(b[i + 1]) : i8(127);
+        tr[i] = i8(i);
+    }
+    const __m128i A = _mm_load_si128((const __m128i *)ta);
+    const __m128i B = _mm_load_si128((const __m128i *)tb);
+    const __m128i L =
+        _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i R = L;
+
+    for (i8 w = 1; w < n; w *= 2) {
+        const __m128i W = _mm_set1_epi8(w);
+        const __m128i local = _mm_and_si128(L, _mm_set1_epi8(w - 1));
+        const __m128i left =
+            _mm_cmpeq_epi8(_mm_and_si128(L, W), _mm_setzero_si128());
+        __m128i U = _mm_shuffle_epi8(A, R);
+        __m128i V = _mm_shuffle_epi8(B, R);
+
+        // Suffix minima on left blocks, prefix maxima on right ones.
+        for (i8 d = 1; d < w; d *= 2) {
+            const __m128i D = _mm_set1_epi8(d);
+            const __m128i from = _mm_blendv_epi8(
+                _mm_sub_epi8(L, D), _mm_add_epi8(L, D), left);
+            const __m128i valid = _mm_blendv_epi8(
+                _mm_cmpgt_epi8(local, _mm_set1_epi8(d - 1)),
+                _mm_cmpgt_epi8(W, _mm_add_epi8(local, D)), left);
+            const __m128i S = _mm_shuffle_epi8(U, from);
+            const __m128i T = _mm_shuffle_epi8(V, from);
+            U = _mm_blendv_epi8(
+                U,
+                _mm_blendv_epi8(_mm_max_epi8(U, S), _mm_min_epi8(U, S), left),
+                valid);
+            V = _mm_blendv_epi8(
+                V,
+                _mm_blendv_epi8(_mm_max_epi8(V, T), _mm_min_epi8(V, T), left),
+                valid);
+        }
+
+        // Number of elements of the other block that go first.
+        const __m128i other =
+            _mm_xor_si128(_mm_andnot_si128(_mm_set1_epi8(w - 1), L), W);
+        __m128i count = _mm_setzero_si128();
+        for (i8 k = 0; k < w; k++) {
+            const __m128i from = _mm_add_epi8(other, _mm_set1_epi8(k));
+            const __m128i P = _mm_shuffle_epi8(U, from);
+            const __m128i Q = _mm_shuffle_epi8(V, from);
+            const __m128i first = _mm_blendv_epi8(
+                _mm_and_si128(_mm_cmpgt_epi8(P, U), _mm_cmpgt_epi8(Q, V)),
+                _mm_and_si128(_mm_cmpgt_epi8(U, P), _mm_cmpgt_epi8(V, Q)),
+                left);
+            count = _mm_sub_epi8(count, first);
+        }
+
+        const __m128i base = _mm_andnot_si128(_mm_set1_epi8(2 * w - 1), L);
+        const __m128i position =
+            _mm_add_epi8(_mm_add_epi8(base, local),
+                         _mm_blendv_epi8(_mm_sub_epi8(W, count), count, left));
+        _mm_store_si128((__m128i *)tp, position);
+        _mm_store_si128((__m128i *)ts, R);
+        for (i16 i = 0; i < n; i++)
+            tr[i16(tp[i])] = ts[i];
+        R = _mm_load_si128((const __m128i *)tr);
+    }
+
+    for (i16 i = 0; i < n; i++)
+        r[i + 1] = i16(tr[i]) + 1;
+}
+
+#endif
+
+// Sets r[1..n] as Underlying::MeetSub(a, b, r, 1, n) would from the identity,
+// if a vectorized routine is available for n on this machine and enabled (see
+// `set_simd_kernels`).
+bool fast_meet(const i16 *a, const i16 *b, i16 *r, i16 n) {
+#ifdef SIMD_MEET
+    static const bool has_sse = __builtin_cpu_supports("sse4.1");
+    if (has_sse && simd_kernels() && n <= SIMD_MEET_MAX_STRANDS) {
+        meet_sse(a, b, r, n);
+        return true;
+    }
+#endif
+    return false;
+}
+
+} // namespace
+
 void Underlying::MeetSub(const i16 *a, const i16 *b, i16 *r, i16 s,
                          i16 t) {
     thread_local i16 u[MAX_NUMBER_OF_STRANDS], v[MAX_NUMBER_OF_STRANDS],
@@ -107,11 +218,12 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
     Parameter n = get_parameter();
 
     std::smatch match;
+    static const std::regex atom_regex{"(?:s[\\s\\t]*_?[\\s\\t]*)?(" +
+                                       number_regex + ")"};
+    static const std::regex delta_regex{"D"};
 
-    if (std::regex_search(
-            str.begin() + pos, str.end(), match,
-            std::regex{"(?:s[\\s\\t]*_?[\\s\\t]*)?(" + number_regex + ")"},
-            std::regex_constants::match_continuous)) {
+    if (std::regex_search(str.begin() + pos, str.end(), match, atom_regex,
+                          std::regex_constants::match_continuous)) {
         i16 i;
         try {
             i = std::stoi(match[1]);
@@ -130,7 +242,7 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
                                      std::to_string(n) + "[.");
         }
     } else if (std::regex_search(str.begin() + pos, str.end(), match,
-                                 std::regex{"D"},
+                                 delta_regex,
                                  std::regex_constants::match_continuous)) {
         pos += match[0].length();
         delta();
@@ -199,10 +311,13 @@ Underlying Underlying::left_meet(const Underlying &b) const {
 
     Underlying f = Underlying(get_parameter());
 
-    for (i16 i = 1; i <= get_parameter(); ++i)
-        s[i] = i;
-    MeetSub(permutation_table.data(), b.permutation_table.data(), s, 1,
-            get_parameter());
+    if (!fast_meet(permutation_table.data(), b.permutation_table.data(), s,
+                   get_parameter())) {
+        for (i16 i = 1; i <= get_parameter(); ++i)
+            s[i] = i;
+        MeetSub(permutation_table.data(), b.permutation_table.data(), s, 1,
+                get_parameter());
+    }
     for (i16 i = 1; i <= get_parameter(); ++i)
         f.permutation_table[s[i]] = i;
 
@@ -218,9 +333,11 @@ Underlying Underlying::right_meet(const Underlying &b) const {
         u[permutation_table[i]] = i;
         v[b.permutation_table[i]] = i;
     }
-    for (i16 i = 1; i <= get_parameter(); ++i)
-        f.permutation_table[i] = i;
-    MeetSub(u, v, f.permutation_table.data(), 1, get_parameter());
+    if (!fast_meet(u, v, f.permutation_table.data(), get_parameter())) {
+        for (i16 i = 1; i <= get_parameter(); ++i)
+            f.permutation_table[i] = i;
+        MeetSub(u, v, f.permutation_table.data(), 1, get_parameter());
+    }
 
     return f;
 }
@@ -251,12 +368,70 @@ Underlying Underlying::right_complement(const Underlying &b) const {
     return inverse().product(b);
 }
 
+bool Underlying::is_identity() const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        if (permutation_table[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Underlying::is_delta() const {
+    Parameter n = get_parameter();
+    for (i16 i = 1; i <= n; i++) {
+        if (permutation_table[i] != n + 1 - i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Underlying Underlying::left_complement() const {
+    Parameter n = get_parameter();
+    Underlying f = Underlying(n);
+    for (i16 i = 1; i <= n; i++) {
+        f.permutation_table[n + 1 - permutation_table[i]] = i;
+    }
+    return f;
+}
+
+Underlying Underlying::right_complement() const {
+    Parameter n = get_parameter();
+    Underlying f = Underlying(n);
+    for (i16 i = 1; i <= n; i++) {
+        f.permutation_table[permutation_table[i]] = n + 1 - i;
+    }
+    return f;
+}
+
+bool Underlying::left_meet_is_identity(const Underlying &b) const {
+    for (i16 i = 1; i < get_parameter(); i++) {
+        if ((permutation_table[i] > permutation_table[i + 1]) &&
+            (b.permutation_table[i] > b.permutation_table[i + 1])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Underlying::is_right_divisible_by_atom(size_t k) const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        if (permutation_table[i] == i16(k + 1)) {
+            return false;
+        }
+        if (permutation_table[i] == i16(k + 2)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void Underlying::randomize() {
     for (i16 i = 1; i <= get_parameter(); ++i)
         permutation_table[i] = i;
     for (i16 i = 1; i < get_parameter(); ++i) {
-        i16 j = i + i16(std::rand() / (RAND_MAX + 1.0) *
-                              (get_parameter() - i + 1));
+        i16 j = i + i16(random_below(get_parameter() - i + 1));
         i16 z = permutation_table[i];
         permutation_table[i] = permutation_table[j];
         permutation_table[j] = z;
@@ -299,6 +474,19 @@ size_t Underlying::hash() const {
     return h;
 }
 
+void Underlying::pack(u8 *out) const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        pack_u16(out + 2 * (i - 1), u16(permutation_table[i]));
+    }
+}
+
+bool Underlying::unpack(const u8 *in) {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        permutation_table[i] = i16(unpack_u16(in + 2 * (i - 1)));
+    }
+    return is_permutation_table(permutation_table.data(), 1, get_parameter());
+}
+
 void Underlying::tableau(i16 **&tab) const {
     i16 i, j;
     Braid::Parameter n = get_parameter();
@@ -327,7 +515,7 @@ void Underlying::tableau(i16 **&tab) const {
 bool preserves_circles(const Braid &b) {
     i16 j, k, t, d;
     Braid::Parameter n = b.get_parameter();
-    i16 *disj = new i16[n + 1];
+    std::vector<i16> disj(n + 1);
 
     Underlying delta_under(n);
     delta_under.delta();
@@ -341,14 +529,17 @@ bool preserves_circles(const Braid &b) {
 
     delta = delta % 2;
 
-    i16 ***tabarray = new i16 **[cl + delta];
+    // The tableaux are stored in vectors, so that they are freed on return.
+    std::vector<i16> cells(size_t(cl + delta) * n * n);
+    std::vector<i16 *> rows(size_t(cl + delta) * n);
+    std::vector<i16 **> tabarray(cl + delta);
     Braid::ConstFactorItr it = b.cbegin();
 
     for (j = 0; j < cl + delta; j++) {
-        tabarray[j] = new i16 *[n];
         for (k = 0; k < n; k++) {
-            tabarray[j][k] = new i16[n];
+            rows[j * n + k] = &cells[size_t(j * n + k) * n];
         }
+        tabarray[j] = &rows[j * n];
         if (delta && j == 0)
             delta_under.tableau(tabarray[j]);
         else {
@@ -357,7 +548,7 @@ bool preserves_circles(const Braid &b) {
         }
     }
 
-    i16 *bkmove = new i16[n];
+    std::vector<i16> bkmove(n);
     i16 bk;
     for (j = 2; j < n; j++) {
         for (k = 1; k <= n - j + 1; k++) {
@@ -410,18 +601,28 @@ bool preserves_circles(const Braid &b) {
         return false;
 }
 
-ThurstonType thurston_type(const Braid &b,
-                           const ultra_summit::UltraSummitSet<Braid> &uss) {
+// Checks if some power of b, up to the number of strands, is a power of
+// Delta.
+static bool is_periodic(const Braid &b) {
     Braid::Parameter n = b.get_parameter();
 
     Braid pow = b;
 
     for (i16 i = 0; i < n; i++) {
         if (pow.canonical_length() == 0)
-            return ThurstonType::Periodic;
+            return true;
         pow.right_multiply(b);
     }
 
+    return false;
+}
+
+ThurstonType thurston_type(const Braid &b,
+                           const ultra_summit::UltraSummitSet<Braid> &uss) {
+    if (is_periodic(b)) {
+        return ThurstonType::Periodic;
+    }
+
     for (typename ultra_summit::UltraSummitSet<Braid>::ConstIterator it =
              uss.begin();
          it != uss.end(); it++) {
@@ -434,7 +635,97 @@ ThurstonType thurston_type(const Braid &b,
 }
 
 ThurstonType thurston_type(const Braid &b) {
-    return thurston_type(b, ultra_summit::ultra_summit_set(b));
+    if (!cache::is_enabled()) {
+        return thurston_type(b, ultra_summit::ultra_summit_set(b));
+    }
+
+    std::string key =
+        cache::key("thurston_type 1", ultra_summit::send_to_ultra_summit(b));
+    cache::Entry entry;
+    if (cache::load(key, entry)) {
+        const char *pos = entry.data();
+        try {
+            u64 type = cache::read(pos, pos + entry.size());
+            if (type <= u64(ThurstonType::PseudoAsonov)) {
+                return ThurstonType(type);
+            }
+        } catch (cache::CorruptEntry const &) {
+        }
+    }
+
+    ThurstonType type = thurston_type(b, ultra_summit::ultra_summit_set(b));
+    std::string value;
+    cache::write(value, u64(type));
+    cache::store(key, value);
+    return type;
+}
+
+namespace {
+
+// Hooks of the BFS of sliding circuits sets, that test the elements of
+// circuits as soon as they are found, and stop the search at the first
+// reducible witness.
+struct ReducibilityHooks {
+    ThurstonTypeReport *report;
+
+    bool filter(const Braid &) const { return true; }
+
+    bool found(const sliding_circuits::SlidingCircuitsSet<Braid> &scs,
+               const std::vector<Braid> &t, size_t, size_t, const Factor &) {
+        report->number_of_orbits = scs.number_of_circuits();
+        report->number_of_elements = scs.card();
+        for (std::vector<Braid>::const_iterator it = t.begin(); it != t.end();
+             it++) {
+            report->number_of_tests++;
+            if (preserves_circles(*it)) {
+                report->type = ThurstonType::Reducible;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+ThurstonTypeReport thurston_type_report(const Braid &b,
+                                        ThurstonPipeline pipeline) {
+    ThurstonTypeReport report{ThurstonType::PseudoAsonov, pipeline, 0, 0, 0};
+
+    if (is_periodic(b)) {
+        report.type = ThurstonType::Periodic;
+        return report;
+    }
+
+    if (pipeline == ThurstonPipeline::UltraSummit) {
+        ultra_summit::UltraSummitSet<Braid> uss =
+            ultra_summit::ultra_summit_set(b);
+
+        report.number_of_orbits = uss.number_of_orbits();
+        report.number_of_elements = uss.card();
+
+        for (typename ultra_summit::UltraSummitSet<Braid>::ConstIterator it =
+                 uss.begin();
+             it != uss.end(); it++) {
+            report.number_of_tests++;
+            if (preserves_circles(*it)) {
+                report.type = ThurstonType::Reducible;
+                return report;
+            }
+        }
+
+        return report;
+    }
+
+    // Same BFS as in sliding_circuits::sliding_circuits_set, except that
+    // circuits are tested as soon as they are found.
+    summit_search::BreadthFirstSearch<
+        sliding_circuits::SlidingCircuitsGraph<Factor>, ReducibilityHooks>
+        search(sliding_circuits::send_to_sliding_circuits(b),
+               ReducibilityHooks{&report});
+    search.run();
+
+    return report;
 }
 
 } // namespace artin
@@ -456,4 +747,20 @@ IndentedOStream &IndentedOStream::operator<< <artin::ThurstonType>(
     return *this;
 }
 
-} // namespace garcide
\ No newline at end of file
+template <>
+IndentedOStream &IndentedOStream::operator<< <artin::ThurstonPipeline>(
+    const artin::ThurstonPipeline &pipeline) {
+    switch (pipeline) {
+    case artin::ThurstonPipeline::UltraSummit:
+        os << "ultra summit set";
+        break;
+    case artin::ThurstonPipeline::SlidingCircuits:
+        os << "sliding circuits set";
+        break;
+    }
+    return *this;
+}
+
+GARCIDE_INSTANTIATE(, artin::Underlying)
+
+} // namespace garcide
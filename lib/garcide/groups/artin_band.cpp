@@ -0,0 +1,214 @@
+/**
+ * @file artin_band.cpp
+ * @author GarCide contributors
+ * @brief Implementation file for conversions between the classic and dual
+ * Garside structures of standard braid groups.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/groups/artin_band.hpp"
+
+namespace garcide {
+
+namespace artin_band {
+
+// Index of a(t, s) in band::Underlying::atoms(), for t > s.
+static inline i16 band_atom_index(i16 t, i16 s) {
+    return (t - 1) * (t - 2) / 2 + s - 1;
+}
+
+// Reads a factor as a word in the sigma_i, the same way
+// artin::Underlying::print does.
+static std::vector<i16> sigma_word(const artin::Factor &f) {
+    artin::Underlying u = f.get_underlying();
+    i16 i, j, n = u.get_parameter();
+    std::vector<i16> table(n + 1), word;
+    for (i = 1; i <= n; i++) {
+        table[i] = u.at(i);
+    }
+    for (i = 2; i <= n; i++) {
+        for (j = i; j > 1 && table[j] < table[j - 1]; j--) {
+            word.push_back(j - 1);
+            std::swap(table[j], table[j - 1]);
+        }
+    }
+    return word;
+}
+
+band::Braid band_of_artin(const artin::Braid &b) {
+    i16 n = b.get_parameter();
+    std::vector<band::Factor> atoms = band::Factor(n).atoms();
+    band::Braid c(n);
+
+    auto right_multiply_word = [&c, &atoms](const artin::Factor &f) {
+        for (i16 i : sigma_word(f)) {
+            c.right_multiply(atoms[band_atom_index(i + 1, i)]);
+        }
+    };
+
+    c.set_delta(n * quot(b.inf(), 2));
+    if (rem(b.inf(), 2) == 1) {
+        artin::Factor delta(n);
+        delta.delta();
+        right_multiply_word(delta);
+    }
+    for (artin::Braid::ConstFactorItr it = b.cbegin(); it != b.cend(); it++) {
+        right_multiply_word(*it);
+    }
+    return c;
+}
+
+artin::Braid artin_of_band(const band::Braid &b) {
+    i16 i, j, n = b.get_parameter();
+    std::vector<artin::Factor> sigmas = artin::Factor(n).atoms();
+    artin::Braid c(n);
+
+    // delta = sigma_{n - 1} ... sigma_1.
+    artin::Factor delta(n);
+    delta.identity();
+    for (i = n - 1; i >= 1; i--) {
+        delta = delta * sigmas[i - 1];
+    }
+    c.set_delta(2 * quot(b.inf(), n));
+    for (i = 0; i < rem(b.inf(), n); i++) {
+        c.right_multiply(delta);
+    }
+
+    std::vector<i16> cycle;
+    std::vector<bool> seen(n + 1);
+    for (band::Braid::ConstFactorItr it = b.cbegin(); it != b.cend(); it++) {
+        // A factor is a product of decreasing cycles, and the cycle
+        // (t_1 > ... > t_k) is a(t_1, t_2) ... a(t_{k - 1}, t_k).
+        band::Underlying u = it->get_underlying();
+        std::fill(seen.begin(), seen.end(), false);
+        for (i = 1; i <= n; i++) {
+            if (seen[i]) {
+                continue;
+            }
+            cycle.clear();
+            for (j = i; !seen[j]; j = u.at(j)) {
+                cycle.push_back(j);
+                seen[j] = true;
+            }
+            for (j = i16(cycle.size()) - 1; j >= 1; j--) {
+                i16 t = cycle[j], s = cycle[j - 1];
+                artin::Factor p(n);
+                p.identity();
+                for (i16 k = t - 1; k > s; k--) {
+                    p = p * sigmas[k - 1];
+                }
+                c.right_multiply(p);
+                c.right_multiply(sigmas[s - 1]);
+                c.right_divide(p);
+            }
+        }
+    }
+    return c;
+}
+
+Structure cheaper_structure(const artin::Braid &b1, const artin::Braid &b2) {
+    i64 n = b1.get_parameter();
+    i64 classic = super_summit::send_to_super_summit(b1).canonical_length() +
+                  super_summit::send_to_super_summit(b2).canonical_length();
+    i64 dual = super_summit::send_to_super_summit(band_of_artin(b1))
+                   .canonical_length() +
+               super_summit::send_to_super_summit(band_of_artin(b2))
+                   .canonical_length();
+    // There are n - 1 classic atoms, and n (n - 1) / 2 dual ones.
+    return (2 * classic * classic <= n * dual * dual) ? Structure::Classic
+                                                       : Structure::Dual;
+}
+
+Structure cheaper_structure(const artin::Braid &b) {
+    i64 n = b.get_parameter();
+    i64 classic = super_summit::send_to_super_summit(b).canonical_length();
+    i64 dual = super_summit::send_to_super_summit(band_of_artin(b))
+                   .canonical_length();
+    return (2 * classic * classic <= n * dual * dual) ? Structure::Classic
+                                                       : Structure::Dual;
+}
+
+bool are_conjugate(const artin::Braid &b1, const artin::Braid &b2,
+                   artin::Braid &c, Structure structure) {
+    if (structure == Structure::Classic) {
+        return sliding_circuits::are_conjugate(b1, b2, c);
+    }
+    band::Braid c2(b1.get_parameter());
+    if (sliding_circuits::are_conjugate(band_of_artin(b1), band_of_artin(b2),
+                                        c2)) {
+        c = artin_of_band(c2);
+        return true;
+    }
+    return false;
+}
+
+bool are_conjugate(const artin::Braid &b1, const artin::Braid &b2,
+                   artin::Braid &c) {
+    return are_conjugate(b1, b2, c, cheaper_structure(b1, b2));
+}
+
+centralizer::Centralizer<artin::Braid> centralizer(const artin::Braid &b,
+                                                   Structure structure) {
+    if (structure == Structure::Classic) {
+        return centralizer::centralizer(b);
+    }
+    centralizer::Centralizer<band::Braid> centralizer_dual =
+        centralizer::centralizer(band_of_artin(b));
+    centralizer::Centralizer<artin::Braid> generators;
+    for (centralizer::Centralizer<band::Braid>::ConstIterator it =
+             centralizer_dual.begin();
+         it != centralizer_dual.end(); it++) {
+        generators.insert(artin_of_band(*it));
+    }
+    return generators;
+}
+
+centralizer::Centralizer<artin::Braid> centralizer(const artin::Braid &b) {
+    if (cheaper_structure(b) == Structure::Dual) {
+        try {
+            return centralizer(b, Structure::Dual);
+        } catch (ultra_summit::NotUltraSummit<band::Braid> const &) {
+        }
+    }
+    return centralizer(b, Structure::Classic);
+}
+
+} // namespace artin_band
+
+template <>
+IndentedOStream &IndentedOStream::operator<< <artin_band::Structure>(
+    const artin_band::Structure &structure) {
+    switch (structure) {
+    case artin_band::Structure::Classic:
+        os << "classic structure";
+        break;
+    case artin_band::Structure::Dual:
+        os << "dual structure";
+        break;
+    }
+    return *this;
+}
+
+} // namespace garcide
@@ -0,0 +1,159 @@
+/**
+ * @file artin_handle.cpp
+ * @author GarCide contributors
+ * @brief Implementation file for handle reduction of braid words in the
+ * \f$\sigma_i\f$.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/groups/artin_handle.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace garcide {
+
+namespace artin_handle {
+
+// Reads a factor as a word in the sigma_i, the same way
+// artin::Underlying::print does.
+static void append_sigma_word(Word &w, const artin::Factor &f) {
+    artin::Underlying u = f.get_underlying();
+    i16 i, j, n = u.get_parameter();
+    std::vector<i16> table(n + 1);
+    for (i = 1; i <= n; i++) {
+        table[i] = u.at(i);
+    }
+    for (i = 2; i <= n; i++) {
+        for (j = i; j > 1 && table[j] < table[j - 1]; j--) {
+            w.push_back(j - 1);
+            std::swap(table[j], table[j - 1]);
+        }
+    }
+}
+
+Word word_of_braid(const artin::Braid &b) {
+    i16 i, n = b.get_parameter();
+    Word w, delta;
+    artin::Factor f(n);
+    f.delta();
+    append_sigma_word(delta, f);
+    if (b.inf() < 0) {
+        delta = inverse(delta);
+    }
+    for (i = 0; i < std::abs(b.inf()); i++) {
+        w.insert(w.end(), delta.begin(), delta.end());
+    }
+    for (artin::Braid::ConstFactorItr it = b.cbegin(); it != b.cend(); it++) {
+        append_sigma_word(w, *it);
+    }
+    return w;
+}
+
+Word inverse(const Word &w) {
+    Word v(w.size());
+    std::transform(w.rbegin(), w.rend(), v.begin(),
+                   [](i16 x) { return -x; });
+    return v;
+}
+
+void reduce(Word &w) {
+    // w[0, l[ is the prefix read so far, and w[r, w.size()[ what is left to
+    // read. For p < l, below[p] is the last position q < p such that
+    // |w[q]| < |w[p]| and that no letter of w]q, p[ has an index at most
+    // |w[q]|, or -1. From l - 1, it thus lists the letters that may be the
+    // start of a handle, by decreasing index.
+    i32 l = 0, r = 0;
+    std::vector<i32> below(w.size());
+
+    while (r < i32(w.size())) {
+        i16 x = w[r++], i = std::abs(x);
+        i32 t = l - 1;
+        while (t >= 0 && std::abs(w[t]) > i) {
+            t = below[t];
+        }
+        if (t < 0 || w[t] != -x) {
+            below[l] = (t >= 0 && w[t] == x) ? below[t] : t;
+            w[l++] = x;
+            continue;
+        }
+
+        // w[t, l[ x is a handle. Its reduction is pushed back in front of
+        // what is left to read, and written backwards: as it is at least as
+        // long as w]t, l[, letters are then read before they are overwritten,
+        // provided that it ends up strictly after t.
+        i16 e = (w[t] > 0) ? 1 : -1;
+        i32 m = 0;
+        for (i32 p = t + 1; p < l; p++) {
+            m += (std::abs(w[p]) == i + 1) ? 3 : 1;
+        }
+        if (r - m <= t) {
+            i32 extra = std::max(m, i32(w.size()));
+            w.insert(w.begin() + r, extra, 0);
+            below.resize(w.size());
+            r += extra;
+        }
+        for (i32 p = l - 1; p > t; p--) {
+            i16 y = w[p];
+            if (std::abs(y) == i + 1) {
+                w[--r] = e * (i + 1);
+                w[--r] = (y > 0) ? i : -i;
+                w[--r] = -e * (i + 1);
+            } else {
+                w[--r] = y;
+            }
+        }
+        l = t;
+    }
+
+    w.resize(l);
+}
+
+i16 sign(Word w) {
+    reduce(w);
+    if (w.empty()) {
+        return 0;
+    }
+    // There is no handle left, so that letters of least index all have the
+    // same sign.
+    i16 x = *std::min_element(w.begin(), w.end(), [](i16 y, i16 z) {
+        return std::abs(y) < std::abs(z);
+    });
+    return (x > 0) ? 1 : -1;
+}
+
+bool is_trivial(Word w) {
+    reduce(w);
+    return w.empty();
+}
+
+i16 compare(const Word &w1, const Word &w2) {
+    Word w = inverse(w1);
+    w.insert(w.end(), w2.begin(), w2.end());
+    return -sign(std::move(w));
+}
+
+} // namespace artin_handle
+
+} // namespace garcide
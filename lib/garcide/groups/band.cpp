@@ -29,6 +29,7 @@
  */
 
 #include "garcide/groups/band.hpp"
+#include <mutex>
 
 namespace garcide::band {
 
@@ -98,15 +99,17 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
     i16 n = get_parameter();
 
     std::smatch match;
+    static const std::regex delta_regex{"D"};
+    static const std::regex atom_regex{"\\([\\s\\t]*(" + number_regex +
+                                       ")[\\s\\t]*,?[\\s\\t]*(" + number_regex +
+                                       ")[\\s\\t]*\\)"};
 
-    if (std::regex_search(str.begin() + pos, str.end(), match, std::regex{"D"},
+    if (std::regex_search(str.begin() + pos, str.end(), match, delta_regex,
                           std::regex_constants::match_continuous)) {
         pos += match[0].length();
         delta();
     } else if (std::regex_search(str.begin() + pos, str.end(), match,
-                                 std::regex{"\\([\\s\\t]*(" + number_regex +
-                                            ")[\\s\\t]*,?[\\s\\t]*(" +
-                                            number_regex + ")[\\s\\t]*\\)"},
+                                 atom_regex,
                                  std::regex_constants::match_continuous)) {
         pos += match[0].length();
         i16 i, j;
@@ -195,14 +198,20 @@ Underlying Underlying::left_meet(const Underlying &b) const {
     assign_partition(x);
     b.assign_partition(y);
 
-    thread_local i16 P[MAX_NUMBER_OF_STRANDS][MAX_NUMBER_OF_STRANDS];
+    // Only the entries that are read are written, so that `P` only grows when
+    // larger parameters are seen, and is never cleared.
+    thread_local std::vector<i16> P;
+    i16 n = get_parameter();
+    if (P.size() < size_t((n + 1) * (n + 1))) {
+        P.resize((n + 1) * (n + 1));
+    }
 
-    for (i16 i = get_parameter(); i >= 1; i--) {
-        P[x[i]][y[i]] = i;
+    for (i16 i = n; i >= 1; i--) {
+        P[x[i] * (n + 1) + y[i]] = i;
     }
 
-    for (i16 i = 1; i <= get_parameter(); i++) {
-        z[i] = P[x[i]][y[i]];
+    for (i16 i = 1; i <= n; i++) {
+        z[i] = P[x[i] * (n + 1) + y[i]];
     }
 
     Underlying c = Underlying(*this);
@@ -253,6 +262,70 @@ Underlying Underlying::right_complement(const Underlying &b) const {
     return inverse().product(b);
 }
 
+bool Underlying::is_identity() const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        if (permutation_table[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Underlying::is_delta() const {
+    i16 n = get_parameter();
+    for (i16 i = 1; i < n; i++) {
+        if (permutation_table[i] != i + 1) {
+            return false;
+        }
+    }
+    return permutation_table[n] == 1;
+}
+
+Underlying Underlying::left_complement() const {
+    i16 n = get_parameter();
+    Underlying f = Underlying(n);
+    for (i16 i = 1; i <= n; i++) {
+        i16 j = permutation_table[i];
+        f.permutation_table[j == 1 ? n : j - 1] = i;
+    }
+    return f;
+}
+
+Underlying Underlying::right_complement() const {
+    i16 n = get_parameter();
+    Underlying f = Underlying(n);
+    for (i16 i = 1; i < n; i++) {
+        f.permutation_table[permutation_table[i]] = i + 1;
+    }
+    f.permutation_table[permutation_table[n]] = 1;
+    return f;
+}
+
+bool Underlying::left_meet_is_identity(const Underlying &b) const {
+    thread_local i16 y[MAX_NUMBER_OF_STRANDS], seen[MAX_NUMBER_OF_STRANDS],
+        stamp[MAX_NUMBER_OF_STRANDS];
+    i16 n = get_parameter();
+
+    b.assign_partition(y);
+
+    // Cells of `*this` are its cycles. Each of them is walked, stamping the
+    // cells of `b` it meets with its first point.
+    for (i16 i = 1; i <= n; i++) {
+        seen[i] = false;
+        stamp[i] = 0;
+    }
+    for (i16 i = 1; i <= n; i++) {
+        for (i16 j = i; !seen[j]; j = permutation_table[j]) {
+            if (stamp[y[j]] == i) {
+                return false;
+            }
+            seen[j] = true;
+            stamp[y[j]] = i;
+        }
+    }
+    return true;
+}
+
 void Underlying::delta_conjugate_mut(i16 k) {
     Underlying under = *this;
     i16 i, n = get_parameter();
@@ -264,12 +337,33 @@ void Underlying::delta_conjugate_mut(i16 k) {
     *this = under;
 }
 
+bool Underlying::is_left_divisible_by_atom(size_t k) const {
+    // Atoms are listed by row i, then column j < i.
+    i16 i = 2;
+    while (size_t(i) * size_t(i - 1) / 2 <= k) {
+        i++;
+    }
+    i16 j = i16(k - size_t(i - 1) * size_t(i - 2) / 2) + 1;
+    for (i16 l = permutation_table[i]; l != i; l = permutation_table[l]) {
+        if (l == j) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void Underlying::randomize() {
 #ifdef USE_CLN
-    static i8 s[2 * MAX_NUMBER_OF_STRANDS + 1];
-    cln::cl_I k = cln::random_I(cln::default_random_state,
-                                get_catalan_number(get_parameter())) +
-                  1;
+    i8 s[2 * MAX_NUMBER_OF_STRANDS + 1];
+    cln::cl_I k;
+    {
+        // `cln::default_random_state` is shared by all threads.
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+        k = cln::random_I(cln::default_random_state,
+                          get_catalan_number(get_parameter())) +
+            1;
+    }
     ballot_sequence(get_parameter(), k, s);
     of_ballot_sequence(s);
 #else
@@ -302,8 +396,34 @@ size_t Underlying::hash() const {
     return h;
 }
 
+void Underlying::pack(u8 *out) const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        pack_u16(out + 2 * (i - 1), u16(permutation_table[i]));
+    }
+}
+
+bool Underlying::unpack(const u8 *in) {
+    thread_local i16 x[MAX_NUMBER_OF_STRANDS + 1];
+    i16 n = get_parameter();
+    for (i16 i = 1; i <= n; i++) {
+        permutation_table[i] = i16(unpack_u16(in + 2 * (i - 1)));
+    }
+    if (!is_permutation_table(permutation_table.data(), 1, n)) {
+        return false;
+    }
+    // Factors are exactly the permutations that `of_partition()` builds from
+    // non-crossing partitions.
+    assign_partition(x);
+    if (!is_noncrossing(x, n)) {
+        return false;
+    }
+    Underlying f = *this;
+    f.of_partition(x);
+    return compare(f);
+}
+
 void Underlying::of_ballot_sequence(const i8 *s) {
-    static i16 stack[MAX_NUMBER_OF_STRANDS];
+    i16 stack[MAX_NUMBER_OF_STRANDS];
     i16 sp = 0;
 
     for (i16 i = 1; i <= 2 * get_parameter(); ++i) {
@@ -378,3 +498,9 @@ const cln::cl_I &get_catalan_number(i16 n) { return CatalanNumber.c(n); }
 #endif
 
 } // namespace garcide::band
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(, band::Underlying)
+
+} // namespace garcide
@@ -0,0 +1,929 @@
+/**
+ * @file coxeter.cpp
+ * @author GarCide contributors
+ * @brief Implementation file for table-driven finite type Artin groups
+ * (classical and dual Garside structures).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/groups/coxeter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace garcide::coxeter {
+
+namespace {
+
+// Elements of W are identified by the image of a regular point, in simple
+// root coordinates, rounded at this precision.
+const double KEY_PRECISION = 1e6;
+
+// Tolerance for floating point comparisons to 0.
+const double EPSILON = 1e-9;
+
+using Key = std::vector<i64>;
+
+// Open addressing hash set of keys, numbering them in insertion order.
+class KeyTable {
+    i16 r;
+    std::vector<i64> keys;
+    std::vector<i32> slots;
+    i32 size = 0;
+
+    std::size_t slot_of(const i64 *k) const {
+        u64 h = 0;
+        for (i16 i = 0; i < r; i++) {
+            h = (h ^ u64(k[i])) * 0x100000001b3;
+        }
+        h ^= h >> 29;
+        std::size_t mask = slots.size() - 1;
+        std::size_t j = h & mask;
+        while (slots[j] != -1 &&
+               !std::equal(k, k + r,
+                           keys.begin() + std::size_t(slots[j]) * r)) {
+            j = (j + 1) & mask;
+        }
+        return j;
+    }
+
+  public:
+    KeyTable(i16 r) : r(r), slots(64, -1) {}
+
+    // The number of k, or -1 if it has not been inserted.
+    i32 find(const Key &k) const { return slots[slot_of(k.data())]; }
+
+    // The number of k, and whether it was newly inserted.
+    std::pair<i32, bool> insert(const Key &k) {
+        std::size_t j = slot_of(k.data());
+        if (slots[j] != -1) {
+            return {slots[j], false};
+        }
+        keys.insert(keys.end(), k.begin(), k.end());
+        slots[j] = size++;
+        if (2 * std::size_t(size) > slots.size()) {
+            slots.assign(2 * slots.size(), -1);
+            for (i32 x = 0; x < size; x++) {
+                slots[slot_of(&keys[std::size_t(x) * r])] = x;
+            }
+        }
+        return {size - 1, true};
+    }
+};
+
+using Matrix = std::vector<double>;
+
+void round_point(const double *p, i16 r, Key &k) {
+    for (i16 i = 0; i < r; i++) {
+        k[i] = std::llround(p[i] * KEY_PRECISION);
+    }
+}
+
+Key key_of_point(const std::vector<double> &p) {
+    Key k(p.size());
+    round_point(&p[0], p.size(), k);
+    return k;
+}
+
+// The symmetric bilinear form B_ij = -cos(pi / m_ij) of the geometric
+// representation.
+Matrix bilinear_form(const std::vector<i16> &m, i16 r) {
+    Matrix b(r * r);
+    for (i16 i = 0; i < r; i++) {
+        for (i16 j = 0; j < r; j++) {
+            b[i * r + j] =
+                (i == j) ? 1. : -std::cos(std::acos(-1.) / m[i * r + j]);
+        }
+    }
+    return b;
+}
+
+bool is_positive_definite(Matrix b, i16 r) {
+    for (i16 k = 0; k < r; k++) {
+        for (i16 j = 0; j < k; j++) {
+            b[k * r + k] -= b[k * r + j] * b[k * r + j];
+        }
+        if (b[k * r + k] <= EPSILON) {
+            return false;
+        }
+        b[k * r + k] = std::sqrt(b[k * r + k]);
+        for (i16 i = k + 1; i < r; i++) {
+            for (i16 j = 0; j < k; j++) {
+                b[i * r + k] -= b[i * r + j] * b[k * r + j];
+            }
+            b[i * r + k] /= b[k * r + k];
+        }
+    }
+    return true;
+}
+
+// Solves b x = y, b being positive definite.
+std::vector<double> solve(Matrix b, i16 r, std::vector<double> y) {
+    for (i16 k = 0; k < r; k++) {
+        for (i16 i = k + 1; i < r; i++) {
+            double f = b[i * r + k] / b[k * r + k];
+            for (i16 j = k; j < r; j++) {
+                b[i * r + j] -= f * b[k * r + j];
+            }
+            y[i] -= f * y[k];
+        }
+    }
+    for (i16 k = r - 1; k >= 0; k--) {
+        for (i16 j = k + 1; j < r; j++) {
+            y[k] -= b[k * r + j] * y[j];
+        }
+        y[k] /= b[k * r + k];
+    }
+    return y;
+}
+
+// rho such that <alpha_i, rho> = 1 for all i: it lies in no reflecting
+// hyperplane, so that its stabilizer is trivial.
+std::vector<double> regular_point(const Matrix &b, i16 r) {
+    return solve(b, r, std::vector<double>(r, 1.));
+}
+
+// The order of W, as the product over k of the sizes of the orbits of the
+// fundamental weights omega_k under W_k = <s_1, ..., s_k> (omega_k is fixed
+// by W_{k-1}, so that its orbit is W_k / W_{k-1}). It only enumerates these
+// orbits, and stops as soon as the order is known to exceed limit.
+i64 group_order(const Matrix &b, i16 r, i64 limit) {
+    i64 order = 1;
+    for (i16 k = 1; k <= r; k++) {
+        Matrix b_k(k * k);
+        for (i16 i = 0; i < k; i++) {
+            std::copy(&b[i * r], &b[i * r] + k, &b_k[i * k]);
+        }
+        std::vector<double> omega(k, 0.);
+        omega[k - 1] = 1.;
+        std::vector<double> orbit = solve(b_k, k, omega), q(k);
+        KeyTable points(k);
+        Key key = key_of_point(orbit);
+        points.insert(key);
+        for (i64 x = 0; x < i64(orbit.size()) / k; x++) {
+            for (i16 i = 0; i < k; i++) {
+                std::copy(&orbit[x * k], &orbit[x * k] + k, q.begin());
+                for (i16 j = 0; j < k; j++) {
+                    q[i] -= 2 * b_k[i * k + j] * orbit[x * k + j];
+                }
+                round_point(&q[0], k, key);
+                if (points.insert(key).second) {
+                    if (order * i64(orbit.size() / k + 1) > limit) {
+                        return limit + 1;
+                    }
+                    orbit.insert(orbit.end(), q.begin(), q.end());
+                }
+            }
+        }
+        order *= orbit.size() / k;
+    }
+    return order;
+}
+
+Matrix multiply(const Matrix &x, const Matrix &y, i16 r) {
+    Matrix z(r * r, 0.);
+    for (i16 i = 0; i < r; i++) {
+        for (i16 k = 0; k < r; k++) {
+            double f = x[i * r + k];
+            if (f != 0.) {
+                for (i16 j = 0; j < r; j++) {
+                    z[i * r + j] += f * y[k * r + j];
+                }
+            }
+        }
+    }
+    return z;
+}
+
+std::vector<double> apply(const Matrix &x, const std::vector<double> &v,
+                          i16 r) {
+    std::vector<double> w(r, 0.);
+    for (i16 i = 0; i < r; i++) {
+        for (i16 j = 0; j < r; j++) {
+            w[i] += x[i * r + j] * v[j];
+        }
+    }
+    return w;
+}
+
+i16 rank(Matrix x, i16 r) {
+    i16 rk = 0;
+    for (i16 c = 0; c < r && rk < r; c++) {
+        i16 p = rk;
+        for (i16 i = rk + 1; i < r; i++) {
+            if (std::abs(x[i * r + c]) > std::abs(x[p * r + c])) {
+                p = i;
+            }
+        }
+        if (std::abs(x[p * r + c]) <= EPSILON) {
+            continue;
+        }
+        for (i16 j = c; j < r; j++) {
+            std::swap(x[p * r + j], x[rk * r + j]);
+        }
+        for (i16 i = rk + 1; i < r; i++) {
+            double f = x[i * r + c] / x[rk * r + c];
+            for (i16 j = c; j < r; j++) {
+                x[i * r + j] -= f * x[rk * r + j];
+            }
+        }
+        rk++;
+    }
+    return rk;
+}
+
+// rank(x - y).
+i16 rank_of_difference(const Matrix &x, const Matrix &y, i16 r) {
+    Matrix z(r * r);
+    for (i32 i = 0; i < r * r; i++) {
+        z[i] = x[i] - y[i];
+    }
+    return rank(z, r);
+}
+
+Matrix identity_matrix(i16 r) {
+    Matrix x(r * r, 0.);
+    for (i16 i = 0; i < r; i++) {
+        x[i * r + i] = 1.;
+    }
+    return x;
+}
+
+// The matrix of s_i in the basis of simple roots.
+Matrix generator_matrix(const Matrix &b, i16 r, i16 i) {
+    Matrix x = identity_matrix(r);
+    for (i16 j = 0; j < r; j++) {
+        x[i * r + j] -= 2 * b[i * r + j];
+    }
+    return x;
+}
+
+void check_size(i64 number_of_simples, const std::string &description) {
+    if (number_of_simples > CoxeterParameter::MAX_NUMBER_OF_SIMPLES) {
+        throw InvalidStringError(
+            "The Garside structure " + description +
+            " has too many simple elements (the maximum is " +
+            std::to_string(CoxeterParameter::MAX_NUMBER_OF_SIMPLES) + ")!");
+    }
+}
+
+// Fills the tables that are derived the same way in both structures, once
+// the multiplication tables and divisors bitsets are known.
+void finish_lattice(Lattice &l) {
+    i32 n = l.number_of_simples;
+    i16 a = l.number_of_atoms;
+    l.first_atom.assign(n, -1);
+    l.last_atom.assign(n, -1);
+    std::vector<u64> all(l.words, ~u64(0));
+    for (i32 x = 1; x < n; x++) {
+        l.first_atom[x] = l.common_atom(&l.left_divisors[x * l.words], &all[0]);
+        l.last_atom[x] = l.common_atom(&l.right_divisors[x * l.words], &all[0]);
+    }
+    // Complements to Delta, computed as in `Underlying::left_complement` and
+    // `Underlying::right_complement`.
+    l.delta_left_complement.assign(n, 0);
+    l.delta_right_complement.assign(n, 0);
+    for (i32 x = 0; x < n; x++) {
+        i32 f = l.delta;
+        for (i32 y = x; y != 0;) {
+            i16 t = l.last_atom[y];
+            f = l.right_multiplication[f * a + t];
+            y = l.right_multiplication[y * a + t];
+        }
+        l.delta_left_complement[x] = f;
+        f = l.delta;
+        for (i32 y = x; y != 0;) {
+            i16 t = l.first_atom[y];
+            f = l.left_multiplication[f * a + t];
+            y = l.left_multiplication[y * a + t];
+        }
+        l.delta_right_complement[x] = f;
+    }
+    l.atoms.resize(a);
+    for (i16 t = 0; t < a; t++) {
+        l.atoms[t] = l.right_multiplication[t];
+    }
+    l.tau_order = 1;
+    std::vector<i32> conjugates = l.atoms;
+    while (true) {
+        for (i32 &x : conjugates) {
+            x = l.tau[x];
+        }
+        if (conjugates == l.atoms) {
+            break;
+        }
+        l.tau_order++;
+    }
+}
+
+void build_classic(Lattice &l, const Matrix &b) {
+    i16 r = l.rank;
+    l.number_of_atoms = r;
+    l.words = (r + 63) / 64;
+    check_size(group_order(b, r, CoxeterParameter::MAX_NUMBER_OF_SIMPLES),
+               l.description);
+
+    KeyTable ids(r);
+    std::vector<i16> length;
+    // Points of the current and next layers, r coordinates each.
+    std::vector<double> layer = regular_point(b, r), next_layer, q(r);
+    Key key(r);
+
+    round_point(&layer[0], r, key);
+    ids.insert(key);
+    length.push_back(0);
+    i32 first_of_layer = 0, n = 1;
+
+    // Layered breadth first search on the orbit of rho: s_i w < w if and
+    // only if <alpha_i, w(rho)> < 0.
+    while (!layer.empty()) {
+        i32 layer_size = layer.size() / r;
+        l.left_multiplication.resize(n * r, -1);
+        l.left_divisors.resize(n * l.words, 0);
+        for (i32 k = 0; k < layer_size; k++) {
+            i32 w = first_of_layer + k;
+            const double *p = &layer[k * r];
+            for (i16 i = 0; i < r; i++) {
+                double h = 0;
+                for (i16 j = 0; j < r; j++) {
+                    h += b[i * r + j] * p[j];
+                }
+                std::copy(p, p + r, q.begin());
+                q[i] -= 2 * h;
+                round_point(&q[0], r, key);
+                if (h < 0) {
+                    l.left_divisors[w * l.words + i / 64] |= u64(1) << (i % 64);
+                    l.left_multiplication[w * r + i] = ids.find(key);
+                } else {
+                    auto [x, inserted] = ids.insert(key);
+                    if (inserted) {
+                        check_size(++n, l.description);
+                        length.push_back(length[w] + 1);
+                        next_layer.insert(next_layer.end(), q.begin(), q.end());
+                    }
+                    l.left_multiplication[w * r + i] = x;
+                }
+            }
+        }
+        first_of_layer += layer_size;
+        layer.swap(next_layer);
+        next_layer.clear();
+    }
+
+    l.number_of_simples = n;
+    l.delta = n - 1;
+    l.height = length[n - 1];
+
+    // x s = t (u s) if x = t u.
+    l.right_multiplication.resize(n * r);
+    l.right_divisors.assign(n * l.words, 0);
+    for (i16 s = 0; s < r; s++) {
+        l.right_multiplication[s] = l.left_multiplication[s];
+    }
+    for (i32 x = 1; x < n; x++) {
+        i16 t = 0;
+        while (!(l.left_divisors[x * l.words + t / 64] >> (t % 64) & 1)) {
+            t++;
+        }
+        i32 u = l.left_multiplication[x * r + t];
+        for (i16 s = 0; s < r; s++) {
+            i32 v = l.right_multiplication[u * r + s];
+            i32 y = l.left_multiplication[v * r + t];
+            l.right_multiplication[x * r + s] = y;
+            if (length[y] < length[x]) {
+                l.right_divisors[x * l.words + s / 64] |= u64(1) << (s % 64);
+            }
+        }
+    }
+
+    // Conjugation by the longest element permutes the generators, and
+    // tau(t u) = tau(t) tau(u).
+    std::vector<i16> sigma(r);
+    for (i16 t = 0; t < r; t++) {
+        for (i16 s = 0; s < r; s++) {
+            if (l.left_multiplication[l.delta * r + t] ==
+                l.right_multiplication[l.delta * r + s]) {
+                sigma[t] = s;
+            }
+        }
+    }
+    l.tau.assign(n, 0);
+    for (i32 x = 1; x < n; x++) {
+        i16 t = 0;
+        while (!(l.left_divisors[x * l.words + t / 64] >> (t % 64) & 1)) {
+            t++;
+        }
+        i32 u = l.left_multiplication[x * r + t];
+        l.tau[x] = l.left_multiplication[l.tau[u] * r + sigma[t]];
+    }
+}
+
+void build_dual(Lattice &l, const Matrix &b) {
+    i16 r = l.rank;
+    std::vector<double> rho = regular_point(b, r);
+
+    // Reflections: the conjugation closure of the generators, simple
+    // reflections first.
+    std::vector<Matrix> generators, reflections;
+    KeyTable reflection_ids(r);
+    for (i16 i = 0; i < r; i++) {
+        generators.push_back(generator_matrix(b, r, i));
+        reflection_ids.insert(key_of_point(apply(generators[i], rho, r)));
+        reflections.push_back(generators[i]);
+    }
+    for (std::size_t k = 0; k < reflections.size(); k++) {
+        for (i16 i = 0; i < r; i++) {
+            Matrix t = multiply(generators[i],
+                                multiply(reflections[k], generators[i], r), r);
+            if (reflection_ids.insert(key_of_point(apply(t, rho, r))).second) {
+                reflections.push_back(t);
+            }
+        }
+    }
+    if (reflections.size() > std::size_t(std::numeric_limits<i16>::max())) {
+        throw InvalidStringError("The Garside structure " + l.description +
+                                 " has too many atoms!");
+    }
+    i16 a = reflections.size();
+    l.number_of_atoms = a;
+    l.words = (a + 63) / 64;
+
+    Matrix c = identity_matrix(r), c_inverse = identity_matrix(r);
+    for (i16 i = 0; i < r; i++) {
+        c = multiply(c, generators[i], r);
+        c_inverse = multiply(generators[i], c_inverse, r);
+    }
+    std::vector<double> c_rho = apply(c, rho, r);
+    std::vector<std::vector<double>> t_rho;
+    for (const Matrix &t : reflections) {
+        t_rho.push_back(apply(t, rho, r));
+    }
+
+    KeyTable ids(r), rejected(r);
+    std::vector<i16> length;
+    std::vector<Matrix> layer, next_layer;
+
+    ids.insert(key_of_point(rho));
+    length.push_back(0);
+    layer.push_back(identity_matrix(r));
+    i32 first_of_layer = 0, n = 1;
+
+    // x t is a prefix of c if and only if l_T(x t) = l_T(x) + 1 and
+    // l_T((x t)^-1 c) = r - l_T(x t), where l_T(y) = rank(1 - y). As t is an
+    // involution, rank(1 - x t) = rank(t - x) and rank((x t)^-1 c - 1) =
+    // rank(c t - x).
+    std::vector<Matrix> c_reflections;
+    for (const Matrix &t : reflections) {
+        c_reflections.push_back(multiply(c, t, r));
+    }
+    for (i16 h = 0; !layer.empty(); h++) {
+        l.right_multiplication.resize(n * a, -1);
+        l.right_divisors.resize(n * l.words, 0);
+        for (std::size_t k = 0; k < layer.size(); k++) {
+            i32 x = first_of_layer + k;
+            for (i16 t = 0; t < a; t++) {
+                Key key = key_of_point(apply(layer[k], t_rho[t], r));
+                i32 y = ids.find(key);
+                if (y != -1) {
+                    l.right_multiplication[x * a + t] = y;
+                    if (length[y] < h) {
+                        l.right_divisors[x * l.words + t / 64] |= u64(1)
+                                                                  << (t % 64);
+                    }
+                } else if (h < r && rejected.find(key) == -1) {
+                    if (rank_of_difference(reflections[t], layer[k], r) ==
+                            h + 1 &&
+                        rank_of_difference(c_reflections[t], layer[k], r) ==
+                            r - h - 1) {
+                        ids.insert(key);
+                        check_size(++n, l.description);
+                        length.push_back(h + 1);
+                        next_layer.push_back(
+                            multiply(layer[k], reflections[t], r));
+                        l.right_multiplication[x * a + t] = n - 1;
+                    } else {
+                        rejected.insert(key);
+                    }
+                }
+            }
+        }
+        // Left multiples of this layer are in the previous or the next one,
+        // which are both complete now.
+        l.left_multiplication.resize(first_of_layer * a + layer.size() * a, -1);
+        l.left_divisors.resize((first_of_layer + layer.size()) * l.words, 0);
+        l.tau.resize(first_of_layer + layer.size());
+        for (std::size_t k = 0; k < layer.size(); k++) {
+            i32 x = first_of_layer + k;
+            std::vector<double> p = apply(layer[k], rho, r);
+            for (i16 t = 0; t < a; t++) {
+                i32 y = ids.find(key_of_point(apply(reflections[t], p, r)));
+                if (y != -1) {
+                    l.left_multiplication[x * a + t] = y;
+                    if (length[y] < h) {
+                        l.left_divisors[x * l.words + t / 64] |= u64(1)
+                                                                 << (t % 64);
+                    }
+                }
+            }
+            l.tau[x] = ids.find(
+                key_of_point(apply(c_inverse, apply(layer[k], c_rho, r), r)));
+        }
+        first_of_layer += layer.size();
+        layer.swap(next_layer);
+        next_layer.clear();
+    }
+
+    l.number_of_simples = n;
+    l.delta = ids.find(key_of_point(c_rho));
+    l.height = r;
+}
+
+std::vector<i16> coxeter_matrix_of_type(char type, i16 n, i16 m) {
+    std::vector<i16> matrix(n * n, 2);
+    auto link = [&](i16 i, i16 j, i16 v) {
+        matrix[(i - 1) * n + j - 1] = v;
+        matrix[(j - 1) * n + i - 1] = v;
+    };
+    for (i16 i = 0; i < n; i++) {
+        matrix[i * n + i] = 1;
+    }
+    switch (type) {
+    case 'A':
+    case 'B':
+    case 'C':
+    case 'H':
+        for (i16 i = 1; i < n; i++) {
+            link(i, i + 1, 3);
+        }
+        if (type == 'B' || type == 'C') {
+            link(n - 1, n, 4);
+        } else if (type == 'H') {
+            link(1, 2, 5);
+        }
+        break;
+    case 'D':
+        for (i16 i = 1; i < n - 1; i++) {
+            link(i, i + 1, 3);
+        }
+        link(n - 2, n, 3);
+        break;
+    case 'E':
+        link(1, 3, 3);
+        link(2, 4, 3);
+        for (i16 i = 3; i < n; i++) {
+            link(i, i + 1, 3);
+        }
+        break;
+    case 'F':
+        link(1, 2, 3);
+        link(2, 3, 4);
+        link(3, 4, 3);
+        break;
+    case 'G':
+        link(1, 2, 6);
+        break;
+    case 'I':
+        link(1, 2, m);
+        break;
+    }
+    return matrix;
+}
+
+} // namespace
+
+void CoxeterParameter::print(IndentedOStream &os) const {
+    os << lattice->description;
+}
+
+const Lattice *
+CoxeterParameter::get_lattice(const std::string &description,
+                              const std::vector<i16> &coxeter_matrix,
+                              Structure structure) {
+    static std::mutex mutex;
+    static std::map<std::string, std::unique_ptr<Lattice>> lattices;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<Lattice> &l = lattices[description];
+    if (!l) {
+        std::unique_ptr<Lattice> built = std::make_unique<Lattice>();
+        built->description = description;
+        built->structure = structure;
+        built->rank = std::sqrt(coxeter_matrix.size());
+        built->coxeter_matrix = coxeter_matrix;
+        Matrix b = bilinear_form(coxeter_matrix, built->rank);
+        if (structure == Structure::Classic) {
+            build_classic(*built, b);
+        } else {
+            build_dual(*built, b);
+        }
+        finish_lattice(*built);
+        l = std::move(built);
+    }
+    return l.get();
+}
+
+Underlying::Parameter Underlying::parameter_of_string(const std::string &str) {
+    std::smatch match;
+    std::string description;
+    std::vector<i16> matrix;
+    i16 n;
+
+    if (std::regex_match(
+            str, match,
+            std::regex{"[\\s\\t]*(dual[\\s\\t]+)?([A-I])[\\s\\t]*_?[\\s\\t]*"
+                       "([1-9][0-9]*)[\\s\\t]*(\\([\\s\\t]*([1-9][0-9]*)"
+                       "[\\s\\t]*\\))?[\\s\\t]*"})) {
+        char type = match.str(2)[0];
+        i16 m = 0;
+        try {
+            n = std::stoi(match[3]);
+            if (match[5].matched) {
+                m = std::stoi(match[5]);
+            }
+        } catch (std::out_of_range const &) {
+            throw InvalidStringError("Parameter is too big!");
+        }
+        bool valid;
+        switch (type) {
+        case 'A':
+            valid = n >= 1;
+            break;
+        case 'B':
+        case 'C':
+            valid = n >= 2;
+            type = 'B';
+            break;
+        case 'D':
+            valid = n >= 4;
+            break;
+        case 'E':
+            valid = 6 <= n && n <= 8;
+            break;
+        case 'F':
+            valid = n == 4;
+            break;
+        case 'G':
+            valid = n == 2;
+            break;
+        case 'H':
+            valid = n == 3 || n == 4;
+            break;
+        case 'I':
+            valid = n == 2 && m >= 2;
+            break;
+        default:
+            valid = false;
+        }
+        if (!valid || (match[4].matched != (type == 'I'))) {
+            throw InvalidStringError("There is no finite Coxeter group " +
+                                     match.str(2) + match.str(3) +
+                                     match.str(4) + "!");
+        }
+        description = std::string(1, type) + std::to_string(n);
+        if (type == 'I') {
+            description += "(" + std::to_string(m) + ")";
+        }
+        matrix = coxeter_matrix_of_type(type, n, m);
+    } else if (std::regex_match(str, match,
+                                std::regex{"[\\s\\t]*(dual[\\s\\t]+)?\\[([0-9;"
+                                           "\\s\\t]*)\\][\\s\\t]*"})) {
+        std::vector<std::vector<i16>> rows(1);
+        std::string body = match[2];
+        std::smatch entry;
+        std::regex entry_regex{"[\\s\\t]*([0-9]+|;)"};
+        for (auto it = body.cbegin();
+             std::regex_search(it, body.cend(), entry, entry_regex,
+                               std::regex_constants::match_continuous);
+             it += entry[0].length()) {
+            if (entry[1] == ";") {
+                rows.emplace_back();
+            } else {
+                try {
+                    rows.back().push_back(std::stoi(entry[1]));
+                } catch (std::out_of_range const &) {
+                    throw InvalidStringError("Coxeter matrix entry " +
+                                             entry.str(1) + " is too big!");
+                }
+            }
+        }
+        n = rows.size();
+        description = "[";
+        for (i16 i = 0; i < n; i++) {
+            if (i16(rows[i].size()) != n) {
+                throw InvalidStringError("A Coxeter matrix should be square!");
+            }
+            for (i16 j = 0; j < n; j++) {
+                i16 m = rows[i][j];
+                if ((i == j) ? (m != 1) : (m < 2 || m != rows[j][i])) {
+                    throw InvalidStringError(
+                        "A Coxeter matrix should be symmetric, with ones on "
+                        "its diagonal and integers at least 2 elsewhere!");
+                }
+                matrix.push_back(m);
+                description += (j == 0 ? (i == 0 ? "" : "; ") : " ") +
+                               std::to_string(m);
+            }
+        }
+        description += "]";
+    } else {
+        throw InvalidStringError(
+            "Could not extract a Coxeter type or matrix from \"" + str + "\"!");
+    }
+
+    if (!is_positive_definite(bilinear_form(matrix, n), n)) {
+        throw InvalidStringError("The Coxeter group " + description +
+                                 " is infinite!");
+    }
+
+    Structure structure = Structure::Classic;
+    if (match[1].matched) {
+        structure = Structure::Dual;
+        description = "dual " + description;
+    }
+    return Parameter(
+        CoxeterParameter::get_lattice(description, matrix, structure));
+}
+
+void Underlying::print(IndentedOStream &os) const {
+    i16 a = lattice->number_of_atoms;
+    bool is_first = true;
+    for (i32 x = index; x != 0;) {
+        i16 t = lattice->first_atom[x];
+        os << (is_first ? "" : " ") << (t < lattice->rank ? "s" : "r") << t + 1;
+        is_first = false;
+        x = lattice->left_multiplication[x * a + t];
+    }
+}
+
+void Underlying::of_string(const std::string &str, size_t &pos) {
+    std::smatch match;
+    static const std::regex delta_regex{"D"};
+    static const std::regex atom_regex{
+        "([sr])[\\s\\t]*_?[\\s\\t]*([1-9][0-9]*)"};
+
+    if (std::regex_search(str.begin() + pos, str.end(), match, delta_regex,
+                          std::regex_constants::match_continuous)) {
+        pos += match[0].length();
+        delta();
+    } else if (std::regex_search(str.begin() + pos, str.end(), match,
+                                 atom_regex,
+                                 std::regex_constants::match_continuous)) {
+        i32 i;
+        try {
+            i = std::stoi(match[2]);
+        } catch (std::out_of_range const &) {
+            throw InvalidStringError("Index is too big!\n" + match.str(2) +
+                                     " can not be converted to a C++ integer.");
+        }
+        i32 max =
+            (match[1] == "s") ? lattice->rank : lattice->number_of_atoms;
+        if ((match[1] == "r") && (lattice->structure != Structure::Dual)) {
+            throw InvalidStringError(
+                "Reflections are only atoms in the dual structure!");
+        }
+        if (i > max) {
+            throw InvalidStringError("Index should be at most " +
+                                     std::to_string(max) + "!");
+        }
+        index = lattice->atoms[i - 1];
+        pos += match[0].length();
+    } else {
+        throw InvalidStringError(std::string(
+            "Could not extract a factor from\n\"" + str.substr(pos) +
+            "\"!\nA factor should match regex ('s' | 'r') '_'? Z | 'D',\n"
+            "where Z matches positive integers, and ignoring whitespaces."));
+    }
+}
+
+void Underlying::debug(IndentedOStream &os) const {
+    os << "{   ";
+    os.Indent(4);
+    os << "lattice:";
+    os.Indent(4);
+    os << EndLine() << lattice->description;
+    os.Indent(-4);
+    os << EndLine();
+    os << "index:";
+    os.Indent(4);
+    os << EndLine();
+    os << index;
+    os.Indent(-8);
+    os << EndLine();
+    os << "}";
+}
+
+Underlying Underlying::product(const Underlying &b) const {
+    i16 a = lattice->number_of_atoms;
+    Underlying f = *this;
+    for (i32 y = b.index; y != 0;) {
+        i16 t = lattice->first_atom[y];
+        f.index = lattice->right_multiplication[f.index * a + t];
+        y = lattice->left_multiplication[y * a + t];
+    }
+    return f;
+}
+
+Underlying Underlying::left_complement(const Underlying &b) const {
+    i16 a = lattice->number_of_atoms;
+    Underlying f = b;
+    for (i32 y = index; y != 0;) {
+        i16 t = lattice->last_atom[y];
+        f.index = lattice->right_multiplication[f.index * a + t];
+        y = lattice->right_multiplication[y * a + t];
+    }
+    return f;
+}
+
+Underlying Underlying::right_complement(const Underlying &b) const {
+    i16 a = lattice->number_of_atoms;
+    Underlying f = b;
+    for (i32 y = index; y != 0;) {
+        i16 t = lattice->first_atom[y];
+        f.index = lattice->left_multiplication[f.index * a + t];
+        y = lattice->left_multiplication[y * a + t];
+    }
+    return f;
+}
+
+void Underlying::delta_conjugate_mut(i16 k) {
+    for (i16 i = 0; i < rem(k, lattice->tau_order); i++) {
+        index = lattice->tau[index];
+    }
+}
+
+Underlying Underlying::left_meet(const Underlying &b) const {
+    i16 a = lattice->number_of_atoms, w = lattice->words;
+    const u64 *divisors = &lattice->left_divisors[0];
+    Underlying f = Underlying(get_parameter());
+    i32 x = index, y = b.index;
+    i16 t;
+    while ((t = lattice->common_atom(divisors + x * w, divisors + y * w)) !=
+           -1) {
+        f.index = lattice->right_multiplication[f.index * a + t];
+        x = lattice->left_multiplication[x * a + t];
+        y = lattice->left_multiplication[y * a + t];
+    }
+    return f;
+}
+
+Underlying Underlying::right_meet(const Underlying &b) const {
+    i16 a = lattice->number_of_atoms, w = lattice->words;
+    const u64 *divisors = &lattice->right_divisors[0];
+    Underlying f = Underlying(get_parameter());
+    i32 x = index, y = b.index;
+    i16 t;
+    while ((t = lattice->common_atom(divisors + x * w, divisors + y * w)) !=
+           -1) {
+        f.index = lattice->left_multiplication[f.index * a + t];
+        x = lattice->right_multiplication[x * a + t];
+        y = lattice->right_multiplication[y * a + t];
+    }
+    return f;
+}
+
+void Underlying::randomize() {
+    index = random_below(lattice->number_of_simples);
+}
+
+std::vector<Underlying> Underlying::atoms() const {
+    std::vector<Underlying> atoms;
+    Underlying atom = Underlying(get_parameter());
+    for (i32 x : lattice->atoms) {
+        atom.index = x;
+        atoms.push_back(atom);
+    }
+    return atoms;
+}
+
+} // namespace garcide::coxeter
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(, coxeter::Underlying)
+
+} // namespace garcide
@@ -68,14 +68,16 @@ void Underlying::print(IndentedOStream &os) const {
 
 void Underlying::of_string(const std::string &str, size_t &pos) {
     std::smatch match;
+    static const std::regex delta_regex{"D"};
+    static const std::regex atom_regex{"(:?s[\\s\\t]*_?)?[\\s\\t]*(" +
+                                       number_regex + ")"};
 
-    if (std::regex_search(str.begin() + pos, str.end(), match, std::regex{"D"},
+    if (std::regex_search(str.begin() + pos, str.end(), match, delta_regex,
                           std::regex_constants::match_continuous)) {
         pos += match[0].length();
         delta();
     } else if (std::regex_search(str.begin() + pos, str.end(), match,
-                                 std::regex{"(:?s[\\s\\t]*_?)?[\\s\\t]*(" +
-                                            number_regex + ")"},
+                                 atom_regex,
                                  std::regex_constants::match_continuous)) {
         vertex = rem(std::stoi(match[1]), get_parameter());
         type = 2;
@@ -204,7 +206,7 @@ void Underlying::delta_conjugate_mut(i16 k) {
 }
 
 void Underlying::randomize() {
-    i16 rand = std::rand() % (get_parameter() + 1);
+    i16 rand = random_below(get_parameter() + 1);
     if (rand == get_parameter()) {
         type = 0;
     } else if (rand == get_parameter() + 1) {
@@ -227,4 +229,399 @@ std::vector<Underlying> Underlying::atoms() const {
     return atoms;
 }
 
-} // namespace garcide::dihedral
\ No newline at end of file
+i16 CompactBraid::reduce(i64 v) const {
+    i64 r = v % number_of_vertices;
+    return i16(r >= 0 ? r : r + number_of_vertices);
+}
+
+void CompactBraid::push_back(i16 v, i16 step, i32 count) {
+    i16 raw = reduce(i64(v) - offset);
+    step = reduce(step);
+    if (!progressions.empty()) {
+        Progression &last = progressions.back();
+        if (last.count == 1) {
+            // A single vertex may be given any step.
+            i16 s = reduce(i64(raw) - last.start);
+            if (count == 1 || s == step) {
+                last.step = s;
+                last.count += count;
+                return;
+            }
+        } else if (raw == reduce(last.start + i64(last.count) * last.step) &&
+                   (count == 1 || step == last.step)) {
+            last.count += count;
+            return;
+        }
+    }
+    progressions.push_back(Progression{raw, step, count});
+}
+
+void CompactBraid::pop_back(i32 count) {
+    while (count > 0) {
+        Progression &last = progressions.back();
+        if (last.count > count) {
+            last.count -= count;
+            return;
+        }
+        count -= last.count;
+        progressions.pop_back();
+    }
+}
+
+CompactBraid::CompactBraid(Parameter n)
+    : number_of_vertices(n), delta(0), offset(0), length(0), progressions() {}
+
+CompactBraid::CompactBraid(const Braid &b)
+    : number_of_vertices(b.get_parameter()), delta(b.inf()), offset(0),
+      length(i32(b.canonical_length())), progressions() {
+    for (Braid::ConstFactorItr it = b.cbegin(); it != b.cend(); it++) {
+        push_back((*it).get_underlying().get_vertex(), 0, 1);
+    }
+}
+
+Braid CompactBraid::to_braid() const {
+    Braid b(get_parameter());
+    std::vector<Factor> atoms = Factor(get_parameter()).atoms();
+    std::vector<i16> v = vertices();
+    // Factors are already left-weighted, so that right multiplication only
+    // checks the last pair.
+    for (std::vector<i16>::iterator it = v.begin(); it != v.end(); it++) {
+        b.right_multiply(atoms[*it]);
+    }
+    b.set_delta(delta);
+    return b;
+}
+
+i16 CompactBraid::vertex_at(i32 i) const {
+    for (std::deque<Progression>::const_iterator it = progressions.begin();
+         it != progressions.end(); it++) {
+        if (i < (*it).count) {
+            return reduce((*it).start + offset + i64(i) * (*it).step);
+        }
+        i -= (*it).count;
+    }
+    return 0;
+}
+
+std::vector<i16> CompactBraid::vertices() const {
+    std::vector<i16> v;
+    v.reserve(length);
+    for (std::deque<Progression>::const_iterator it = progressions.begin();
+         it != progressions.end(); it++) {
+        i16 u = reduce((*it).start + offset);
+        for (i32 k = 0; k < (*it).count; k++) {
+            v.push_back(u);
+            u = reduce(i64(u) + (*it).step);
+        }
+    }
+    return v;
+}
+
+i16 CompactBraid::initial_vertex() const {
+    return reduce(progressions.front().start + offset + 2 * i64(delta));
+}
+
+i16 CompactBraid::final_vertex() const {
+    const Progression &last = progressions.back();
+    return reduce(last.start + offset + i64(last.count - 1) * last.step);
+}
+
+bool CompactBraid::compare(const CompactBraid &b) const {
+    if (number_of_vertices != b.number_of_vertices || delta != b.delta ||
+        length != b.length) {
+        return false;
+    }
+    // Progressions may be cut differently, so we compare them on the
+    // intervals where both are progressions.
+    std::deque<Progression>::const_iterator it = progressions.begin(),
+                                            it2 = b.progressions.begin();
+    i32 k = 0, k2 = 0;
+    while (it != progressions.end()) {
+        i32 common = std::min((*it).count - k, (*it2).count - k2);
+        if (reduce((*it).start + offset + i64(k) * (*it).step) !=
+                reduce((*it2).start + b.offset + i64(k2) * (*it2).step) ||
+            (common > 1 && (*it).step != (*it2).step)) {
+            return false;
+        }
+        k += common;
+        k2 += common;
+        if (k == (*it).count) {
+            it++;
+            k = 0;
+        }
+        if (k2 == (*it2).count) {
+            it2++;
+            k2 = 0;
+        }
+    }
+    return true;
+}
+
+void CompactBraid::right_multiply_reflection(i16 v) {
+    if (length > 0 && reduce(i64(final_vertex()) - v) == 1) {
+        // s_u s_v is Delta, that we move to the left.
+        pop_back(1);
+        length--;
+        delta++;
+        offset = reduce(i64(offset) - 2);
+    } else {
+        push_back(v, 0, 1);
+        length++;
+    }
+}
+
+void CompactBraid::right_multiply(const CompactBraid &b) {
+    delta += b.delta;
+    offset = reduce(offset - 2 * i64(b.delta));
+
+    std::deque<Progression>::const_iterator it = b.progressions.begin();
+
+    // Only the junction may not be left-weighted. After one cancellation of
+    // s_u s_v into Delta, the next pair (u - step - 2, v + step') cancels if
+    // and only if step + step' + 2 is zero, and then goes on until one of the
+    // progressions is exhausted.
+    bool cancels = true;
+    for (; it != b.progressions.end() && cancels; it++) {
+        i16 v = reduce((*it).start + b.offset);
+        i32 remaining = (*it).count;
+        while (remaining > 0 && length > 0 &&
+               reduce(i64(final_vertex()) - v) == 1) {
+            const Progression &last = progressions.back();
+            i32 t = reduce(i64(last.step) + (*it).step + 2) == 0
+                        ? std::min(last.count, remaining)
+                        : 1;
+            pop_back(t);
+            length -= t;
+            delta += t;
+            offset = reduce(offset - 2 * i64(t));
+            v = reduce(v + i64(t) * (*it).step);
+            remaining -= t;
+        }
+        if (remaining > 0) {
+            push_back(v, (*it).step, remaining);
+            length += remaining;
+            cancels = false;
+        }
+    }
+    for (; it != b.progressions.end(); it++) {
+        push_back(reduce((*it).start + b.offset), (*it).step, (*it).count);
+        length += (*it).count;
+    }
+}
+
+CompactBraid CompactBraid::operator*(const CompactBraid &b) const {
+    CompactBraid c = *this;
+    c.right_multiply(b);
+    return c;
+}
+
+CompactBraid CompactBraid::inverse() const {
+    // As for BraidTemplate::inverse, the i-th factor (counting from 1) s_v
+    // becomes s_(v + 2 inf + 2 i - 1), and the order is reversed.
+    CompactBraid b(get_parameter());
+    b.delta = -delta - length;
+    i32 i = length;
+    for (std::deque<Progression>::const_reverse_iterator it =
+             progressions.rbegin();
+         it != progressions.rend(); it++) {
+        i64 last = (*it).start + offset + i64((*it).count - 1) * (*it).step;
+        b.push_back(reduce(last + 2 * i64(delta) + 2 * i64(i) - 1),
+                    reduce(-i64((*it).step) - 2), (*it).count);
+        i -= (*it).count;
+    }
+    b.length = length;
+    return b;
+}
+
+void CompactBraid::delta_conjugate_mut(i32 k) {
+    offset = reduce(offset - 2 * i64(k));
+}
+
+void CompactBraid::conjugate(const CompactBraid &c) {
+    *this = !c * *this * c;
+}
+
+void CompactBraid::cycling() {
+    if (length == 0) {
+        return;
+    }
+    i16 i = initial_vertex();
+    Progression &first = progressions.front();
+    first.start = reduce(i64(first.start) + first.step);
+    if (--first.count == 0) {
+        progressions.pop_front();
+    }
+    length--;
+    right_multiply_reflection(i);
+}
+
+void CompactBraid::print(IndentedOStream &os) const { to_braid().print(os); }
+
+std::size_t CompactBraid::hash() const {
+    std::size_t h = delta;
+    h = h * 31 + length;
+
+    // Progressions may be cut differently, so we hash the maximal ones that
+    // are found reading the vertices from left to right: `first`, `step` and
+    // `count` describe the current one, and `last` is its last vertex. The
+    // step of a single vertex is 0.
+    i16 first = 0, step = 0, last = 0;
+    i32 count = 0;
+    auto emit = [&h, &first, &step, &count]() {
+        h = ((h * 31 + first) * 31 + (count > 1 ? step : 0)) * 31 + count;
+    };
+    for (std::deque<Progression>::const_iterator it = progressions.begin();
+         it != progressions.end(); it++) {
+        i16 v = reduce((*it).start + offset);
+        if (count == 0) {
+            first = v;
+            count = 1;
+        } else if (count == 1) {
+            step = reduce(i64(v) - last);
+            count = 2;
+        } else if (v == reduce(i64(last) + step)) {
+            count++;
+        } else {
+            emit();
+            first = v;
+            count = 1;
+        }
+        last = v;
+
+        if ((*it).count > 1) {
+            if (count == 1) {
+                step = (*it).step;
+            } else if ((*it).step != step) {
+                emit();
+                first = reduce(i64(v) + (*it).step);
+                step = (*it).step;
+                count = 0;
+            }
+            count += (*it).count - 1;
+            last = reduce(v + i64((*it).count - 1) * (*it).step);
+        }
+    }
+    if (count > 0) {
+        emit();
+    }
+    return h;
+}
+
+CompactBraid send_to_super_summit(const CompactBraid &b, CompactBraid &c) {
+    CompactBraid b2 = b;
+    c = CompactBraid(b.get_parameter());
+    while (b2.canonical_length() > 1 &&
+           rem(b2.final_vertex() - b2.initial_vertex(), b.get_parameter()) ==
+               1) {
+        // Cycling creates a Delta, decreasing the canonical length by 2.
+        c.right_multiply_reflection(b2.initial_vertex());
+        b2.cycling();
+    }
+    return b2;
+}
+
+std::vector<CompactBraid> super_summit_set(const CompactBraid &b) {
+    CompactBraid c(b.get_parameter());
+    CompactBraid b2 = send_to_super_summit(b, c);
+
+    if (b2.canonical_length() == 0) {
+        return std::vector<CompactBraid>{b2};
+    }
+
+    // Number of distinct conjugations by powers of Delta.
+    i16 n = b.get_parameter();
+    i16 order = n % 2 == 0 ? n / 2 : n;
+
+    std::unordered_set<CompactBraid> sss;
+    for (i32 j = 0; j < b2.canonical_length(); j++) {
+        for (i16 t = 0; t < order; t++) {
+            CompactBraid b3 = b2;
+            b3.delta_conjugate_mut(t);
+            sss.insert(b3);
+        }
+        b2.cycling();
+    }
+    return std::vector<CompactBraid>(sss.begin(), sss.end());
+}
+
+bool are_conjugate(const CompactBraid &b1, const CompactBraid &b2,
+                   CompactBraid &c) {
+    i16 n = b1.get_parameter();
+    CompactBraid c1(n), c2(n);
+
+    CompactBraid bt1 = send_to_super_summit(b1, c1),
+                 bt2 = send_to_super_summit(b2, c2);
+
+    if (bt1.canonical_length() != bt2.canonical_length() ||
+        bt1.inf() != bt2.inf()) {
+        return false;
+    }
+
+    if (bt1.canonical_length() == 0) {
+        c = c1 * !c2;
+        return true;
+    }
+
+    i32 l = bt1.canonical_length();
+    std::vector<i16> v1 = bt1.vertices(), v2 = bt2.vertices();
+
+    // Cyclic sequences of differences between successive vertices, cycling
+    // adding 2 inf to the vertex that goes to the end.
+    std::vector<i16> d1(l), d2(l);
+    for (i32 i = 0; i < l; i++) {
+        d1[i] = rem((i + 1 < l ? v1[i + 1] : bt1.initial_vertex()) - v1[i], n);
+        d2[i] = rem((i + 1 < l ? v2[i + 1] : bt2.initial_vertex()) - v2[i], n);
+    }
+
+    // Knuth-Morris-Pratt search of d2 in the rotations of d1.
+    std::vector<i32> failure(l + 1, 0);
+    failure[0] = -1;
+    for (i32 i = 1, k = -1; i <= l; i++) {
+        while (k >= 0 && d2[k] != d2[i - 1]) {
+            k = failure[k];
+        }
+        failure[i] = ++k;
+    }
+
+    for (i32 i = 0, k = 0; i < 2 * l - 1; i++) {
+        while (k >= 0 && (k == l || d2[k] != d1[i % l])) {
+            k = failure[k];
+        }
+        if (++k < l) {
+            continue;
+        }
+
+        // The j-th cycling of bt1 has the same differences as bt2, it remains
+        // to find a power of Delta conjugating their first vertices.
+        i32 j = i - l + 1;
+        i16 diff = rem(v1[j] - v2[0], n);
+        i16 t;
+        if (n % 2 == 1) {
+            t = i16((i64(diff) * ((n + 1) / 2)) % n);
+        } else if (diff % 2 == 0) {
+            t = diff / 2;
+        } else {
+            continue;
+        }
+
+        CompactBraid p(n);
+        for (i32 k2 = 0; k2 < j; k2++) {
+            p.right_multiply_reflection(rem(v1[k2] + 2 * bt1.inf(), n));
+        }
+        CompactBraid d(n);
+        d.set_delta(t);
+
+        c = c1 * p * d * !c2;
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace garcide::dihedral
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(, dihedral::Underlying)
+
+} // namespace garcide
@@ -29,6 +29,13 @@
  */
 
 #include "garcide/groups/dual_complex.hpp"
+#include <algorithm>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_PRODUCT
+#include <immintrin.h>
+#endif
 
 namespace garcide::dual_complex {
 
@@ -59,22 +66,17 @@ Underlying::Parameter Underlying::parameter_of_string(const std::string &str) {
                                      match.str(2) +
                                      " can not be converted to a C++ integer.");
         }
-        if ((2 <= e) && (2 <= n) && (n <= MAX_N_PARAMETER) &&
-            (e * n <= MAX_E_PARAMETER * MAX_N_PARAMETER)) {
-            return EENParameter(e, n);
-        } else if (2 > e) {
+        if (2 > e) {
             throw InvalidStringError("e should be at least 2!");
         } else if (2 > n) {
             throw InvalidStringError("n should be at least 2!");
-        } else if (n > MAX_N_PARAMETER) {
-            throw InvalidStringError("n is too big!\n" + match.str(1) +
-                                     " is strictly greater than " +
-                                     std::to_string(MAX_N_PARAMETER) + ".");
-        } else {
+        } else if (i64(e) * i64(n) >= i64(std::numeric_limits<i16>::max())) {
+            // Indexes range up to e * n, and are stored as i16.
             throw InvalidStringError(
                 "e * n is too big!\n" + match.str(1) + " * " + match.str(2) +
-                " = " + std::to_string(e * n) + " is strictly greater than " +
-                std::to_string(MAX_N_PARAMETER * MAX_E_PARAMETER) + ".");
+                " can not be converted to a C++ integer.");
+        } else {
+            return EENParameter(e, n);
         }
     } else {
         throw InvalidStringError(
@@ -83,7 +85,7 @@ Underlying::Parameter Underlying::parameter_of_string(const std::string &str) {
 }
 
 Underlying::Underlying(Parameter p)
-    : een_index(p), permutation_table(p.n + 1), coefficient_table(p.n + 1) {}
+    : een_index(p), tables(2 * (p.n + 1)) {}
 
 void Underlying::debug(IndentedOStream &os) const {
     os << "{   ";
@@ -98,9 +100,9 @@ void Underlying::debug(IndentedOStream &os) const {
     os << EndLine();
     os << "[";
     for (i16 i = 0; i < get_parameter().n; i++) {
-        os << permutation_table[i] << ", ";
+        os << permutation_table(i) << ", ";
     }
-    os << permutation_table[get_parameter().n];
+    os << permutation_table(get_parameter().n);
     os << "]";
     os.Indent(-4);
     os << EndLine();
@@ -109,9 +111,9 @@ void Underlying::debug(IndentedOStream &os) const {
     os << EndLine();
     os << "[";
     for (i16 i = 0; i < get_parameter().n; i++) {
-        os << coefficient_table[i] << ", ";
+        os << coefficient_table(i) << ", ";
     }
-    os << coefficient_table[get_parameter().n];
+    os << coefficient_table(get_parameter().n);
     os << "]";
     os.Indent(-8);
     os << EndLine();
@@ -126,7 +128,7 @@ void Underlying::print(IndentedOStream &os) const {
     seen[0] = true;
     bool is_first = true;
 
-    curr = permutation_table[0];
+    curr = permutation_table(0);
     // Short assymetric case.
     if (curr != 0) {
         while (curr != 0) {
@@ -136,7 +138,7 @@ void Underlying::print(IndentedOStream &os) const {
                 ((curr < curr_cycle[other_smallest]) && (curr != 0))
                     ? c
                     : other_smallest;
-            curr = permutation_table[curr];
+            curr = permutation_table(curr);
             c++;
         }
         other_smallest =
@@ -147,16 +149,16 @@ void Underlying::print(IndentedOStream &os) const {
         for (i16 i = int(curr_cycle.size()) - 1; i >= 1; i--) {
             os << "s("
                << ((i >= other_smallest)
-                       ? curr_cycle[i] + rem(coefficient_table[0] + 1, e) * n
-                       : curr_cycle[i] + coefficient_table[0] * n)
+                       ? curr_cycle[i] + rem(coefficient_table(0) + 1, e) * n
+                       : curr_cycle[i] + coefficient_table(0) * n)
                << ", "
                << ((i >= other_smallest + 1)
                        ? curr_cycle[i - 1] +
-                             rem(coefficient_table[0] + 1, e) * n
-                       : curr_cycle[i - 1] + coefficient_table[0] * n)
+                             rem(coefficient_table(0) + 1, e) * n
+                       : curr_cycle[i - 1] + coefficient_table(0) * n)
                << ") ";
         }
-        os << curr_cycle[0] + coefficient_table[0] * n;
+        os << curr_cycle[0] + coefficient_table(0) * n;
     }
 
     for (i16 i = 1; i <= n; ++i) {
@@ -164,22 +166,22 @@ void Underlying::print(IndentedOStream &os) const {
             seen[i] = true;
             c = 0;
             other_smallest = 0;
-            cycle_type = coefficient_table[i];
-            if (coefficient_table[i] == e - 1) {
+            cycle_type = coefficient_table(i);
+            if (coefficient_table(i) == e - 1) {
                 other_smallest = c + 1;
             }
-            curr = permutation_table[i];
+            curr = permutation_table(i);
             curr_cycle.clear();
             curr_cycle.push_back(i);
             while (curr != i) {
                 curr_cycle.push_back(curr);
                 seen[curr] = true;
                 c++;
-                if (coefficient_table[curr] == e - 1) {
+                if (coefficient_table(curr) == e - 1) {
                     other_smallest = c + 1;
                 }
-                cycle_type += coefficient_table[curr];
-                curr = permutation_table[curr];
+                cycle_type += coefficient_table(curr);
+                curr = permutation_table(curr);
             }
             // If cycle_type == 0, then the cycle is short.
             if (rem(cycle_type, e) == 0) {
@@ -231,16 +233,19 @@ void Underlying::print(IndentedOStream &os) const {
 void Underlying::of_string(const std::string &str, size_t &pos) {
     i16 n = get_parameter().n, e = get_parameter().e;
     std::smatch match;
-    if (std::regex_search(str.begin() + pos, str.end(), match, std::regex{"D"},
+    static const std::regex delta_regex{"D"};
+    static const std::regex atom_regex{
+        "(:?a[\\s\\t]*_?)?[\\s\\t]*\\([\\s\\t]*(" + number_regex +
+        ")[\\s\\t]*,?[\\s\\t]*(" + number_regex + ")[\\s\\t]*\\)"};
+    static const std::regex long_atom_regex{"(:?a[\\s\\t]*_?)?[\\s\\t]*(" +
+                                            number_regex + ")"};
+    if (std::regex_search(str.begin() + pos, str.end(), match, delta_regex,
                           std::regex_constants::match_continuous)) {
         pos += match[0].length();
         delta();
-    } else if (std::regex_search(
-                   str.begin() + pos, str.end(), match,
-                   std::regex{"(:?a[\\s\\t]*_?)?[\\s\\t]*\\([\\s\\t]*(" +
-                              number_regex + ")[\\s\\t]*,?[\\s\\t]*(" +
-                              number_regex + ")[\\s\\t]*\\)"},
-                   std::regex_constants::match_continuous)) {
+    } else if (std::regex_search(str.begin() + pos, str.end(), match,
+                                 atom_regex,
+                                 std::regex_constants::match_continuous)) {
         i16 i = std::stoi(match[1]);
         i16 j = std::stoi(match[2]);
         pos += match[0].length();
@@ -259,10 +264,10 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
             j = rem(j - 1, n) + 1;
             j = (j < i) ? j + n : j;
             identity();
-            permutation_table[i] = (j > n) ? j - n : j;
-            permutation_table[(j > n) ? j - n : j] = i;
-            coefficient_table[i] = (j > n) ? 1 : 0;
-            coefficient_table[(j > n) ? j - n : j] = (j > n) ? e - 1 : 0;
+            permutation_table(i) = (j > n) ? j - n : j;
+            permutation_table((j > n) ? j - n : j) = i;
+            coefficient_table(i) = (j > n) ? 1 : 0;
+            coefficient_table((j > n) ? j - n : j) = (j > n) ? e - 1 : 0;
         } else if ((rem(i, n) == rem(j, n))) {
             throw InvalidStringError("Indexes for short symmetric generators "
                                      "should not be equal mod " +
@@ -280,8 +285,7 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
                 ") is not a valid factor.");
         }
     } else if (std::regex_search(str.begin() + pos, str.end(), match,
-                                 std::regex{"(:?a[\\s\\t]*_?)?[\\s\\t]*(" +
-                                            number_regex + ")"},
+                                 long_atom_regex,
                                  std::regex_constants::match_continuous)) {
         i16 i = std::stoi(match[1]);
         pos += match[0].length();
@@ -289,10 +293,10 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
         i16 q = rem(quot(i - 1, n), e);
         i16 r = rem(i - 1, n) + 1;
         identity();
-        permutation_table[0] = r;
-        permutation_table[r] = 0;
-        coefficient_table[0] = q;
-        coefficient_table[r] = (q == 0) ? 0 : e - q;
+        permutation_table(0) = r;
+        permutation_table(r) = 0;
+        coefficient_table(0) = q;
+        coefficient_table(r) = (q == 0) ? 0 : e - q;
     } else {
         throw InvalidStringError(
             "Could not extract a factor from \"" + str.substr(pos) +
@@ -304,14 +308,15 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
 
 void Underlying::assign_partition(i16 *x) const {
     i16 n = get_parameter().n, e = get_parameter().e;
-    std::vector<i16> curr_cycle;
+    thread_local std::vector<i16> curr_cycle;
     i16 other_smallest, cycle_type, curr, c;
+    curr_cycle.clear();
     for (i16 i = 1; i <= e * n; ++i) {
         x[i] = -1;
     }
     x[0] = 0;
 
-    curr = permutation_table[0];
+    curr = permutation_table(0);
     if (curr != 0) {
         other_smallest = 0;
         c = 0;
@@ -321,7 +326,7 @@ void Underlying::assign_partition(i16 *x) const {
                 ((curr < curr_cycle[other_smallest]) && (curr != 0))
                     ? c
                     : other_smallest;
-            curr = permutation_table[curr];
+            curr = permutation_table(curr);
             c++;
         }
         if (other_smallest != 0) {
@@ -330,21 +335,21 @@ void Underlying::assign_partition(i16 *x) const {
                     x[curr_cycle[k] + l * n] = curr_cycle[0] + l * n;
                 }
                 x[curr_cycle[k] + (e - 1) * n] = curr_cycle[other_smallest];
-                x[curr_cycle[k] + rem(coefficient_table[0], e) * n] = 0;
+                x[curr_cycle[k] + rem(coefficient_table(0), e) * n] = 0;
             }
             for (i16 k = other_smallest; k < int(curr_cycle.size()); k++) {
                 for (i16 l = 0; l < e - 1; l++) {
                     x[curr_cycle[k] + (l + 1) * n] = curr_cycle[0] + l * n;
                 }
                 x[curr_cycle[k]] = curr_cycle[other_smallest];
-                x[curr_cycle[k] + rem(coefficient_table[0] + 1, e) * n] = 0;
+                x[curr_cycle[k] + rem(coefficient_table(0) + 1, e) * n] = 0;
             }
         } else {
             for (i16 k = 0; k < int(curr_cycle.size()); k++) {
                 for (i16 l = 0; l < e; l++) {
                     x[curr_cycle[k] + l * n] = curr_cycle[0] + l * n;
                 }
-                x[curr_cycle[k] + rem(coefficient_table[0], e) * n] = 0;
+                x[curr_cycle[k] + rem(coefficient_table(0), e) * n] = 0;
             }
         }
     }
@@ -353,21 +358,26 @@ void Underlying::assign_partition(i16 *x) const {
         if (x[i] < 0) {
             c = 0;
             other_smallest = 0;
-            cycle_type = coefficient_table[i];
-            if (coefficient_table[i] == e - 1) {
+            cycle_type = coefficient_table(i);
+            if (coefficient_table(i) == e - 1) {
                 other_smallest = 1;
             }
-            curr = permutation_table[i];
+            curr = permutation_table(i);
             curr_cycle.clear();
             curr_cycle.push_back(i);
             while (curr != i) {
                 curr_cycle.push_back(curr);
                 c++;
-                if (coefficient_table[curr] == e - 1) {
+                if (coefficient_table(curr) == e - 1) {
                     other_smallest = c + 1;
                 }
-                cycle_type += coefficient_table[curr];
-                curr = permutation_table[curr];
+                cycle_type += coefficient_table(curr);
+                curr = permutation_table(curr);
+            }
+            // A coefficient e - 1 on the last index of the cycle wraps around
+            // to its first one: the cycle is then not split.
+            if (other_smallest == int(curr_cycle.size())) {
+                other_smallest = 0;
             }
             // If cycle_type == 0, then the cycle is short.
             if (rem(cycle_type, e) == 0) {
@@ -409,26 +419,30 @@ void Underlying::assign_partition(i16 *x) const {
 
 // We assume e > 1.
 void Underlying::of_partition(const i16 *x) {
-    thread_local i16 z[MAX_N_PARAMETER + 1];
+    thread_local std::vector<i16> z;
     i16 min_cycle_0 = 0, max_cycle_0 = 0;
     i16 n = get_parameter().n, e = get_parameter().e, r;
 
+    if (z.size() < size_t(n + 1)) {
+        z.resize(n + 1);
+    }
+
     for (i16 i = 0; i <= n; ++i) {
         z[i] = -1;
-        permutation_table[i] = -1;
-        coefficient_table[i] = -1;
+        permutation_table(i) = -1;
+        coefficient_table(i) = -1;
     }
     // First find short symmetrical cycles.
     for (i16 i = 2 * n - 1; i >= n + 1; --i) {
         if ((x[i] <= n) && (x[i] >= 1)) {
             r = i - n;
             if (z[x[i]] == -1) {
-                permutation_table[r] = x[i];
-                coefficient_table[r] = e - 1;
+                permutation_table(r) = x[i];
+                coefficient_table(r) = e - 1;
                 z[x[i]] = r;
             } else {
-                permutation_table[r] = z[x[i]];
-                coefficient_table[r] = 0;
+                permutation_table(r) = z[x[i]];
+                coefficient_table(r) = 0;
                 z[x[i]] = r;
             }
         }
@@ -436,11 +450,11 @@ void Underlying::of_partition(const i16 *x) {
     for (i16 i = n; i >= 1; --i) {
         if ((x[i] <= n) && (x[i] >= 1) && (x[i + n] > n)) {
             if ((z[x[i]] == -1)) {
-                permutation_table[i] = x[i];
-                coefficient_table[i] = 0;
+                permutation_table(i) = x[i];
+                coefficient_table(i) = 0;
             } else {
-                coefficient_table[i] = (z[x[i]] < i) ? 1 : 0;
-                permutation_table[i] = z[x[i]];
+                coefficient_table(i) = (z[x[i]] < i) ? 1 : 0;
+                permutation_table(i) = z[x[i]];
             }
             z[x[i]] = i;
         }
@@ -456,16 +470,16 @@ void Underlying::of_partition(const i16 *x) {
     if (min_cycle_0 != 0) {
         // Determine if it is long symmetric.
         if (x[rem(min_cycle_0 + n - 1, e * n) + 1] == 0) {
-            coefficient_table[0] = e - 1;
-            permutation_table[0] = 0;
+            coefficient_table(0) = e - 1;
+            permutation_table(0) = 0;
             for (i16 i = n; i >= 1; i--) {
                 if (x[i] == 0) {
                     if (z[x[i]] == -1) {
-                        permutation_table[i] = min_cycle_0;
-                        coefficient_table[i] = 1;
+                        permutation_table(i) = min_cycle_0;
+                        coefficient_table(i) = 1;
                     } else {
-                        permutation_table[i] = z[x[i]];
-                        coefficient_table[i] = 0;
+                        permutation_table(i) = z[x[i]];
+                        coefficient_table(i) = 0;
                     }
                     z[x[i]] = i;
                 }
@@ -497,15 +511,15 @@ void Underlying::of_partition(const i16 *x) {
                 q_max = quot(max_cycle_0 - 1, n);
             i16 r_min = rem(min_cycle_0 - 1, n) + 1;
             z[0] = 0;
-            coefficient_table[0] = q_min;
-            permutation_table[0] = r_min;
+            coefficient_table(0) = q_min;
+            permutation_table(0) = r_min;
 
             for (i16 i = n - 1; i >= n - r_min + 1; --i) {
                 i16 i_en = rem(i + min_cycle_0 - 1, e * n) + 1;
                 r = rem(i + min_cycle_0 - 1, n) + 1;
                 if (x[i_en] == 0) {
-                    permutation_table[r] = z[0];
-                    coefficient_table[r] = (z[0] == 0) ? rem(e - q_max, e) : 0;
+                    permutation_table(r) = z[0];
+                    coefficient_table(r) = (z[0] == 0) ? rem(e - q_max, e) : 0;
                     z[0] = r;
                 }
             }
@@ -514,11 +528,11 @@ void Underlying::of_partition(const i16 *x) {
                 r = rem(i + min_cycle_0 - 1, n) + 1;
                 if ((x[i_en] == 0)) {
                     if (z[0] == 0) {
-                        permutation_table[r] = z[0];
-                        coefficient_table[r] = rem(e - q_min, e);
+                        permutation_table(r) = z[0];
+                        coefficient_table(r) = rem(e - q_min, e);
                     } else {
-                        coefficient_table[r] = (z[0] < r) ? 1 : 0;
-                        permutation_table[r] = z[0];
+                        coefficient_table(r) = (z[0] < r) ? 1 : 0;
+                        permutation_table(r) = z[0];
                     }
                     z[0] = r;
                 }
@@ -528,78 +542,174 @@ void Underlying::of_partition(const i16 *x) {
 
     // Short symmetric case.
     else {
-        coefficient_table[0] = 0;
-        permutation_table[0] = 0;
+        coefficient_table(0) = 0;
+        permutation_table(0) = 0;
     }
 }
 
-Underlying Underlying::left_meet(const Underlying &b) const {
-    thread_local i16 x[MAX_E_PARAMETER * MAX_N_PARAMETER + 1],
-        y[MAX_E_PARAMETER * MAX_N_PARAMETER + 1],
-        z[MAX_E_PARAMETER * MAX_N_PARAMETER + 1];
-
-    assign_partition(x);
-    b.assign_partition(y);
+const i16 *Underlying::meet_partition(const Underlying &b) const {
+    thread_local std::vector<i16> x, y, z, order, start, first;
+    i16 en = get_parameter().e * get_parameter().n;
+
+    if (x.size() < size_t(en + 1)) {
+        x.resize(en + 1);
+        y.resize(en + 1);
+        z.resize(en + 1);
+        order.resize(en + 1);
+        start.resize(en + 2);
+        first.resize(en + 1, -1);
+    }
 
-    thread_local i16 P[MAX_E_PARAMETER * MAX_N_PARAMETER + 1]
-                      [MAX_E_PARAMETER * MAX_N_PARAMETER + 1];
+    assign_partition(x.data());
+    b.assign_partition(y.data());
 
-    for (i16 i = get_parameter().e * get_parameter().n; i >= 0; i--) {
-        P[x[i]][y[i]] = i;
+    // Counting sort of the indexes along the cells of x, keeping them in
+    // increasing order inside each cell.
+    std::fill(start.begin(), start.begin() + en + 2, 0);
+    for (i16 i = 0; i <= en; i++) {
+        start[x[i] + 1]++;
+    }
+    for (i16 c = 0; c <= en; c++) {
+        start[c + 1] += start[c];
+    }
+    for (i16 i = 0; i <= en; i++) {
+        order[start[x[i]]++] = i;
     }
 
-    for (i16 i = 0; i <= get_parameter().e * get_parameter().n; i++) {
-        z[i] = P[x[i]][y[i]];
+    // Each cell of x is split along the cells of y, the new cells being
+    // labelled by their smallest index. `start[c]` now points to the end of
+    // the cell c.
+    i16 begin = 0;
+    for (i16 c = 0; c <= en; c++) {
+        for (i16 k = begin; k < start[c]; k++) {
+            i16 i = order[k];
+            if (first[y[i]] < 0) {
+                first[y[i]] = i;
+            }
+            z[i] = first[y[i]];
+        }
+        for (i16 k = begin; k < start[c]; k++) {
+            first[y[order[k]]] = -1;
+        }
+        begin = start[c];
     }
 
+    return z.data();
+}
+
+Underlying Underlying::left_meet(const Underlying &b) const {
     Underlying c = Underlying(*this);
 
-    c.of_partition(z);
+    c.of_partition(meet_partition(b));
 
     return c;
 }
 
+bool Underlying::left_meet_is_identity(const Underlying &b) const {
+    const i16 *z = meet_partition(b);
+    for (i16 i = 0; i <= get_parameter().e * get_parameter().n; i++) {
+        if (z[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Underlying::identity() {
     for (i16 i = 0; i <= get_parameter().n; i++) {
-        permutation_table[i] = i;
-        coefficient_table[i] = 0;
+        permutation_table(i) = i;
+        coefficient_table(i) = 0;
     }
 }
 
 void Underlying::delta() {
     i16 i, n = get_parameter().n;
     for (i = 1; i <= n; i++) {
-        permutation_table[i] = i + 1;
-        coefficient_table[i] = 0;
+        permutation_table(i) = i + 1;
+        coefficient_table(i) = 0;
     }
-    permutation_table[0] = 0;
-    coefficient_table[0] = get_parameter().e - 1;
-    permutation_table[n] = 1;
-    coefficient_table[n] = 1;
+    permutation_table(0) = 0;
+    coefficient_table(0) = get_parameter().e - 1;
+    permutation_table(n) = 1;
+    coefficient_table(n) = 1;
 }
 
 Underlying Underlying::inverse() const {
     Underlying f = Underlying(get_parameter());
     i16 i, n = get_parameter().n, e = get_parameter().e;
     for (i = 0; i <= n; i++) {
-        if ((permutation_table[i] > n) || (permutation_table[i] < 0)) {
+        if ((permutation_table(i) > n) || (permutation_table(i) < 0)) {
             while (true) {
             };
         }
-        f.permutation_table[permutation_table[i]] = i;
-        f.coefficient_table[permutation_table[i]] =
-            coefficient_table[i] == 0 ? 0 : e - coefficient_table[i];
+        f.permutation_table(permutation_table(i)) = i;
+        f.coefficient_table(permutation_table(i)) =
+            coefficient_table(i) == 0 ? 0 : e - coefficient_table(i);
     }
     return f;
 }
 
+namespace {
+
+#ifdef SIMD_PRODUCT
+
+// Product of the interleaved tables `a` and `b` into `f`, for entries [0, m[
+// with m a multiple of 4, four entries (eight integers) at a time.
+//
+// The permutation entries of `a`, doubled, are the indexes of the entries of
+// `b` to gather, and the coefficients are then added modulo e by a compare
+// and subtract, as both summands are in [0, e[.
+__attribute__((target("avx2"))) void product_avx2(const i16 *a, const i16 *b,
+                                                  i16 *f, i16 m, i16 e) {
+    const __m256i parity = _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1);
+    const __m256i odd = _mm256_cmpeq_epi32(parity, _mm256_set1_epi32(1));
+    const __m256i E = _mm256_set1_epi32(e);
+    const __m256i E_minus_one = _mm256_set1_epi32(e - 1);
+    for (i16 i = 0; i < 2 * m; i += 8) {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)(a + i));
+        const __m256i from = _mm256_add_epi32(
+            _mm256_slli_epi32(
+                _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 2, 0, 0)), 1),
+            parity);
+        __m256i y = _mm256_add_epi32(_mm256_i32gather_epi32(b, from, 4),
+                                     _mm256_and_si256(x, odd));
+        y = _mm256_sub_epi32(
+            y, _mm256_and_si256(
+                   _mm256_and_si256(_mm256_cmpgt_epi32(y, E_minus_one), odd),
+                   E));
+        _mm256_storeu_si256((__m256i *)(f + i), y);
+    }
+}
+
+#endif
+
+// Computes the product of the first m entries of the interleaved tables `a`
+// and `b` into `f` with a vectorized routine, if one is available on this
+// machine and enabled (see `set_simd_kernels`), and returns the number of
+// entries that were computed.
+i16 fast_product(const i16 *a, const i16 *b, i16 *f, i16 m, i16 e) {
+#ifdef SIMD_PRODUCT
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2 && simd_kernels()) {
+        m -= m % 4;
+        product_avx2(a, b, f, m, e);
+        return m;
+    }
+#endif
+    return 0;
+}
+
+} // namespace
+
 Underlying Underlying::product(const Underlying &b) const {
     Underlying f = Underlying(get_parameter());
     i16 i, n = get_parameter().n, e = get_parameter().e;
-    for (i = 0; i <= n; i++) {
-        f.permutation_table[i] = b.permutation_table[permutation_table[i]];
-        f.coefficient_table[i] = rem(b.coefficient_table[permutation_table[i]] +
-                                         coefficient_table[i],
+    for (i = fast_product(tables.data(), b.tables.data(), f.tables.data(),
+                          n + 1, e);
+         i <= n; i++) {
+        f.permutation_table(i) = b.permutation_table(permutation_table(i));
+        f.coefficient_table(i) = rem(b.coefficient_table(permutation_table(i)) +
+                                         coefficient_table(i),
                                      e);
     }
     return f;
@@ -613,23 +723,78 @@ Underlying Underlying::right_complement(const Underlying &b) const {
     return inverse().product(b);
 }
 
+bool Underlying::is_identity() const {
+    for (i16 i = 0; i <= get_parameter().n; i++) {
+        if ((permutation_table(i) != i) || (coefficient_table(i) != 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Underlying::is_delta() const {
+    i16 n = get_parameter().n;
+    if ((permutation_table(0) != 0) ||
+        (coefficient_table(0) != get_parameter().e - 1) ||
+        (permutation_table(n) != 1) || (coefficient_table(n) != 1)) {
+        return false;
+    }
+    for (i16 i = 1; i < n; i++) {
+        if ((permutation_table(i) != i + 1) || (coefficient_table(i) != 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The complements below are those of `Delta`, whose tables are read from
+// `delta()`: row 0 is fixed with coefficient e - 1, row i in [1, n - 1] goes
+// to i + 1, and row n goes to 1 with coefficient 1.
+
+Underlying Underlying::left_complement() const {
+    Underlying f = Underlying(get_parameter());
+    i16 n = get_parameter().n, e = get_parameter().e;
+    for (i16 i = 0; i <= n; i++) {
+        i16 j = permutation_table(i);
+        // The row that `Delta` sends to j.
+        i16 k = (j == 0) ? 0 : ((j == 1) ? n : j - 1);
+        i16 c = (k == 0) ? e - 1 : ((k == n) ? 1 : 0);
+        f.permutation_table(k) = i;
+        f.coefficient_table(k) = rem(c - coefficient_table(i), e);
+    }
+    return f;
+}
+
+Underlying Underlying::right_complement() const {
+    Underlying f = Underlying(get_parameter());
+    i16 n = get_parameter().n, e = get_parameter().e;
+    for (i16 i = 0; i <= n; i++) {
+        i16 j = (i == 0) ? 0 : ((i == n) ? 1 : i + 1);
+        i16 c = (i == 0) ? e - 1 : ((i == n) ? 1 : 0);
+        f.permutation_table(permutation_table(i)) = j;
+        f.coefficient_table(permutation_table(i)) =
+            rem(c - coefficient_table(i), e);
+    }
+    return f;
+}
+
 void Underlying::delta_conjugate_mut(i16 k) {
     i16 i, n = get_parameter().n, e = get_parameter().e;
     i16 q = quot(k, n), r = rem(k, n), q_e = rem(q, e);
 
     Underlying delta_k = Underlying(get_parameter());
 
-    delta_k.permutation_table[0] = 0;
-    delta_k.coefficient_table[0] = rem(-k, e);
+    delta_k.permutation_table(0) = 0;
+    delta_k.coefficient_table(0) = rem(-k, e);
     for (i = 1; i <= n - r; i++) {
-        delta_k.permutation_table[i] = rem(i + k - 1, n) + 1;
-        delta_k.coefficient_table[i] = q_e;
+        delta_k.permutation_table(i) = rem(i + k - 1, n) + 1;
+        delta_k.coefficient_table(i) = q_e;
     }
     q_e += 1;
     q_e = ((q_e == e) ? 0 : q_e);
     for (i = n - r + 1; i <= n; i++) {
-        delta_k.permutation_table[i] = rem(i + k - 1, n) + 1;
-        delta_k.coefficient_table[i] = q_e;
+        delta_k.permutation_table(i) = rem(i + k - 1, n) + 1;
+        delta_k.coefficient_table(i) = q_e;
     }
 
     *this = delta_k.inverse().product((*this).product(delta_k));
@@ -645,34 +810,34 @@ std::vector<Underlying> Underlying::atoms() const {
     for (i16 i = 1; i <= n; i++) {
         for (i16 j = i + 1; j <= n; j++) {
             atom.identity();
-            atom.permutation_table[i] = j;
-            atom.permutation_table[j] = i;
+            atom.permutation_table(i) = j;
+            atom.permutation_table(j) = i;
             atoms.push_back(atom);
         }
         for (i16 j = 1; j < i; j++) {
             atom.identity();
-            atom.permutation_table[i] = j;
-            atom.permutation_table[j] = i;
-            atom.coefficient_table[i] = 1;
-            atom.coefficient_table[j] = e - 1;
+            atom.permutation_table(i) = j;
+            atom.permutation_table(j) = i;
+            atom.coefficient_table(i) = 1;
+            atom.coefficient_table(j) = e - 1;
             atoms.push_back(atom);
         }
     }
     for (i16 i = 1; i <= n; i++) {
         atom.identity();
-        atom.permutation_table[0] = i;
-        atom.permutation_table[i] = 0;
-        atom.coefficient_table[0] = 0;
-        atom.coefficient_table[i] = 0;
+        atom.permutation_table(0) = i;
+        atom.permutation_table(i) = 0;
+        atom.coefficient_table(0) = 0;
+        atom.coefficient_table(i) = 0;
         atoms.push_back(atom);
     }
     for (i16 k = 1; k < e; k++) {
         for (i16 i = 1; i <= n; i++) {
             atom.identity();
-            atom.permutation_table[0] = i;
-            atom.permutation_table[i] = 0;
-            atom.coefficient_table[0] = k;
-            atom.coefficient_table[i] = e - k;
+            atom.permutation_table(0) = i;
+            atom.permutation_table(i) = 0;
+            atom.coefficient_table(0) = k;
+            atom.coefficient_table(i) = e - k;
             atoms.push_back(atom);
         }
     }
@@ -682,12 +847,97 @@ std::vector<Underlying> Underlying::atoms() const {
 std::size_t Underlying::hash() const {
     std::size_t h = 0;
     for (i16 i = 1; i <= get_parameter().n; i++) {
-        h = h * 31 + permutation_table[i];
+        h = h * 31 + permutation_table(i);
     }
     for (i16 i = 1; i <= get_parameter().n; i++) {
-        h = h * 31 + coefficient_table[i];
+        h = h * 31 + coefficient_table(i);
     }
     return h;
 }
 
-} // namespace garcide::dual_complex
\ No newline at end of file
+void Underlying::pack(u8 *out) const {
+    for (i16 i = 0; i <= get_parameter().n; i++) {
+        pack_u16(out + 4 * i, u16(permutation_table(i)));
+        pack_u16(out + 4 * i + 2, u16(coefficient_table(i)));
+    }
+}
+
+bool Underlying::unpack(const u8 *in) {
+    i16 n = get_parameter().n, e = get_parameter().e, m = e * n;
+    std::vector<i16> perm(n + 1);
+    i16 determinant = 0;
+    for (i16 i = 0; i <= n; i++) {
+        permutation_table(i) = perm[i] = i16(unpack_u16(in + 4 * i));
+        coefficient_table(i) = i16(unpack_u16(in + 4 * i + 2));
+        if (coefficient_table(i) >= e) {
+            return false;
+        }
+        determinant += coefficient_table(i);
+    }
+    if (!is_permutation_table(perm.data(), 0, n) || rem(determinant, e) != 0) {
+        return false;
+    }
+    // For e = 2, the partitions of some factors do not convert back to them,
+    // so that only the tables are checked.
+    if (e == 2) {
+        return true;
+    }
+
+    // The points of the partition are 0 (whose cell is labelled 0) and the
+    // `m` roots of unity around it.
+    std::vector<i16> x(m + 1);
+    assign_partition(x.data());
+    if (!is_noncrossing(x.data(), m)) {
+        return false;
+    }
+
+    // The convex hull of a cell that does not hold 0 must not meet 0, nor
+    // the segments from 0 to the points of its cell: the cell must lie in an
+    // open half circle (that is, it must have a gap of more than `m / 2`),
+    // and the arc it spans (outside of its largest gap) must not hold points
+    // of the cell of 0.
+    std::vector<i16> first(m + 1, 0), last(m + 1, 0), gap(m + 1, 0),
+        gap_end(m + 1, 0), zeros(m + 1, 0);
+    for (i16 i = 1; i <= m; i++) {
+        zeros[i] = zeros[i - 1] + ((x[i] == 0) ? 1 : 0);
+        if (first[x[i]] == 0) {
+            first[x[i]] = i;
+        } else if (i - last[x[i]] > gap[x[i]]) {
+            gap[x[i]] = i - last[x[i]];
+            gap_end[x[i]] = i;
+        }
+        last[x[i]] = i;
+    }
+    for (i16 l = 1; l <= m; l++) {
+        if (first[l] == 0) {
+            continue;
+        }
+        if (first[l] + m - last[l] > gap[l]) {
+            gap[l] = first[l] + m - last[l];
+            gap_end[l] = first[l];
+        }
+        if (2 * gap[l] <= m) {
+            return false;
+        }
+        // The arc from `gap_end[l]` to the start of the gap.
+        i16 start = gap_end[l], end = rem(gap_end[l] - gap[l] - 1, m) + 1;
+        i16 zeros_in_arc = (start <= end)
+                               ? zeros[end] - zeros[start - 1]
+                               : zeros[m] - zeros[start - 1] + zeros[end];
+        if (zeros_in_arc != 0) {
+            return false;
+        }
+    }
+
+    Underlying f = *this;
+    f.of_partition(x.data());
+    return compare(f);
+}
+
+} // namespace garcide::dual_complex
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(, dual_complex::Underlying)
+
+} // namespace garcide
@@ -11,6 +11,8 @@
  */
 
 #include "garcide/groups/euclidean_lattice.hpp"
+#include <algorithm>
+#include <numeric>
 
 namespace garcide::euclidean_lattice {
 
@@ -36,21 +38,21 @@ Underlying::Parameter Underlying::parameter_of_string(const std::string &str) {
     }
 }
 
-Underlying::Parameter Underlying::get_parameter() const {
-    return coordinates.size();
-}
+Underlying::Parameter Underlying::get_parameter() const { return dimension; }
 
-Underlying::Underlying(Underlying::Parameter n) : coordinates(n, false) {}
+Underlying::Underlying(Underlying::Parameter n)
+    : dimension(n), coordinates((n + WORD_SIZE - 1) / WORD_SIZE, 0) {}
 
 void Underlying::of_string(const std::string &str, size_t &pos) {
     Parameter n = get_parameter();
 
     std::smatch match;
+    static const std::regex atom_regex{"(?:e[\\s\\t]*_?[\\s\\t]*)?(" +
+                                       number_regex + ")"};
+    static const std::regex delta_regex{"D"};
 
-    if (std::regex_search(
-            str.begin() + pos, str.end(), match,
-            std::regex{"(?:e[\\s\\t]*_?[\\s\\t]*)?(" + number_regex + ")"},
-            std::regex_constants::match_continuous)) {
+    if (std::regex_search(str.begin() + pos, str.end(), match, atom_regex,
+                          std::regex_constants::match_continuous)) {
         // Try to extract a substring starting at pos that matches the regex.
         i16 i;
         try {
@@ -62,14 +64,14 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
         pos += match[0].length();
         if ((i >= 0) && (i < int(n))) {
             identity();
-            coordinates[i] = true;
+            set_at(i, true);
         } else {
             throw InvalidStringError(
                 "Invalid index for canonical base vector!\n" + match.str(1) +
                 " is not in [0, " + std::to_string(n) + "[.");
         }
     } else if (std::regex_search(str.begin() + pos, str.end(), match,
-                                 std::regex{"D"},
+                                 delta_regex,
                                  std::regex_constants::match_continuous)) {
         // Else try to match "D".
         pos += match[0].length();
@@ -91,9 +93,9 @@ void Underlying::debug(IndentedOStream &os) const {
     os << EndLine();
     os << "[";
     for (size_t i = 0; i < get_parameter() - 1; i++) {
-        os << (coordinates[i] ? "true" : "false") << ", ";
+        os << (at(i) ? "true" : "false") << ", ";
     }
-    os << coordinates[get_parameter() - 1];
+    os << (at(get_parameter() - 1) ? "true" : "false");
     os << "]";
     os.Indent(-8);
     os << EndLine();
@@ -101,66 +103,182 @@ void Underlying::debug(IndentedOStream &os) const {
 }
 
 void Underlying::print(IndentedOStream &os) const {
-    Parameter n = get_parameter();
-
-    Underlying c = *this;
-
     bool is_first = true;
 
-    for (size_t i = 0; i < n; i++) {
-        if (at(i)) {
-            os << (is_first ? "" : " ") << "e" << i;
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        // Only visit non-zero coordinates.
+        for (u64 word = coordinates[w]; word != 0; word &= word - 1) {
+            os << (is_first ? "" : " ") << "e"
+               << w * WORD_SIZE + size_t(__builtin_ctzll(word));
             is_first = false;
         }
     }
 }
 
-void Underlying::identity() {
-    for (size_t i = 0; i < get_parameter(); i++) {
-        coordinates[i] = false;
+size_t Underlying::length() const {
+    size_t length = 0;
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        length += size_t(__builtin_popcountll(coordinates[w]));
     }
+    return length;
+}
+
+void Underlying::identity() {
+    std::fill(coordinates.begin(), coordinates.end(), 0);
 }
 
 void Underlying::delta() {
-    for (size_t i = 0; i < get_parameter(); i++) {
-        coordinates[i] = true;
-    }
+    std::fill(coordinates.begin(), coordinates.end(), ~u64(0));
+    mask_last_word();
 }
 
 Underlying Underlying::product(const Underlying &b) const {
     Underlying product(get_parameter());
-    for (size_t i = 0; i < get_parameter(); i++) {
-        product.coordinates[i] = at(i) ^ b.at(i);
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        product.coordinates[w] = coordinates[w] ^ b.coordinates[w];
     }
     return product;
 }
 
 Underlying Underlying::left_meet(const Underlying &b) const {
     Underlying meet(get_parameter());
-    for (size_t i = 0; i < get_parameter(); i++) {
-        meet.coordinates[i] = at(i) && b.at(i);
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        meet.coordinates[w] = coordinates[w] & b.coordinates[w];
     }
     return meet;
 }
 
+bool Underlying::is_identity() const {
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        if (coordinates[w] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Underlying::is_delta() const {
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        // Bits past the dimension are `0`.
+        u64 full = ((w + 1 == coordinates.size()) &&
+                    (dimension % WORD_SIZE != 0))
+                       ? (u64(1) << (dimension % WORD_SIZE)) - 1
+                       : ~u64(0);
+        if (coordinates[w] != full) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Underlying Underlying::left_complement() const {
+    Underlying complement(get_parameter());
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        complement.coordinates[w] = ~coordinates[w];
+    }
+    complement.mask_last_word();
+    return complement;
+}
+
+bool Underlying::left_meet_is_identity(const Underlying &b) const {
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        if ((coordinates[w] & b.coordinates[w]) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Underlying::randomize() {
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        coordinates[w] = random_engine()();
+    }
+    mask_last_word();
+}
+
 std::vector<Underlying> Underlying::atoms() const {
     std::vector<Underlying> atoms;
     Underlying atom(get_parameter());
     for (size_t i = 0; i < get_parameter(); i++) {
-        atom.coordinates[i] = true;
+        atom.coordinates[i / WORD_SIZE] = u64(1) << (i % WORD_SIZE);
         atoms.push_back(atom);
-        atom.coordinates[i] = false;
+        atom.coordinates[i / WORD_SIZE] = 0;
     }
     return atoms;
 }
 
 size_t Underlying::hash() const {
     size_t hash = 0;
-    for (size_t i = 0; i < get_parameter(); i++) {
-        hash <<= 1;
-        hash += (at(i) ? 1 : 0);
+    for (size_t w = 0; w < coordinates.size(); w++) {
+        hash = hash * 31 + size_t(coordinates[w]);
     }
     return hash;
 }
 
-} // namespace garcide::euclidean_lattice
\ No newline at end of file
+void Underlying::pack(u8 *out) const {
+    for (size_t j = 0; j < packed_size(); j++) {
+        out[j] = u8(coordinates[j / 8] >> (8 * (j % 8)));
+    }
+}
+
+bool Underlying::unpack(const u8 *in) {
+    identity();
+    for (size_t j = 0; j < packed_size(); j++) {
+        coordinates[j / 8] |= u64(in[j]) << (8 * (j % 8));
+    }
+    Underlying masked = *this;
+    masked.mask_last_word();
+    return compare(masked);
+}
+
+std::vector<i32> exponents(const Braid &b) {
+    std::vector<i32> exponents(b.get_parameter(), b.inf());
+    for (Braid::ConstFactorItr it = b.cbegin(); it != b.cend(); it++) {
+        const Underlying &u = (*it).get_underlying();
+        for (size_t i = 0; i < b.get_parameter(); i++) {
+            exponents[i] += u.at(i) ? 1 : 0;
+        }
+    }
+    return exponents;
+}
+
+Braid braid_of_exponents(const std::vector<i32> &exponents) {
+    Underlying::Parameter n = exponents.size();
+    Braid b(n);
+
+    // Coordinates, sorted by increasing exponent.
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&exponents](size_t i, size_t j) {
+        return exponents[i] < exponents[j];
+    });
+
+    i32 inf = exponents[order.front()], sup = exponents[order.back()];
+
+    Underlying u(n);
+    u.delta();
+
+    // The k-th factor is obtained from the (k - 1)-th one by removing the
+    // coordinates whose exponent is inf + k - 1. Its support is included in
+    // the previous one, so that they are left-weighted, and it is neither
+    // Delta (the smallest exponent is removed first) nor the identity (the
+    // largest one is never removed).
+    std::vector<size_t>::iterator it = order.begin();
+    for (i32 k = inf + 1; k <= sup; k++) {
+        for (; exponents[*it] < k; it++) {
+            u.set_at(*it, false);
+        }
+        b.push_back_left_weighted(Factor(u));
+    }
+
+    b.set_delta(inf);
+    return b;
+}
+
+} // namespace garcide::euclidean_lattice
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(, euclidean_lattice::Underlying)
+
+} // namespace garcide
@@ -29,6 +29,8 @@
  */
 
 #include "garcide/groups/octahedral.hpp"
+#include <algorithm>
+#include <limits>
 
 namespace garcide::octahedral {
 
@@ -45,15 +47,15 @@ Underlying::Parameter Underlying::parameter_of_string(const std::string &str) {
             throw InvalidStringError("Parameter is too big!\n" + match.str(1) +
                                      " can not be converted to a C++ integer.");
         }
-        if (((1 <= i) && (i <= MAX_PARAMETER))) {
-            return i;
-        } else if (1 > i) {
+        if (1 > i) {
             throw InvalidStringError("Parameter should be at least 1!");
-        } else {
-            throw InvalidStringError("Parameter strands is too big!\n" +
+        } else if (i64(2) * i64(i) >= i64(std::numeric_limits<i16>::max())) {
+            // Points range up to 2 * i, and are stored as i16.
+            throw InvalidStringError("Parameter is too big!\n2 * " +
                                      match.str(1) +
-                                     " is strictly greater than " +
-                                     std::to_string(MAX_PARAMETER) + ".");
+                                     " can not be converted to a C++ integer.");
+        } else {
+            return i;
         }
     } else {
         throw InvalidStringError(
@@ -61,7 +63,7 @@ Underlying::Parameter Underlying::parameter_of_string(const std::string &str) {
     }
 }
 
-Underlying::Underlying(i16 n) : permutation_table(2 * n + 1) {}
+Underlying::Underlying(i16 n) : permutation_table(n + 1) {}
 
 void Underlying::print(IndentedOStream &os) const {
     // Recall that a band braid is represented by decreasing cycles.
@@ -81,7 +83,7 @@ void Underlying::print(IndentedOStream &os) const {
             while (!seen[rem(j - 1, n) + 1]) {
                 curr_cycle.push_back(j);
                 seen[rem(j - 1, n) + 1] = true;
-                j = permutation_table[j];
+                j = at(j);
             }
             if (!is_first && int(curr_cycle.size()) > 1) {
                 os << " ";
@@ -112,10 +114,10 @@ void Underlying::debug(IndentedOStream &os) const {
     os.Indent(4);
     os << EndLine();
     os << "[";
-    for (i16 i = 1; i < 2 * get_parameter(); i++) {
+    for (i16 i = 1; i < get_parameter(); i++) {
         os << permutation_table[i] << ", ";
     }
-    os << permutation_table[2 * get_parameter()];
+    os << permutation_table[get_parameter()];
     os << "]";
     os.Indent(-8);
     os << EndLine();
@@ -125,16 +127,19 @@ void Underlying::debug(IndentedOStream &os) const {
 void Underlying::of_string(const std::string &str, size_t &pos) {
     i16 n = get_parameter();
     std::smatch match;
-    if (std::regex_search(str.begin() + pos, str.end(), match, std::regex{"D"},
+    static const std::regex delta_regex{"D"};
+    static const std::regex short_atom_regex{
+        "(?:s[\\s\\t]*_?[\\s\\t]*)?\\([\\s\\t]*(" + number_regex +
+        ")[\\s\\t]*,?[\\s\\t]*(" + number_regex + ")[\\s\\t]*\\)"};
+    static const std::regex long_atom_regex{"(?:l[\\s\\t]*_?[\\s\\t]*)?(" +
+                                            number_regex + ")"};
+    if (std::regex_search(str.begin() + pos, str.end(), match, delta_regex,
                           std::regex_constants::match_continuous)) {
         pos += match[0].length();
         delta();
-    } else if (std::regex_search(
-                   str.begin() + pos, str.end(), match,
-                   std::regex{"(?:s[\\s\\t]*_?[\\s\\t]*)?\\([\\s\\t]*(" +
-                              number_regex + ")[\\s\\t]*,?[\\s\\t]*(" +
-                              number_regex + ")[\\s\\t]*\\)"},
-                   std::regex_constants::match_continuous)) {
+    } else if (std::regex_search(str.begin() + pos, str.end(), match,
+                                 short_atom_regex,
+                                 std::regex_constants::match_continuous)) {
         i16 i, j;
         try {
             i = std::stoi(match[1]);
@@ -153,12 +158,8 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
         pos += match[0].length();
         if ((i != j) && (i != rem(j + n - 1, 2 * n) + 1)) {
             identity();
-            permutation_table[i] = j;
-            permutation_table[j] = i;
-            permutation_table[rem(i + n - 1, 2 * n) + 1] =
-                rem(j + n - 1, 2 * n) + 1;
-            permutation_table[rem(j + n - 1, 2 * n) + 1] =
-                rem(i + n - 1, 2 * n) + 1;
+            set_at(i, j);
+            set_at(j, i);
         } else {
             throw InvalidStringError(
                 "Indexes for short generators should not be equal mod " +
@@ -166,8 +167,7 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
                 match.str(2) + ") is not a valid factor.");
         }
     } else if (std::regex_search(str.begin() + pos, str.end(), match,
-                                 std::regex{"(?:l[\\s\\t]*_?[\\s\\t]*)?(" +
-                                            number_regex + ")"},
+                                 long_atom_regex,
                                  std::regex_constants::match_continuous)) {
         i16 i;
         try {
@@ -179,8 +179,7 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
         i = rem(i - 1, 2 * n) + 1;
         pos += match[0].length();
         identity();
-        permutation_table[i] = rem(i + n - 1, 2 * n) + 1;
-        permutation_table[rem(i + n - 1, 2 * n) + 1] = i;
+        set_at(i, opposite(i));
     } else {
         throw InvalidStringError(
             "Could not extract a factor from \"" + str.substr(pos) +
@@ -192,70 +191,113 @@ void Underlying::of_string(const std::string &str, size_t &pos) {
 }
 
 void Underlying::assign_partition(i16 *x) const {
-    for (i16 i = 1; i <= 2 * get_parameter(); ++i)
+    i16 n = get_parameter();
+    for (i16 i = 1; i <= 2 * n; ++i)
         x[i] = 0;
-    for (i16 i = 1; i <= 2 * get_parameter(); ++i) {
+    for (i16 i = 1; i <= n; ++i) {
         if (x[i] == 0)
             x[i] = i;
         if (permutation_table[i] > i)
             x[permutation_table[i]] = x[i];
     }
+    for (i16 i = n + 1; i <= 2 * n; ++i) {
+        i16 j = opposite(permutation_table[i - n]);
+        if (x[i] == 0)
+            x[i] = i;
+        if (j > i)
+            x[j] = x[i];
+    }
 }
 
 void Underlying::of_partition(const i16 *x) {
-    thread_local i16 z[2 * MAX_PARAMETER + 1];
+    thread_local std::vector<i16> z;
+    i16 n = get_parameter();
 
-    for (i16 i = 1; i <= 2 * get_parameter(); ++i)
+    if (z.size() < size_t(2 * n + 1)) {
+        z.resize(2 * n + 1);
+    }
+
+    for (i16 i = 1; i <= 2 * n; ++i)
         z[i] = 0;
-    for (i16 i = 2 * get_parameter(); i >= 1; --i) {
+    // Only the first half of the table needs to be written, but the cells
+    // are read in full.
+    for (i16 i = 2 * n; i > n; --i) {
+        z[x[i]] = i;
+    }
+    for (i16 i = n; i >= 1; --i) {
         permutation_table[i] = (z[x[i]] == 0) ? x[i] : z[x[i]];
         z[x[i]] = i;
     }
 }
 
 Underlying Underlying::left_meet(const Underlying &b) const {
-    thread_local i16 x[2 * MAX_PARAMETER + 1], y[2 * MAX_PARAMETER + 1],
-        z[2 * MAX_PARAMETER + 1];
-
-    assign_partition(x);
-    b.assign_partition(y);
-
-    thread_local i16 P[2 * MAX_PARAMETER + 1][2 * MAX_PARAMETER + 1];
+    thread_local std::vector<i16> full, y, z, first, stamp;
+    i16 n = get_parameter();
 
-    for (i16 i = 2 * get_parameter(); i >= 1; i--) {
-        P[x[i]][y[i]] = i;
+    if (y.size() < size_t(2 * n + 1)) {
+        full.resize(2 * n + 1);
+        y.resize(2 * n + 1);
+        z.resize(2 * n + 1);
+        first.resize(2 * n + 1);
+        stamp.resize(2 * n + 1);
     }
 
-    for (i16 i = 1; i <= 2 * get_parameter(); i++) {
-        z[i] = P[x[i]][y[i]];
+    for (i16 i = 1; i <= n; ++i) {
+        full[i] = permutation_table[i];
+        full[i + n] = opposite(permutation_table[i]);
+        z[i] = 0;
+        z[i + n] = 0;
+        stamp[i] = 0;
+        stamp[i + n] = 0;
+    }
+    b.assign_partition(y.data());
+
+    // Cells of `*this` are its cycles. Walking each of them, it is split
+    // along the cells of `b`, the new cells being labelled by their minimum.
+    // `stamp` tells which entries of `first` were set while walking the
+    // current cycle, and `z` marks the points that were already seen.
+    for (i16 i = 1; i <= 2 * n; ++i) {
+        if (z[i] != 0) {
+            continue;
+        }
+        i16 j = i;
+        do {
+            if ((stamp[y[j]] != i) || (j < first[y[j]])) {
+                stamp[y[j]] = i;
+                first[y[j]] = j;
+            }
+            j = full[j];
+        } while (j != i);
+        do {
+            z[j] = first[y[j]];
+            j = full[j];
+        } while (j != i);
     }
 
     Underlying c = Underlying(*this);
 
-    c.of_partition(z);
+    c.of_partition(z.data());
 
     return c;
 }
 
 void Underlying::identity() {
-    for (i16 i = 1; i <= 2 * get_parameter(); i++) {
+    for (i16 i = 1; i <= get_parameter(); i++) {
         permutation_table[i] = i;
     }
 }
 
 void Underlying::delta() {
-    i16 i, n = get_parameter();
-    for (i = 1; i < 2 * n; i++) {
+    for (i16 i = 1; i <= get_parameter(); i++) {
         permutation_table[i] = i + 1;
     }
-    permutation_table[2 * n] = 1;
 }
 
 Underlying Underlying::inverse() const {
     Underlying f = Underlying(get_parameter());
     i16 i;
-    for (i = 1; i <= 2 * get_parameter(); i++) {
-        f.permutation_table[permutation_table[i]] = i;
+    for (i = 1; i <= get_parameter(); i++) {
+        f.set_at(permutation_table[i], i);
     }
     return f;
 }
@@ -263,8 +305,8 @@ Underlying Underlying::inverse() const {
 Underlying Underlying::product(const Underlying &b) const {
     Underlying f = Underlying(get_parameter());
     i16 i;
-    for (i = 1; i <= 2 * get_parameter(); i++) {
-        f.permutation_table[i] = b.permutation_table[permutation_table[i]];
+    for (i = 1; i <= get_parameter(); i++) {
+        f.permutation_table[i] = b.at(permutation_table[i]);
     }
     return f;
 }
@@ -277,14 +319,103 @@ Underlying Underlying::right_complement(const Underlying &b) const {
     return inverse().product(b);
 }
 
+bool Underlying::is_identity() const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        if (permutation_table[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Underlying::is_delta() const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        if (permutation_table[i] != i + 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Underlying Underlying::left_complement() const {
+    i16 n = get_parameter();
+    Underlying f = Underlying(n);
+    for (i16 i = 1; i <= n; i++) {
+        i16 j = permutation_table[i];
+        f.set_at(j == 1 ? 2 * n : j - 1, i);
+    }
+    return f;
+}
+
+Underlying Underlying::right_complement() const {
+    Underlying f = Underlying(get_parameter());
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        f.set_at(permutation_table[i], i + 1);
+    }
+    return f;
+}
+
+bool Underlying::is_left_divisible_by_atom(size_t k) const {
+    // Atoms are listed by point i, with 2(n - i) + 1 of them each: those
+    // sending i to j in [i + 1, n], then in [n + i + 1, 2n], then to n + i.
+    i16 n = get_parameter(), i = 1;
+    while (k >= size_t(2 * (n - i) + 1)) {
+        k -= size_t(2 * (n - i) + 1);
+        i++;
+    }
+    i16 j;
+    if (i16(k) < n - i) {
+        j = i + 1 + i16(k);
+    } else if (i16(k) < 2 * (n - i)) {
+        j = 2 * i + 1 + i16(k);
+    } else {
+        j = n + i;
+    }
+    for (i16 l = at(i); l != i; l = at(l)) {
+        if (l == j) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Underlying::left_meet_is_identity(const Underlying &b) const {
+    thread_local std::vector<i16> y, seen, stamp;
+    i16 n = get_parameter();
+
+    if (y.size() < size_t(2 * n + 1)) {
+        y.resize(2 * n + 1);
+        seen.resize(2 * n + 1);
+        stamp.resize(2 * n + 1);
+    }
+
+    b.assign_partition(y.data());
+
+    // Cells of `*this` are its cycles. Each of them is walked, stamping the
+    // cells of `b` it meets with its first point.
+    for (i16 i = 1; i <= 2 * n; i++) {
+        seen[i] = false;
+        stamp[i] = 0;
+    }
+    for (i16 i = 1; i <= 2 * n; i++) {
+        for (i16 j = i; !seen[j]; j = at(j)) {
+            if (stamp[y[j]] == i) {
+                return false;
+            }
+            seen[j] = true;
+            stamp[y[j]] = i;
+        }
+    }
+    return true;
+}
+
 void Underlying::delta_conjugate_mut(i16 k) {
     Underlying under = *this;
     i16 i, n = get_parameter();
 
-    for (i = 1; i <= 2 * n; i++) {
+    for (i = 1; i <= n; i++) {
         under.permutation_table[i] =
-            rem(permutation_table[rem(i - k - 1, 2 * n) + 1] + k - 1, 2 * n) +
-            1;
+            rem(at(rem(i - k - 1, 2 * n) + 1) + k - 1, 2 * n) + 1;
     }
     *this = under;
 }
@@ -296,25 +427,20 @@ std::vector<Underlying> Underlying::atoms() const {
         for (i16 j = i + 1; j <= n; j++) {
             Underlying atom = Underlying(n);
             atom.identity();
-            atom.permutation_table[i] = j;
-            atom.permutation_table[j] = i;
-            atom.permutation_table[i + n] = j + n;
-            atom.permutation_table[j + n] = i + n;
+            atom.set_at(i, j);
+            atom.set_at(j, i);
             atoms.push_back(atom);
         }
         for (i16 j = n + i + 1; j <= 2 * n; j++) {
             Underlying atom = Underlying(n);
             atom.identity();
-            atom.permutation_table[i] = j;
-            atom.permutation_table[j] = i;
-            atom.permutation_table[i + n] = j - n;
-            atom.permutation_table[j - n] = i + n;
+            atom.set_at(i, j);
+            atom.set_at(j, i);
             atoms.push_back(atom);
         }
         Underlying atom = Underlying(n);
         atom.identity();
-        atom.permutation_table[i] = n + i;
-        atom.permutation_table[n + i] = i;
+        atom.set_at(i, n + i);
         atoms.push_back(atom);
     }
     return atoms;
@@ -322,10 +448,48 @@ std::vector<Underlying> Underlying::atoms() const {
 
 std::size_t Underlying::hash() const {
     std::size_t h = 0;
-    for (i16 i = 1; i <= 2 * get_parameter(); i++) {
+    for (i16 i = 1; i <= get_parameter(); i++) {
         h = h * 31 + permutation_table[i];
     }
     return h;
 }
 
-} // namespace garcide::octahedral
\ No newline at end of file
+void Underlying::pack(u8 *out) const {
+    for (i16 i = 1; i <= get_parameter(); i++) {
+        pack_u16(out + 2 * (i - 1), u16(permutation_table[i]));
+    }
+}
+
+bool Underlying::unpack(const u8 *in) {
+    i16 n = get_parameter();
+    for (i16 i = 1; i <= n; i++) {
+        permutation_table[i] = i16(unpack_u16(in + 2 * (i - 1)));
+        if (permutation_table[i] < 1 || permutation_table[i] > 2 * n) {
+            return false;
+        }
+    }
+    std::vector<i16> full(2 * n + 1), x(2 * n + 1);
+    for (i16 i = 1; i <= 2 * n; i++) {
+        full[i] = at(i);
+    }
+    if (!is_permutation_table(full.data(), 1, 2 * n)) {
+        return false;
+    }
+    // Factors are exactly the permutations that `of_partition()` builds from
+    // symmetric non-crossing partitions.
+    assign_partition(x.data());
+    if (!is_noncrossing(x.data(), 2 * n)) {
+        return false;
+    }
+    Underlying f = *this;
+    f.of_partition(x.data());
+    return compare(f);
+}
+
+} // namespace garcide::octahedral
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(, octahedral::Underlying)
+
+} // namespace garcide
@@ -30,6 +30,11 @@
 
 #include "garcide/groups/standard_complex.hpp"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_PRODUCT
+#include <immintrin.h>
+#endif
+
 namespace garcide::standard_complex {
 
 void EENParameter::print(IndentedOStream &os) const {
@@ -113,10 +118,12 @@ Underlying::Underlying(Parameter p)
     : een_index(p), permutation_table(p.n), coefficient_table(p.n) {}
 
 void Underlying::print(IndentedOStream &os) const {
-    thread_local i16 dir_perm[MAX_N_PARAMETER];
+    thread_local std::vector<i16> dir_perm_table;
+    i16 n = get_parameter().n, e = get_parameter().e;
+    dir_perm_table.resize(n);
+    i16 *dir_perm = dir_perm_table.data();
     Underlying copy = *this;
     copy.direct(dir_perm);
-    i16 n = get_parameter().n, e = get_parameter().e;
     bool is_first = true;
     for (i16 i = 2; i <= n; i++) {
         for (i16 j = i; j > 2; j--) {
@@ -177,13 +184,15 @@ void Underlying::print(IndentedOStream &os) const {
 void Underlying::of_string(const std::string &str, size_t &pos) {
     i16 n = get_parameter().n, e = get_parameter().e;
     std::smatch match;
-    if (std::regex_search(str.begin() + pos, str.end(), match, std::regex{"D"},
+    static const std::regex delta_regex{"D"};
+    static const std::regex atom_regex{"([st])[\\s\\t]*_?[\\s\\t]*(" +
+                                       number_regex + ")"};
+    if (std::regex_search(str.begin() + pos, str.end(), match, delta_regex,
                           std::regex_constants::match_continuous)) {
         pos += match[0].length();
         delta();
     } else if (std::regex_search(str.begin() + pos, str.end(), match,
-                                 std::regex{"([st])[\\s\\t]*_?[\\s\\t]*(" +
-                                            number_regex + ")"},
+                                 atom_regex,
                                  std::regex_constants::match_continuous)) {
         i16 i = std::stoi(match[2]);
         pos += match[0].length();
@@ -224,64 +233,73 @@ void Underlying::direct(i16 *dir_perm) const {
 }
 
 Underlying Underlying::left_meet(const Underlying &b) const {
-    thread_local i16 dir_perm_a[MAX_N_PARAMETER], dir_perm_b[MAX_N_PARAMETER],
-        dir_perm_meet[MAX_N_PARAMETER];
-    Underlying a_copy = *this;
-    Underlying b_copy = b;
-    Underlying meet(get_parameter());
-    meet.identity();
-    a_copy.direct(dir_perm_a);
-    b_copy.direct(dir_perm_b);
-    meet.direct(dir_perm_meet);
+    // Remainders of `*this` and `b` after left division by the part of the
+    // meet extracted so far.
+    Underlying a_rem = *this;
+    Underlying b_rem = b;
     i16 n = get_parameter().n, e = get_parameter().e;
     for (i16 i = 2; i <= n; i++) {
-        for (i16 j = i; j > 2; j--) {
-            if (a_copy.is_s_left_divisor(j) && b_copy.is_s_left_divisor(j)) {
-                meet.s_right_multiply(dir_perm_meet, j);
-                a_copy.s_left_multiply(dir_perm_a, j);
-                b_copy.s_left_multiply(dir_perm_b, j);
-            } else {
-                goto end_subword;
-            }
+        // Longest s_i s_(i-1) ... s_(k+2) dividing both remainders: row i - 1
+        // moves down past the rows with a smaller key.
+        i16 k = i - 2;
+        i16 a_key = a_rem.s_key(i - 1), b_key = b_rem.s_key(i - 1);
+        while ((k >= 1) && (a_rem.s_key(k) < a_key) &&
+               (b_rem.s_key(k) < b_key)) {
+            k--;
+        }
+        a_rem.move_row(i - 1, k + 1);
+        b_rem.move_row(i - 1, k + 1);
+        if (k >= 1) {
+            continue;
         }
 
-        if (a_copy.is_t_left_divisor(0) && b_copy.is_t_left_divisor(0)) {
-
-            meet.t_right_multiply(dir_perm_meet, 0);
-            a_copy.t_left_multiply(dir_perm_a, 0);
-            b_copy.t_left_multiply(dir_perm_b, 0);
-
-            if (a_copy.is_t_left_divisor(e - 1) &&
-                b_copy.is_t_left_divisor(e - 1)) {
-                meet.t_right_multiply(dir_perm_meet, e - 1);
-                a_copy.t_left_multiply(dir_perm_a, e - 1);
-                b_copy.t_left_multiply(dir_perm_b, e - 1);
-
-                for (i16 j = 3; j < i + 1; j++) {
-                    if (a_copy.is_s_left_divisor(j) &&
-                        b_copy.is_s_left_divisor(j)) {
-                        meet.s_right_multiply(dir_perm_meet, j);
-                        a_copy.s_left_multiply(dir_perm_a, j);
-                        b_copy.s_left_multiply(dir_perm_b, j);
-                    } else {
-                        goto end_subword;
-                    }
+        if (a_rem.is_t_left_divisor(0) && b_rem.is_t_left_divisor(0)) {
+            a_rem.t_left_multiply(0);
+            b_rem.t_left_multiply(0);
+
+            if (a_rem.is_t_left_divisor(e - 1) &&
+                b_rem.is_t_left_divisor(e - 1)) {
+                a_rem.t_left_multiply(e - 1);
+                b_rem.t_left_multiply(e - 1);
+
+                // Longest s_3 s_4 ... s_(k+1) dividing both remainders: row 1
+                // moves up past the rows with a greater key.
+                k = 1;
+                a_key = a_rem.s_key(1);
+                b_key = b_rem.s_key(1);
+                while ((k + 1 <= i - 1) && (a_rem.s_key(k + 1) > a_key) &&
+                       (b_rem.s_key(k + 1) > b_key)) {
+                    k++;
                 }
+                a_rem.move_row(1, k);
+                b_rem.move_row(1, k);
             }
-            goto end_subword;
+            continue;
         }
 
-        for (i16 k = 1; k < e; k++) {
-            if (a_copy.is_t_left_divisor(k) && b_copy.is_t_left_divisor(k)) {
-                meet.t_right_multiply(dir_perm_meet, k);
-                a_copy.t_left_multiply(dir_perm_a, k);
-                b_copy.t_left_multiply(dir_perm_b, k);
-                goto end_subword;
-            }
+        // Smallest t_k with k in [1, e - 1] dividing both remainders. If the
+        // permutation keeps the order of the first two rows, either all of
+        // them divide, or none does. Otherwise, at most one does.
+        i16 t_a = (a_rem.permutation_table[1] > a_rem.permutation_table[0])
+                      ? ((a_rem.coefficient_table[1] != 0) ? 0 : -1)
+                  : (a_rem.coefficient_table[0] != 0)
+                      ? e - a_rem.coefficient_table[0]
+                      : -1;
+        i16 t_b = (b_rem.permutation_table[1] > b_rem.permutation_table[0])
+                      ? ((b_rem.coefficient_table[1] != 0) ? 0 : -1)
+                  : (b_rem.coefficient_table[0] != 0)
+                      ? e - b_rem.coefficient_table[0]
+                      : -1;
+        // Here 0 stands for "all of them", and -1 for "none".
+        if ((t_a >= 0) && (t_b >= 0) &&
+            ((t_a == t_b) || (t_a == 0) || (t_b == 0))) {
+            i16 t = (t_a == 0) ? ((t_b == 0) ? 1 : t_b) : t_a;
+            a_rem.t_left_multiply(t);
+            b_rem.t_left_multiply(t);
         }
-    end_subword:;
     }
-    return meet;
+    // The remainder of `*this` is the right complement of the meet to it.
+    return product(a_rem.inverse());
 }
 
 void Underlying::identity() {
@@ -312,10 +330,73 @@ Underlying Underlying::inverse() const {
     return f;
 }
 
+Underlying Underlying::transpose() const {
+    Underlying f = Underlying(get_parameter());
+    for (i16 i = 0; i < get_parameter().n; i++) {
+        f.permutation_table[permutation_table[i]] = i;
+        f.coefficient_table[permutation_table[i]] = coefficient_table[i];
+    }
+    return f;
+}
+
+namespace {
+
+#ifdef SIMD_PRODUCT
+
+// Product of the tables (`a_p`, `a_c`) and (`b_p`, `b_c`) into (`f_p`, `f_c`),
+// for entries [0, m[ with m a multiple of 8, eight entries at a time.
+//
+// Entries of `b` are gathered along the permutation of `a`, and the
+// coefficients are then added modulo e by a compare and subtract, as both
+// summands are in [0, e[.
+__attribute__((target("avx2"))) void
+product_avx2(const i16 *a_p, const i16 *a_c, const i16 *b_p, const i16 *b_c,
+             i16 *f_p, i16 *f_c, i16 m, i16 e) {
+    const __m256i E = _mm256_set1_epi32(e);
+    const __m256i E_minus_one = _mm256_set1_epi32(e - 1);
+    for (i16 i = 0; i < m; i += 8) {
+        const __m256i from = _mm256_loadu_si256((const __m256i *)(a_p + i));
+        __m256i c = _mm256_add_epi32(
+            _mm256_i32gather_epi32(b_c, from, 4),
+            _mm256_loadu_si256((const __m256i *)(a_c + i)));
+        c = _mm256_sub_epi32(
+            c, _mm256_and_si256(_mm256_cmpgt_epi32(c, E_minus_one), E));
+        _mm256_storeu_si256((__m256i *)(f_p + i),
+                            _mm256_i32gather_epi32(b_p, from, 4));
+        _mm256_storeu_si256((__m256i *)(f_c + i), c);
+    }
+}
+
+#endif
+
+// Computes the product of the first m entries of the tables of `a` and `b`
+// into the ones of `f` with a vectorized routine, if one is available on this
+// machine and enabled (see `set_simd_kernels`), and returns the number of
+// entries that were computed.
+i16 fast_product(const i16 *a_p, const i16 *a_c, const i16 *b_p,
+                 const i16 *b_c, i16 *f_p, i16 *f_c, i16 m, i16 e) {
+#ifdef SIMD_PRODUCT
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2 && simd_kernels()) {
+        m -= m % 8;
+        product_avx2(a_p, a_c, b_p, b_c, f_p, f_c, m, e);
+        return m;
+    }
+#endif
+    return 0;
+}
+
+} // namespace
+
 Underlying Underlying::product(const Underlying &b) const {
     Underlying f = Underlying(get_parameter());
     i16 i, n = get_parameter().n, e = get_parameter().e;
-    for (i = 0; i < n; i++) {
+    for (i = fast_product(permutation_table.data(), coefficient_table.data(),
+                          b.permutation_table.data(),
+                          b.coefficient_table.data(),
+                          f.permutation_table.data(),
+                          f.coefficient_table.data(), n, e);
+         i < n; i++) {
         f.permutation_table[i] = b.permutation_table[permutation_table[i]];
         f.coefficient_table[i] = rem(b.coefficient_table[permutation_table[i]] +
                                          coefficient_table[i],
@@ -332,6 +413,78 @@ Underlying Underlying::right_complement(const Underlying &b) const {
     return inverse().product(b);
 };
 
+bool Underlying::is_identity() const {
+    for (i16 i = 0; i < get_parameter().n; i++) {
+        if ((permutation_table[i] != i) || (coefficient_table[i] != 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Underlying::is_delta() const {
+    i16 n = get_parameter().n, e = get_parameter().e;
+    if ((permutation_table[0] != 0) ||
+        (coefficient_table[0] != rem(-n + 1, e))) {
+        return false;
+    }
+    for (i16 i = 1; i < n; i++) {
+        if ((permutation_table[i] != i) || (coefficient_table[i] != 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Delta is diagonal, so that its complements only differ from the inverse of
+// `*this` by their coefficients.
+
+Underlying Underlying::left_complement() const {
+    Underlying f = Underlying(get_parameter());
+    i16 n = get_parameter().n, e = get_parameter().e;
+    for (i16 i = 0; i < n; i++) {
+        i16 j = permutation_table[i];
+        f.permutation_table[j] = i;
+        f.coefficient_table[j] =
+            rem(((j == 0) ? 1 - n : 1) - coefficient_table[i], e);
+    }
+    return f;
+}
+
+Underlying Underlying::right_complement() const {
+    Underlying f = Underlying(get_parameter());
+    i16 n = get_parameter().n, e = get_parameter().e;
+    for (i16 i = 0; i < n; i++) {
+        i16 j = permutation_table[i];
+        f.permutation_table[j] = i;
+        f.coefficient_table[j] =
+            rem(((i == 0) ? 1 - n : 1) - coefficient_table[i], e);
+    }
+    return f;
+}
+
+bool Underlying::left_meet_is_identity(const Underlying &b) const {
+    for (i16 i = 3; i <= get_parameter().n; i++) {
+        if (is_s_left_divisor(i) && b.is_s_left_divisor(i)) {
+            return false;
+        }
+    }
+
+    // Either all t_k left divide a factor, or none does (if its first two
+    // rows are in order), or exactly one does. Returns the k in the last
+    // case, -1 if all do and -2 if none does.
+    i16 e = get_parameter().e;
+    auto t_divisor = [e](const Underlying &f) -> i16 {
+        if (f.permutation_table[1] > f.permutation_table[0]) {
+            return (f.coefficient_table[1] != 0) ? -1 : -2;
+        }
+        return (f.coefficient_table[0] == 0) ? 0 : e - f.coefficient_table[0];
+    };
+    i16 t_a = t_divisor(*this), t_b = t_divisor(b);
+    return (t_a == -2) || (t_b == -2) ||
+           ((t_a >= 0) && (t_b >= 0) && (t_a != t_b));
+}
+
 void Underlying::delta_conjugate_mut(i16 k) {
     // delta is diagonal, and acts almost homothetically.
     // Therefore conjugating by some power of it does nothing on most
@@ -367,6 +520,37 @@ std::size_t Underlying::hash() const {
         return h;
     }
 
+void Underlying::pack(u8 *out) const {
+    i16 n = get_parameter().n;
+    for (i16 i = 0; i < n; i++) {
+        pack_u16(out + 2 * i, u16(permutation_table[i]));
+        pack_u16(out + 2 * (n + i), u16(coefficient_table[i]));
+    }
+}
+
+bool Underlying::unpack(const u8 *in) {
+    i16 n = get_parameter().n, e = get_parameter().e;
+    i16 determinant = 0;
+    for (i16 i = 0; i < n; i++) {
+        permutation_table[i] = i16(unpack_u16(in + 2 * i));
+        coefficient_table[i] = i16(unpack_u16(in + 2 * (n + i)));
+        if (coefficient_table[i] >= e) {
+            return false;
+        }
+        determinant += coefficient_table[i];
+    }
+    if (!is_permutation_table(permutation_table.data(), 0, n - 1) ||
+        rem(determinant, e) != 0) {
+        return false;
+    }
+    // The meet extracts the longest common prefix of the element and of
+    // Delta, one atom at a time: it is the element itself if and only if it
+    // is simple.
+    Underlying delta = *this;
+    delta.delta();
+    return left_meet(delta).compare(*this);
+}
+
 std::vector<Underlying> Underlying::atoms() const {
     Parameter p = get_parameter();
     std::vector<Underlying> atoms;
@@ -391,4 +575,10 @@ std::vector<Underlying> Underlying::atoms() const {
     return atoms;
 }
 
-} // namespace garcide::standard_complex
\ No newline at end of file
+} // namespace garcide::standard_complex
+
+namespace garcide {
+
+GARCIDE_INSTANTIATE(, standard_complex::Underlying)
+
+} // namespace garcide
@@ -0,0 +1,121 @@
+/**
+ * @file stream.cpp
+ * @author GarCide contributors
+ * @brief Implementation file for streaming braids from large files.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/stream.hpp"
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define STREAM_USE_MMAP
+#endif
+
+namespace garcide::stream {
+
+#ifdef STREAM_USE_MMAP
+
+MappedFile::MappedFile(const std::string &path) : mapping(nullptr), size(0) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw FileError("Cannot open " + path + "!");
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        throw FileError("Cannot stat " + path + "!");
+    }
+    size = size_t(st.st_size);
+    if (size > 0) {
+        void *m = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED) {
+            close(fd);
+            throw FileError("Cannot map " + path + "!");
+        }
+        mapping = static_cast<char *>(m);
+        madvise(mapping, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (mapping != nullptr) {
+        munmap(mapping, size);
+    }
+}
+
+void MappedFile::release(size_t begin, size_t end) const {
+    size_t page = size_t(sysconf(_SC_PAGESIZE));
+    begin = (begin + page - 1) / page * page;
+    end = end / page * page;
+    if (mapping != nullptr && begin < end) {
+        madvise(mapping + begin, end - begin, MADV_DONTNEED);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string &path) : mapping(nullptr), size(0) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw FileError("Cannot open " + path + "!");
+    }
+    size = size_t(file.tellg());
+    mapping = new char[size];
+    file.seekg(0);
+    if (!file.read(mapping, size)) {
+        delete[] mapping;
+        throw FileError("Cannot read " + path + "!");
+    }
+}
+
+MappedFile::~MappedFile() { delete[] mapping; }
+
+void MappedFile::release(size_t, size_t) const {}
+
+#endif
+
+std::vector<std::string_view> split_lines(std::string_view &text,
+                                          size_t max_lines) {
+    std::vector<std::string_view> lines;
+    while (!text.empty() && lines.size() < max_lines) {
+        size_t end = text.find('\n');
+        std::string_view line = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size()
+                                                         : end + 1);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+} // namespace garcide::stream
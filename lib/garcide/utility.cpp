@@ -28,6 +28,8 @@
  */
 
 #include "garcide/utility.hpp"
+#include <memory>
+#include <vector>
 
 namespace garcide {
 
@@ -47,4 +49,122 @@ IndentedOStream &IndentedOStream::operator<< <EndLine>(const EndLine &el) {
     return *this;
 }
 
+thread_local IndentedOStream ind_cout(std::cout);
+
+std::mt19937_64 &random_engine() {
+    thread_local std::mt19937_64 engine(std::random_device{}());
+    return engine;
+}
+
+void seed_random_engine(u64 seed) { random_engine().seed(seed); }
+
+/**
+ * @brief Whether the vectorized kernels may be used.
+ */
+static std::atomic<bool> simd_kernels_enabled(true);
+
+void set_simd_kernels(bool enabled) { simd_kernels_enabled = enabled; }
+
+bool simd_kernels() { return simd_kernels_enabled; }
+
+/**
+ * @brief The resource of the innermost live scratch arena of the thread, or
+ * null.
+ */
+static thread_local std::pmr::memory_resource *scratch = nullptr;
+
+/**
+ * @brief Whether the buffer of the thread is used by a live scratch arena.
+ */
+static thread_local bool buffer_in_use = false;
+
+/**
+ * @brief The buffer of the thread, for its outermost scratch arena.
+ *
+ * @return A pointer to the buffer, of size `SCRATCH_BUFFER_SIZE`.
+ */
+static std::byte *scratch_buffer() {
+    thread_local std::unique_ptr<std::byte[]> buffer(
+        new std::byte[SCRATCH_BUFFER_SIZE]);
+    return buffer.get();
+}
+
+std::pmr::memory_resource *current_resource() {
+    return scratch != nullptr ? scratch : std::pmr::get_default_resource();
+}
+
+ScratchArena::ScratchArena()
+    : outer(scratch), owns_buffer(!buffer_in_use),
+      arena(owns_buffer ? scratch_buffer() : nullptr,
+            owns_buffer ? SCRATCH_BUFFER_SIZE : 0, current_resource()) {
+    buffer_in_use = true;
+    scratch = &arena;
+}
+
+ScratchArena::~ScratchArena() {
+    scratch = outer;
+    if (owns_buffer) {
+        buffer_in_use = false;
+    }
+}
+
+ScratchArenaPause::ScratchArenaPause() : outer(scratch) { scratch = nullptr; }
+
+ScratchArenaPause::~ScratchArenaPause() { scratch = outer; }
+
+TaskControl *&current_task() {
+    thread_local TaskControl *task = nullptr;
+    return task;
+}
+
+bool is_permutation_table(const i16 *table, i16 a, i16 b) {
+    std::vector<bool> seen(b - a + 1, false);
+    for (i16 i = a; i <= b; i++) {
+        if (table[i] < a || table[i] > b || seen[table[i] - a]) {
+            return false;
+        }
+        seen[table[i] - a] = true;
+    }
+    return true;
+}
+
+bool is_noncrossing(const i16 *x, i16 m) {
+    std::vector<i16> first(m + 1, 0), last(m + 1, 0);
+    for (i16 i = 1; i <= m; i++) {
+        if (x[i] < 0 || x[i] > m) {
+            return false;
+        }
+        if (first[x[i]] == 0) {
+            first[x[i]] = i;
+        }
+        last[x[i]] = i;
+    }
+    // The cells that have been entered, but not left yet, from the innermost
+    // one: going back to a cell is only allowed if it is the innermost one.
+    std::vector<i16> open;
+    for (i16 i = 1; i <= m; i++) {
+        if (first[x[i]] != i) {
+            if (open.empty() || open.back() != x[i]) {
+                return false;
+            }
+            if (last[x[i]] == i) {
+                open.pop_back();
+            }
+        } else if (last[x[i]] != i) {
+            open.push_back(x[i]);
+        }
+    }
+    return true;
+}
+
+void checkpoint() {
+    TaskControl *task = current_task();
+    if (task != nullptr) {
+        task->steps++;
+        if (task->cancelled) {
+            throw Cancelled();
+        }
+    }
+}
+
 } // namespace garcide
\ No newline at end of file
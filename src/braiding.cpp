@@ -28,8 +28,10 @@
  */
 
 #include "braiding/braiding.hpp"
+#include "garcide/auto_conjugacy.hpp"
 #include "garcide/centralizer.hpp"
 #include "garcide/sliding_circuits.hpp"
+#include "garcide/stream.hpp"
 
 namespace braiding {
 
@@ -173,6 +175,22 @@ void explain_braid_input() {
         << "\"1 ^ 1 0 e_2\",  \"0. e1 . 2\" or \"D\" are three ways to enter Δ."
         << EndLine(1);
 
+#elif BRAIDING_CLASS == 7
+
+    ind_cout
+        << "For finite type Artin groups, F = 's' '_'? Z | 'r' '_'? Z | 'D'."
+        << EndLine()
+        << "\"s_i\" (optional \"_\") stands for the i-th standard generator,"
+        << EndLine() << "numbered from 1 as in Bourbaki." << EndLine()
+        << "In the dual structure, \"r_k\" (optional \"_\") stands for the"
+        << EndLine()
+        << "k-th reflection, the first ones being the standard generators."
+        << EndLine()
+        << "'D' represents the Δ element for the Garside structure."
+        << EndLine(1) << "For example, in type A2," << EndLine()
+        << "\"s1 s2 s1\", \"s_2 s_1 s_2\" or \"D\" are three ways to enter Δ."
+        << EndLine(1);
+
 #else
 
     ind_cout << "Enter a braid (no more details for that group)." << EndLine(1);
@@ -400,6 +418,23 @@ void explain_garside_structure() {
         << "The Garside element is vector (1, ..., 1), and the atoms are the"
         << EndLine() << "base vectors, printed as ei." << EndLine(1);
 
+#elif BRAIDING_CLASS == 7
+
+    ind_cout
+        << "In the classic structure, canonical factors are the elements of"
+        << EndLine()
+        << "the Coxeter group W, lifted to positive braids, and Δ is the lift"
+        << EndLine() << "of the longest element." << EndLine(1)
+        << "In the dual structure (see Bessis, The dual braid monoid, 2003),"
+        << EndLine()
+        << "canonical factors are the lifts of the prefixes of the Coxeter"
+        << EndLine()
+        << "element c = s1 ... sn for the reflection length, and Δ is c."
+        << EndLine(1)
+        << "Both are computed once as tables of simple elements, so that"
+        << EndLine() << "groups with more than 2^22 simple elements are rejected."
+        << EndLine(1);
+
 #else
 
     ind_cout << "No more details." << EndLine(1);
@@ -430,6 +465,14 @@ void explain_braid_parameter_input() {
 
     ind_cout << "Enter the dimension (an integer)." << EndLine(1);
 
+#elif (BRAIDING_CLASS == 7)
+
+    ind_cout << "Enter an optional \"dual\" keyword, followed by a Coxeter type"
+             << EndLine()
+             << "(A<n>, B<n>, D<n>, E6, E7, E8, F4, G2, H3, H4 or I2(<m>)) or by a"
+             << EndLine() << "Coxeter matrix, like [1 3 2; 3 1 3; 2 3 1]."
+             << EndLine(1);
+
 #else
 
     ind_cout << "Enter the group parameter (no more details for that group)."
@@ -683,6 +726,11 @@ void print_options(IndentedOStream &os) {
 
     os << "Using the Garside structure for euclidean lattice Z^n.";
 
+#elif BRAIDING_CLASS == 7
+
+    os << "Using table-driven structures for finite type Artin groups."
+       << EndLine(1);
+
 #endif
 
     os << "l:      Left Normal Form        r:      Right Normal Form       "
@@ -860,7 +908,18 @@ void conjugacy_case() {
     Braid b(p), c(p), conj(p);
     prompt_braid(b);
     prompt_braid(c);
-    if (garcide::sliding_circuits::are_conjugate(b, c, conj)) {
+
+    garcide::auto_conjugacy::CostModel model;
+#if BRAIDING_CLASS == 0
+    model.trust_ultra_summit = true;
+#endif
+    garcide::auto_conjugacy::Decision<Factor> decision =
+        garcide::auto_conjugacy::decide(b, c, model);
+    ind_cout << EndLine();
+    decision.print();
+    ind_cout << EndLine();
+
+    if (garcide::auto_conjugacy::are_conjugate(decision, conj)) {
         ind_cout << EndLine() << "They are conjugates." << EndLine()
                  << "A conjugating element is:" << EndLine() << conj
                  << EndLine(1);
@@ -869,6 +928,33 @@ void conjugacy_case() {
     }
 }
 
+int batch_lcf(const std::string &parameter, const std::string &path) {
+    std::ostringstream str;
+    IndentedOStream os(str);
+
+    try {
+        Braid::Parameter p = Braid::parameter_of_string(parameter);
+        garcide::stream::for_each_braid<Braid>(path, p, [&](Braid &b) {
+            b.print(os);
+            str << "\n";
+            if (str.tellp() > (1 << 20)) {
+                std::cout << str.str();
+                str.str("");
+            }
+        });
+    } catch (garcide::InvalidStringError const &e) {
+        std::cout << str.str();
+        std::cerr << e.error_source << std::endl;
+        return 1;
+    } catch (garcide::stream::FileError const &e) {
+        std::cerr << e.error_source << std::endl;
+        return 1;
+    }
+
+    std::cout << str.str() << std::flush;
+    return 0;
+}
+
 #if BRAIDING_CLASS == 0
 
 void thurston_type_case() {
@@ -33,10 +33,19 @@ using namespace braiding;
 
 /**
  * @brief Main function.
- * 
- * @return `0`.
+ *
+ * With two arguments (a parameter and a file), puts every braid of the file in
+ * LCF. Otherwise, runs the interactive menu.
+ *
+ * @param argc Number of arguments.
+ * @param argv Arguments.
+ * @return `0`, or `1` if there was an error in batch mode.
  */
-int main() {
+int main(int argc, char *argv[]) {
+    if (argc == 3) {
+        return batch_lcf(argv[1], argv[2]);
+    }
+
     ind_cout << EndLine();
     print_header();
     print_options();
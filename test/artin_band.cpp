@@ -0,0 +1,192 @@
+/**
+ * @file artin_band.cpp
+ * @author GarCide contributors
+ * @brief Checks the conversions between the classic and dual structures of
+ * braid groups, and the solvers that pick one of them.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/differential.hpp"
+#include "garcide/groups/artin_band.hpp"
+#include <iostream>
+
+using namespace garcide;
+using artin_band::Structure;
+
+/**
+ * @brief Draws a random braid, as a word in the atoms and their inverses.
+ *
+ * @tparam F A class representing factors.
+ * @param n The number of strands.
+ * @param length The length of the word.
+ * @return The braid.
+ */
+template <class F> BraidTemplate<F> random_braid(i16 n, size_t length) {
+    u64 number_of_atoms = F(n).atoms().size();
+    std::vector<i16> word;
+    for (size_t i = 0; i < length; i++) {
+        i16 k = i16(1 + random_below(number_of_atoms));
+        word.push_back(random_below(2) == 0 ? k : -k);
+    }
+    return differential::braid_of_word<F>(n, word);
+}
+
+/**
+ * @brief Checks that converting random braids to the other structure and
+ * back gives them back, and that conversions are morphisms.
+ *
+ * @param n The number of strands.
+ * @return If they are.
+ */
+bool conversions_round_trip(i16 n) {
+    artin::Braid a1 = random_braid<artin::Factor>(n, 12),
+                 a2 = random_braid<artin::Factor>(n, 12);
+    band::Braid d1 = random_braid<band::Factor>(n, 12),
+                d2 = random_braid<band::Factor>(n, 12);
+
+    return artin_band::artin_of_band(artin_band::band_of_artin(a1)) == a1 &&
+           artin_band::band_of_artin(artin_band::artin_of_band(d1)) == d1 &&
+           artin_band::band_of_artin(a1 * a2) ==
+               artin_band::band_of_artin(a1) * artin_band::band_of_artin(a2) &&
+           artin_band::artin_of_band(d1 * d2) ==
+               artin_band::artin_of_band(d1) * artin_band::artin_of_band(d2) &&
+           artin_band::band_of_artin(!a1) == !artin_band::band_of_artin(a1);
+}
+
+/**
+ * @brief Checks that summit representatives and transports computed in the
+ * dual structure are mapped to conjugates and conjugators in the classic
+ * one.
+ *
+ * @param n The number of strands.
+ * @return If they are.
+ */
+bool summits_agree(i16 n) {
+    artin::Braid a = random_braid<artin::Factor>(n, 12);
+    band::Braid d = artin_band::band_of_artin(a);
+
+    band::Braid c_super(n), c_sliding(n);
+    band::Braid d_super = super_summit::send_to_super_summit(d, c_super);
+    band::Braid d_sliding =
+        sliding_circuits::send_to_sliding_circuits(d, c_sliding);
+
+    artin::Braid a_super = a, a_sliding = a;
+    a_super.conjugate(artin_band::artin_of_band(c_super));
+    a_sliding.conjugate(artin_band::artin_of_band(c_sliding));
+    if (a_super != artin_band::artin_of_band(d_super) ||
+        a_sliding != artin_band::artin_of_band(d_sliding)) {
+        return false;
+    }
+
+    // The transport of a minimal conjugator f at b takes the sliding of b to
+    // the sliding of b^f.
+    band::Braid d_rcf = d_sliding;
+    d_rcf.lcf_to_rcf();
+    for (const band::Factor &f :
+         sliding_circuits::min_sliding_circuits(d_sliding, d_rcf)) {
+        band::Factor t = sliding_circuits::transport(d_sliding, f);
+        band::Braid slid = d_sliding, slid_conjugate = d_sliding;
+        slid.sliding();
+        slid_conjugate.conjugate(f);
+        slid_conjugate.sliding();
+
+        artin::Braid a_slid = artin_band::artin_of_band(slid);
+        a_slid.conjugate(artin_band::artin_of_band(band::Braid(t)));
+        if (a_slid != artin_band::artin_of_band(slid_conjugate)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that conjugacy tests and centralizers agree in both
+ * structures, and with the structure `cheaper_structure` picks.
+ *
+ * @param n The number of strands.
+ * @return If they agree.
+ */
+bool solvers_agree(i16 n) {
+    artin::Braid b = random_braid<artin::Factor>(n, 10),
+                 x = random_braid<artin::Factor>(n, 6),
+                 y = random_braid<artin::Factor>(n, 10);
+    artin::Braid b2 = b;
+    b2.conjugate(x);
+
+    if (artin_band::cheaper_structure(b) !=
+        artin_band::cheaper_structure(b, b)) {
+        return false;
+    }
+
+    for (Structure structure : {Structure::Classic, Structure::Dual}) {
+        artin::Braid c(n), bc = b;
+        if (!artin_band::are_conjugate(b, b2, c, structure)) {
+            return false;
+        }
+        bc.conjugate(c);
+        if (bc != b2) {
+            return false;
+        }
+
+        try {
+            for (const artin::Braid &z :
+                 artin_band::centralizer(b, structure)) {
+                if (b * z != z * b) {
+                    return false;
+                }
+            }
+        } catch (ultra_summit::NotUltraSummit<band::Braid> const &) {
+        }
+    }
+
+    artin::Braid c(n);
+    bool classic = artin_band::are_conjugate(b, y, c, Structure::Classic),
+         dual = artin_band::are_conjugate(b, y, c, Structure::Dual),
+         cheaper = artin_band::are_conjugate(b, y, c);
+    if (classic != dual || classic != cheaper) {
+        return false;
+    }
+
+    for (const artin::Braid &z : artin_band::centralizer(b)) {
+        if (b * z != z * b) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    seed_random_engine(42);
+    size_t failures = 0;
+    for (i16 n = 3; n <= 6; n++) {
+        for (size_t _ = 0; _ < 20; _++) {
+            failures += !conversions_round_trip(n);
+            failures += !summits_agree(n);
+            failures += !solvers_agree(n);
+        }
+    }
+    std::cout << failures << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
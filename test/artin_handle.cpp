@@ -0,0 +1,192 @@
+/**
+ * @file artin_handle.cpp
+ * @author GarCide contributors
+ * @brief Checks handle reduction against left normal forms, and benchmarks
+ * both.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ * Run with argument `benchmark` to time triviality tests on long words, with
+ * handle reduction and with left normal forms, instead of running the checks.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/differential.hpp"
+#include "garcide/groups/artin_handle.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+using namespace garcide;
+using artin_handle::Word;
+
+/**
+ * @brief Draws a random word in the \f$\sigma_i\f$ and their inverses.
+ *
+ * @param n The number of strands.
+ * @param length The length of the word.
+ * @return The word.
+ */
+Word random_word(i16 n, size_t length) {
+    Word w;
+    for (size_t i = 0; i < length; i++) {
+        i16 k = i16(1 + random_below(n - 1));
+        w.push_back(random_below(2) == 0 ? k : -k);
+    }
+    return w;
+}
+
+/**
+ * @brief Concatenates two words.
+ *
+ * @param w1 A word.
+ * @param w2 Another word.
+ * @return `w1` followed by `w2`.
+ */
+Word concatenate(Word w1, const Word &w2) {
+    w1.insert(w1.end(), w2.begin(), w2.end());
+    return w1;
+}
+
+/**
+ * @brief Checks handle reduction, signs and triviality against left normal
+ * forms, on a random word.
+ *
+ * @param n The number of strands.
+ * @param length The length of the word.
+ * @return If they agree.
+ */
+bool normal_forms_agree(i16 n, size_t length) {
+    Word w = random_word(n, length);
+    artin::Braid b = differential::braid_of_word<artin::Factor>(n, w);
+
+    // Reduced words have no handle, and represent the same braid.
+    Word reduced = w;
+    artin_handle::reduce(reduced);
+    if (differential::braid_of_word<artin::Factor>(n, reduced) != b) {
+        return false;
+    }
+
+    // The sign only depends on the braid, and positive braids are positive.
+    i16 sign = artin_handle::sign(w);
+    if (sign != artin_handle::sign(artin_handle::word_of_braid(b)) ||
+        artin_handle::is_trivial(w) != b.is_identity() ||
+        (sign == 0) != b.is_identity() ||
+        (b.inf() >= 0 && !b.is_identity() && sign != 1) ||
+        artin_handle::sign(artin_handle::inverse(w)) != -sign) {
+        return false;
+    }
+
+    // w w^-1 reduces to the empty word.
+    Word trivial = concatenate(w, artin_handle::inverse(w));
+    artin_handle::reduce(trivial);
+    return trivial.empty() && artin_handle::is_trivial(
+                                  concatenate(artin_handle::inverse(w), w));
+}
+
+/**
+ * @brief Checks that `compare` is a left-invariant total order, on random
+ * words.
+ *
+ * @param n The number of strands.
+ * @param length The length of the words.
+ * @return If it is.
+ */
+bool order_axioms_hold(i16 n, size_t length) {
+    Word u = random_word(n, length), v = random_word(n, length),
+         w = random_word(n, length), x = random_word(n, length);
+    i16 uv = artin_handle::compare(u, v), vw = artin_handle::compare(v, w),
+        uw = artin_handle::compare(u, w);
+
+    bool equal = differential::braid_of_word<artin::Factor>(n, u) ==
+                 differential::braid_of_word<artin::Factor>(n, v);
+
+    return artin_handle::compare(u, u) == 0 &&
+           artin_handle::compare(v, u) == -uv && (uv == 0) == equal &&
+           !(uv < 0 && vw < 0 && uw >= 0) && !(uv > 0 && vw > 0 && uw <= 0) &&
+           artin_handle::compare(concatenate(x, u), concatenate(x, v)) == uv;
+}
+
+/**
+ * @brief Times triviality tests of long trivial and non-trivial words, with
+ * handle reduction and with left normal forms, and prints the times.
+ *
+ * @return If both routes agree.
+ */
+bool benchmark() {
+    using Clock = std::chrono::steady_clock;
+    bool agree = true;
+
+    for (i16 n : {4, 8, 16}) {
+        for (size_t length : {100, 1000, 4000}) {
+            std::vector<Word> words;
+            for (size_t _ = 0; _ < 10; _++) {
+                Word w = random_word(n, length / 2);
+                words.push_back(concatenate(w, artin_handle::inverse(w)));
+                words.push_back(random_word(n, length));
+            }
+
+            std::vector<bool> handle, normal_form;
+            Clock::time_point begin = Clock::now();
+            for (const Word &w : words) {
+                handle.push_back(artin_handle::is_trivial(w));
+            }
+            Clock::time_point middle = Clock::now();
+            for (const Word &w : words) {
+                normal_form.push_back(
+                    differential::braid_of_word<artin::Factor>(n, w)
+                        .is_identity());
+            }
+            Clock::time_point end = Clock::now();
+
+            agree = agree && handle == normal_form;
+            std::cout << "n = " << n << ", length " << length
+                      << ": handle reduction "
+                      << std::chrono::duration<double>(middle - begin).count()
+                      << " s, left normal form "
+                      << std::chrono::duration<double>(end - middle).count()
+                      << " s" << std::endl;
+        }
+    }
+    return agree;
+}
+
+int main(int argc, char *argv[]) {
+    seed_random_engine(42);
+
+    if (argc > 1 && std::string(argv[1]) == "benchmark") {
+        return benchmark() ? 0 : 1;
+    }
+
+    size_t failures = 0;
+    for (i16 n = 2; n <= 8; n++) {
+        for (size_t length : {0, 1, 5, 20, 60}) {
+            for (size_t _ = 0; _ < 30; _++) {
+                failures += !normal_forms_agree(n, length);
+                failures += !order_axioms_hold(n, length);
+            }
+        }
+    }
+    std::cout << failures << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
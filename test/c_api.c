@@ -0,0 +1,330 @@
+/**
+ * @file c_api.c
+ * @author GarCide contributors
+ * @brief Checks the C interface, from C: the layout of buffers, their
+ * validation, and the operations on random braids of every group.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/c_api.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief The capacity of buffers.
+ */
+#define CAPACITY 65536
+
+/**
+ * @brief The number of random braids per group.
+ */
+#define ITERATIONS 10
+
+/**
+ * @brief A braid, in a buffer.
+ */
+typedef struct braid {
+    unsigned char data[CAPACITY];
+    size_t size;
+} braid;
+
+/**
+ * @brief The number of failed checks.
+ */
+static size_t failures = 0;
+
+/**
+ * @brief Records a failed check, if `condition` does not hold.
+ *
+ * @param condition The condition.
+ * @param group The name of the group.
+ * @param what What is checked.
+ */
+static void check(int condition, const char *group, const char *what) {
+    if (!condition) {
+        printf("%s: %s\n", group, what);
+        failures++;
+    }
+}
+
+/**
+ * @brief State of the random number generator.
+ */
+static unsigned long long state = 42;
+
+/**
+ * @brief Draws a random integer.
+ *
+ * @param bound The bound.
+ * @return An integer in \f$[\![0, \mathtt{bound}-1]\!]\f$.
+ */
+static size_t random_below(size_t bound) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (size_t)(state >> 33) % bound;
+}
+
+/**
+ * @brief Checks if two braids are equal (outputs are normal forms, so that
+ * equal braids have equal buffers).
+ *
+ * @param a The first braid.
+ * @param b The second braid.
+ * @return If they are equal.
+ */
+static int equal(const braid *a, const braid *b) {
+    return a->size == b->size && memcmp(a->data, b->data, a->size) == 0;
+}
+
+/**
+ * @brief Computes a product, and checks that it succeeds.
+ *
+ * @param g The group.
+ * @param a The left operand.
+ * @param b The right operand.
+ * @param out Set to the product.
+ */
+static void product(const garcide_group *g, const braid *a, const braid *b,
+                    braid *out) {
+    if (garcide_product(g, a->data, a->size, b->data, b->size, out->data,
+                        CAPACITY, &out->size) != GARCIDE_OK) {
+        out->size = 0;
+        failures++;
+    }
+}
+
+/**
+ * @brief Computes an inverse, and checks that it succeeds.
+ *
+ * @param g The group.
+ * @param a The braid.
+ * @param out Set to the inverse.
+ */
+static void inverse(const garcide_group *g, const braid *a, braid *out) {
+    if (garcide_inverse(g, a->data, a->size, out->data, CAPACITY,
+                        &out->size) != GARCIDE_OK) {
+        out->size = 0;
+        failures++;
+    }
+}
+
+/**
+ * @brief Draws a random braid, as a product of atoms and of their inverses.
+ *
+ * @param g The group.
+ * @param length The number of letters.
+ * @param out Set to the braid.
+ */
+static void random_braid(const garcide_group *g, size_t length, braid *out) {
+    static braid a, b;
+    size_t atoms = garcide_number_of_atoms(g);
+    garcide_atom(g, random_below(atoms), out->data, CAPACITY, &out->size);
+    for (size_t i = 1; i < length; i++) {
+        garcide_atom(g, random_below(atoms), a.data, CAPACITY, &a.size);
+        if (random_below(2) == 0) {
+            inverse(g, &a, &b);
+            a = b;
+        }
+        product(g, out, &a, &b);
+        *out = b;
+    }
+}
+
+/**
+ * @brief Conjugates a braid.
+ *
+ * @param g The group.
+ * @param a The braid.
+ * @param c The conjugator.
+ * @param out Set to \f$c^{-1}ac\f$.
+ */
+static void conjugate(const garcide_group *g, const braid *a, const braid *c,
+                      braid *out) {
+    static braid c_inverse, b;
+    inverse(g, c, &c_inverse);
+    product(g, &c_inverse, a, &b);
+    product(g, &b, c, out);
+}
+
+/**
+ * @brief Counts the braids a callback is fed, and asks to stop after
+ * `limit` of them (if it is not zero).
+ */
+typedef struct counter {
+    size_t count;
+    size_t limit;
+} counter;
+
+/**
+ * @brief Callback counting braids, for `counter`.
+ *
+ * @param braid The braid (unused).
+ * @param size Its size (unused).
+ * @param user_data A pointer to a `counter`.
+ * @return Non-zero once the limit is reached.
+ */
+static int count(const unsigned char *braid, size_t size, void *user_data) {
+    counter *c = (counter *)user_data;
+    (void)braid;
+    (void)size;
+    c->count++;
+    return c->limit != 0 && c->count >= c->limit;
+}
+
+/**
+ * @brief Checks the operations of a group on random braids.
+ *
+ * @param name The name of the group.
+ * @param parameter The parameter.
+ */
+static void check_group(const char *name, const char *parameter) {
+    static braid a, b, c, d, e, one;
+    garcide_group *g;
+    size_t header_size = 4 + strlen(parameter) + 4;
+    if (garcide_group_new(name, parameter, &g) != GARCIDE_OK) {
+        check(0, name, "the group is created");
+        return;
+    }
+
+    // The identity is the header, a zero infimum and no factors.
+    garcide_atom(g, 0, a.data, CAPACITY, &a.size);
+    inverse(g, &a, &b);
+    product(g, &a, &b, &one);
+    check(one.size == header_size + 16, name, "the identity has no factors");
+    check(a.size == header_size + 16 + garcide_factor_size(g), name,
+          "an atom has one factor");
+    check(garcide_atom(g, garcide_number_of_atoms(g), c.data, CAPACITY,
+                       &c.size) == GARCIDE_INVALID_ARGUMENT,
+          name, "atom indices are checked");
+
+    for (size_t i = 0; i < ITERATIONS; i++) {
+        random_braid(g, 8, &a);
+        random_braid(g, 4, &b);
+
+        // Outputs are normal forms.
+        check(garcide_normalize(g, a.data, a.size, c.data, CAPACITY,
+                                &c.size) == GARCIDE_OK &&
+                  equal(&a, &c),
+              name, "normal forms are kept");
+        inverse(g, &a, &c);
+        product(g, &a, &c, &d);
+        check(equal(&d, &one), name, "a braid times its inverse is trivial");
+
+        // Conjugacy, with a conjugator.
+        int conjugates = 0;
+        conjugate(g, &a, &b, &c);
+        check(garcide_are_conjugate(g, a.data, a.size, c.data, c.size,
+                                    &conjugates, d.data, CAPACITY,
+                                    &d.size) == GARCIDE_OK &&
+                  conjugates == 1,
+              name, "conjugates are recognized");
+        conjugate(g, &a, &d, &e);
+        check(equal(&e, &c), name, "the conjugator conjugates");
+
+        // Meets divide both operands.
+        check(garcide_left_meet(g, a.data, a.size, c.data, c.size, d.data,
+                                CAPACITY, &d.size) == GARCIDE_OK,
+              name, "the meet is computed");
+        inverse(g, &d, &e);
+        product(g, &e, &a, &b);
+        check(b.size >= header_size + 8 &&
+                  (b.data[header_size + 7] & 0x80) == 0,
+              name, "the meet left-divides the first operand");
+
+        // Callbacks stop the enumeration.
+        counter all = {0, 0}, first = {0, 1};
+        check(garcide_sliding_circuits_set(g, a.data, a.size, count, &all) ==
+                      GARCIDE_OK &&
+                  garcide_sliding_circuits_set(g, a.data, a.size, count,
+                                               &first) == GARCIDE_OK &&
+                  all.count >= 1 && first.count == 1,
+              name, "sliding circuits callbacks stop");
+        all.count = first.count = 0;
+        check(garcide_super_summit_set(g, a.data, a.size, count, &all) ==
+                      GARCIDE_OK &&
+                  garcide_super_summit_set(g, a.data, a.size, count,
+                                           &first) == GARCIDE_OK &&
+                  all.count >= 1 && first.count == 1,
+              name, "super summit callbacks stop");
+    }
+
+    // Invalid buffers are rejected, and so are buffers of other parameters.
+    random_braid(g, 8, &a);
+    check(garcide_normalize(g, a.data, a.size - 1, c.data, CAPACITY,
+                            &c.size) == GARCIDE_INVALID_BUFFER,
+          name, "truncated buffers are rejected");
+    a.data[4] ^= 0x40;
+    check(garcide_normalize(g, a.data, a.size, c.data, CAPACITY, &c.size) ==
+              GARCIDE_INVALID_BUFFER,
+          name, "buffers of other parameters are rejected");
+    garcide_atom(g, 0, a.data, CAPACITY, &a.size);
+    memset(a.data + a.size - garcide_factor_size(g), 0xff,
+           garcide_factor_size(g));
+    check(garcide_normalize(g, a.data, a.size, c.data, CAPACITY, &c.size) ==
+              GARCIDE_INVALID_BUFFER,
+          name, "non-simple factors are rejected");
+    check(garcide_inverse(g, one.data, one.size, c.data, 0, &c.size) ==
+                  GARCIDE_BUFFER_TOO_SMALL &&
+              c.size == one.size,
+          name, "small buffers are reported");
+
+    garcide_group_free(g);
+}
+
+int main(void) {
+    garcide_group *g;
+    check(garcide_group_new("nothing", "3", &g) == GARCIDE_INVALID_ARGUMENT &&
+              g == NULL,
+          "nothing", "unknown groups are rejected");
+    check(garcide_group_new("artin", "x", &g) == GARCIDE_INVALID_ARGUMENT,
+          "artin", "invalid parameters are rejected");
+
+    // The layout of the first atom of `artin` with 3 strands: the header,
+    // then the infimum, the number of factors and the inverse permutation
+    // table of the transposition (1 2).
+    static const unsigned char sigma_1[] = {1, 0, 0, 0, '3', 6, 0, 0, 0, //
+                                            0, 0, 0, 0, 0, 0, 0, 0,      //
+                                            1, 0, 0, 0, 0, 0, 0, 0,      //
+                                            2, 0, 1, 0, 3, 0};
+    static braid a;
+    if (garcide_group_new("artin", "3", &g) == GARCIDE_OK) {
+        check(garcide_atom(g, 0, a.data, CAPACITY, &a.size) == GARCIDE_OK &&
+                  a.size == sizeof(sigma_1) &&
+                  memcmp(a.data, sigma_1, a.size) == 0,
+              "artin", "atoms are laid out as documented");
+        garcide_group_free(g);
+    }
+
+    check_group("artin", "5");
+    check_group("band", "5");
+    check_group("octahedral", "3");
+    check_group("dihedral", "7");
+    check_group("dual_complex", "(3, 2)");
+    check_group("standard_complex", "(3, 3)");
+    check_group("euclidean_lattice", "6");
+    check_group("coxeter", "A3");
+
+    printf("%zu failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
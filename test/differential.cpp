@@ -0,0 +1,285 @@
+/**
+ * @file differential.cpp
+ * @author GarCide contributors
+ * @brief Runs the differential checks on random braids of every group.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/differential.hpp"
+#include "garcide/groups/artin.hpp"
+#include "garcide/groups/band.hpp"
+#include "garcide/groups/coxeter.hpp"
+#include "garcide/groups/dihedral.hpp"
+#include "garcide/groups/dual_complex.hpp"
+#include "garcide/groups/euclidean_lattice.hpp"
+#include "garcide/groups/octahedral.hpp"
+#include "garcide/groups/standard_complex.hpp"
+#include <functional>
+#include <iostream>
+#include <map>
+
+using namespace garcide;
+
+/**
+ * @brief Runs checks on random braids of a group, and reports the first
+ * mismatch.
+ *
+ * @tparam F A class representing factors.
+ * @param parameter The parameter, as a string.
+ * @param checks The checks.
+ * @param tries The number of random braids.
+ * @param length The length of the random words.
+ * @return If all the checks passed.
+ */
+template <class F>
+bool run(const std::string &parameter,
+         const std::vector<differential::Check<F>> &checks, size_t tries,
+         size_t length) {
+    typename F::Parameter p = F::parameter_of_string(parameter);
+    std::optional<differential::Mismatch> mismatch =
+        differential::find_mismatch<F>(p, checks, tries, length, 42);
+    std::cout << parameter << ": ";
+    if (!mismatch) {
+        std::cout << "ok" << std::endl;
+        return true;
+    }
+    std::cout << mismatch->check << " failed on word";
+    for (i16 k : mismatch->word) {
+        std::cout << " " << k;
+    }
+    std::cout << std::endl;
+    return false;
+}
+
+/**
+ * @brief The checks of a group, on parameters small enough for the summit
+ * sets to be computed quickly, and on larger ones without summit sets.
+ *
+ * @tparam F A class representing factors.
+ * @param small A small parameter, as a string.
+ * @param large A larger parameter, as a string.
+ * @param extra Checks that are only run with the small parameter.
+ * @return If all the checks passed.
+ */
+template <class F>
+bool run(const std::string &small, const std::string &large,
+         const std::vector<differential::Check<F>> &extra = {}) {
+    std::vector<differential::Check<F>> checks =
+        differential::default_checks<F>();
+    std::vector<differential::Check<F>> small_checks = checks;
+    small_checks.insert(small_checks.end(), extra.begin(), extra.end());
+    bool ok = run<F>(small, small_checks, 40, 10);
+    // Searches are compared with slower references, on fewer braids.
+    ok = run<F>(small, differential::search_checks<F>(), 10, 10) && ok;
+    checks.pop_back();
+    return run<F>(large, checks, 20, 30) && ok;
+}
+
+/**
+ * @brief Writes a factor as a word in the atoms.
+ *
+ * Atoms that left-divide it are removed one at a time, the first one first.
+ *
+ * @tparam F A class representing factors.
+ * @param f The factor.
+ * @return The letters (as in `differential::braid_of_word`) of a word
+ * representing `f`.
+ */
+template <class F> std::vector<i16> word_of_factor(F f) {
+    std::vector<F> atoms = f.atoms();
+    std::vector<i16> word;
+    while (!f.is_identity()) {
+        size_t k = 0;
+        while (!f.is_left_divisible_by_atom(k, atoms)) {
+            k++;
+        }
+        word.push_back(i16(k + 1));
+        f = atoms[k].right_complement(f);
+    }
+    return word;
+}
+
+/**
+ * @brief Compares `artin` with both structures of `coxeter` of type A, and
+ * with `band`.
+ *
+ * The braid is read as a word in the standard generators, which are the
+ * first atoms of both structures of `coxeter`. The classical structure must
+ * give the same normal form as `artin`, factor by factor, once its factors are
+ * written as words. The dual structure is built on the Coxeter element
+ * \f$\sigma_1\cdots\sigma_{n-1}\f$, and `band` on
+ * \f$\sigma_{n-1}\cdots\sigma_1\f$: the word is flipped (\f$\sigma_i\f$
+ * is sent to \f$\sigma_{n-i}\f$) before it is read in `band`, and both must
+ * agree on infima and suprema.
+ *
+ * @return The check.
+ */
+differential::Check<artin::Factor> coxeter_check() {
+    return {"coxeter", [](const artin::Braid &b) {
+        i16 n = b.get_parameter();
+        artin::Factor delta = artin::Factor(n);
+        delta.delta();
+        std::vector<i16> word, delta_word = word_of_factor(delta);
+        for (i16 i = 0; i < b.inf(); i++) {
+            word.insert(word.end(), delta_word.begin(), delta_word.end());
+        }
+        for (i16 i = 0; i > b.inf(); i--) {
+            for (auto it = delta_word.rbegin(); it != delta_word.rend(); it++) {
+                word.push_back(-*it);
+            }
+        }
+        for (auto it = b.cbegin(); it != b.cend(); it++) {
+            std::vector<i16> factor_word = word_of_factor(*it);
+            word.insert(word.end(), factor_word.begin(), factor_word.end());
+        }
+
+        coxeter::Braid classical = differential::braid_of_word<coxeter::Factor>(
+            coxeter::Factor::parameter_of_string("A" + std::to_string(n - 1)),
+            word);
+        if (classical.inf() != b.inf() ||
+            classical.canonical_length() != b.canonical_length()) {
+            return false;
+        }
+        std::vector<artin::Factor> atoms = delta.atoms();
+        auto it = b.cbegin();
+        for (auto jt = classical.cbegin(); jt != classical.cend(); jt++) {
+            artin::Factor g = artin::Factor(n);
+            g.identity();
+            for (i16 k : word_of_factor(*jt)) {
+                g = g * atoms[k - 1];
+            }
+            if (g != *it++) {
+                return false;
+            }
+        }
+
+        // The generator sigma_i is a_(i+1, i), the atom of index
+        // i(i - 1)/2 + i - 1, and it is flipped.
+        std::vector<i16> band_word;
+        for (i16 k : word) {
+            i16 i = n - ((k > 0) ? k : -k);
+            i16 l = i16(i * (i - 1) / 2 + i);
+            band_word.push_back((k > 0) ? l : -l);
+        }
+        coxeter::Braid dual = differential::braid_of_word<coxeter::Factor>(
+            coxeter::Factor::parameter_of_string("dual A" +
+                                                 std::to_string(n - 1)),
+            word);
+        band::Braid band_braid =
+            differential::braid_of_word<band::Factor>(n, band_word);
+        return dual.inf() == band_braid.inf() &&
+               dual.sup() == band_braid.sup();
+    }};
+}
+
+/**
+ * @brief Compares `dihedral::CompactBraid` with `dihedral::Braid`.
+ *
+ * The compact form of the braid must convert back to it, and products,
+ * inverses, cyclings and conjugates (by the product of the first two atoms)
+ * must agree, as well as the number of elements in the super summit set. The
+ * conjugator `dihedral::are_conjugate` finds must conjugate.
+ *
+ * @return The check.
+ */
+differential::Check<dihedral::Factor> compact_dihedral_check() {
+    return {"compact dihedral", [](const dihedral::Braid &b) {
+        using dihedral::CompactBraid;
+        CompactBraid c(b);
+
+        dihedral::Braid cycled = b;
+        cycled.cycling();
+        CompactBraid compact_cycled = c;
+        compact_cycled.cycling();
+
+        std::vector<dihedral::Factor> atoms =
+            dihedral::Factor(b.get_parameter()).atoms();
+        dihedral::Braid conjugator =
+            dihedral::Braid(atoms[0]) * dihedral::Braid(atoms[1]);
+        dihedral::Braid conjugate = b;
+        conjugate.conjugate(conjugator);
+        CompactBraid compact_conjugate = c;
+        compact_conjugate.conjugate(CompactBraid(conjugator));
+
+        CompactBraid d = CompactBraid(b.get_parameter());
+        if (!dihedral::are_conjugate(c, compact_conjugate, d)) {
+            return false;
+        }
+        CompactBraid e = c;
+        e.conjugate(d);
+
+        return c.to_braid() == b && (c * c).to_braid() == b * b &&
+               c.inverse().to_braid() == b.inverse() &&
+               compact_cycled.to_braid() == cycled &&
+               compact_conjugate.to_braid() == conjugate &&
+               e == compact_conjugate &&
+               dihedral::super_summit_set(c).size() ==
+                   size_t(super_summit::super_summit_set(b).card());
+    }};
+}
+
+int main(int argc, char **argv) {
+    // `artin` is run with 16 strands, the most for which meets have a
+    // vectorized kernel. `dual_complex` is not run with e = 2, for which
+    // sliding circuits sets are not computed in reasonable time.
+    const std::map<std::string, std::function<bool()>> groups = {
+        {"artin",
+         []() { return run<artin::Factor>("5", "16", {coxeter_check()}); }},
+        {"band", []() { return run<band::Factor>("5", "12"); }},
+        {"octahedral",
+         []() {
+             return run<octahedral::Factor>(
+                 "4", "10",
+                 {differential::reference_lattice_check<octahedral::Factor>()});
+         }},
+        {"dihedral",
+         []() {
+             return run<dihedral::Factor>("7", "32",
+                                          {compact_dihedral_check()});
+         }},
+        {"dual_complex",
+         []() {
+             return run<dual_complex::Factor>(
+                 "(3, 4)", "(5, 16)",
+                 {differential::reference_lattice_check<
+                     dual_complex::Factor>()});
+         }},
+        {"standard_complex",
+         []() {
+             return run<standard_complex::Factor>(
+                 "(3, 3)", "(5, 17)",
+                 {differential::reference_lattice_check<
+                     standard_complex::Factor>()});
+         }},
+        {"euclidean_lattice",
+         []() { return run<euclidean_lattice::Factor>("4", "10"); }},
+        {"coxeter", []() { return run<coxeter::Factor>("D5", "E7"); }}};
+
+    if (argc != 2 || groups.count(argv[1]) == 0) {
+        std::cerr << "Usage: " << argv[0] << " <group>" << std::endl;
+        return 2;
+    }
+    return groups.at(argv[1])() ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file dihedral.cpp
+ * @author GarCide contributors
+ * @brief Compares `dihedral::CompactBraid` with `dihedral::Braid`.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/groups/dihedral.hpp"
+#include <iostream>
+#include <unordered_set>
+
+using namespace garcide;
+using dihedral::Braid;
+using dihedral::CompactBraid;
+
+/**
+ * @brief Draws a random braid, that is a power of a short one half of the
+ * time, so that its normal form has long progressions.
+ *
+ * @param n The parameter.
+ * @return A random braid.
+ */
+Braid random_braid(i16 n) {
+    Braid b(n);
+    b.randomize(1 + random_below(8));
+    b.normalize();
+    if (random_below(2) == 0) {
+        Braid c = b;
+        for (u64 _ = random_below(20); _ > 0; _--) {
+            b.right_multiply(c);
+        }
+    }
+    return b;
+}
+
+/**
+ * @brief Checks that `CompactBraid` operations agree with `Braid` ones, on a
+ * pair of random braids.
+ *
+ * @param n The parameter.
+ * @return If they agree.
+ */
+bool operations_agree(i16 n) {
+    Braid b1 = random_braid(n), b2 = random_braid(n);
+    CompactBraid c1(b1), c2(b2);
+
+    Braid conjugate = b1;
+    conjugate.conjugate(b2);
+    CompactBraid compact_conjugate = c1;
+    compact_conjugate.conjugate(c2);
+
+    Braid cycled = b1;
+    cycled.cycling();
+    CompactBraid compact_cycled = c1;
+    compact_cycled.cycling();
+
+    Braid reflected = b1;
+    CompactBraid compact_reflected = c1;
+    i16 v = i16(random_below(n));
+    reflected.right_multiply(dihedral::Factor(n).atoms()[v]);
+    compact_reflected.right_multiply_reflection(v);
+
+    CompactBraid c = CompactBraid(n), d = CompactBraid(n);
+    bool conjugates = are_conjugate(c1, compact_conjugate, c);
+    d = c1;
+    d.conjugate(c);
+
+    return c1.to_braid() == b1 && (c1 * c2).to_braid() == b1 * b2 &&
+           c1 * c2 == CompactBraid(b1 * b2) &&
+           c1.inverse().to_braid() == b1.inverse() &&
+           compact_conjugate.to_braid() == conjugate &&
+           compact_cycled.to_braid() == cycled &&
+           compact_reflected.to_braid() == reflected && conjugates &&
+           d == compact_conjugate;
+}
+
+/**
+ * @brief Checks that equal braids have the same hash, however they were
+ * built, and that braids that only differ by one factor have different ones.
+ *
+ * @param n The parameter.
+ * @return If the hashes behave.
+ */
+bool hashes_agree(i16 n) {
+    Braid b = random_braid(n);
+    CompactBraid c(b);
+
+    // One reflection at a time, so that progressions are cut differently.
+    CompactBraid d(n);
+    for (i16 v : c.vertices()) {
+        d.right_multiply_reflection(v);
+    }
+    d.set_delta(c.inf());
+    if (d != c || d.hash() != c.hash()) {
+        return false;
+    }
+
+    // Changing a factor in the middle of the normal form.
+    std::vector<i16> vertices = c.vertices();
+    if (vertices.size() < 3) {
+        return true;
+    }
+    size_t middle = vertices.size() / 2;
+    for (i16 v = 0; v < n; v++) {
+        if (v == vertices[middle] || v == vertices[middle - 1] ||
+            v == vertices[middle + 1]) {
+            continue;
+        }
+        CompactBraid e(n);
+        for (size_t i = 0; i < vertices.size(); i++) {
+            e.right_multiply_reflection(i == middle ? v : vertices[i]);
+        }
+        e.set_delta(c.inf());
+        if (e == c || e.hash() == c.hash()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that the super summit set of a `CompactBraid` has as many
+ * elements as the one of the corresponding `Braid`.
+ *
+ * @param n The parameter.
+ * @return If they have.
+ */
+bool super_summit_sets_agree(i16 n) {
+    Braid b = random_braid(n);
+    std::vector<CompactBraid> sss = super_summit_set(CompactBraid(b));
+    std::unordered_set<CompactBraid> distinct(sss.begin(), sss.end());
+    return distinct.size() == sss.size() &&
+           i64(sss.size()) == i64(super_summit::super_summit_set(b).card());
+}
+
+int main() {
+    seed_random_engine(42);
+    size_t failures = 0;
+    for (i16 n = 3; n <= 12; n++) {
+        for (size_t _ = 0; _ < 50; _++) {
+            failures += !operations_agree(n);
+            failures += !hashes_agree(n);
+            failures += !super_summit_sets_agree(n);
+        }
+    }
+    std::cout << failures << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
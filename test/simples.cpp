@@ -0,0 +1,211 @@
+/**
+ * @file simples.cpp
+ * @author GarCide contributors
+ * @brief Counts the simple elements of every group, and checks the atom
+ * divisibility tests the enumeration relies on.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/groups/artin.hpp"
+#include "garcide/groups/band.hpp"
+#include "garcide/groups/coxeter.hpp"
+#include "garcide/groups/dihedral.hpp"
+#include "garcide/groups/dual_complex.hpp"
+#include "garcide/groups/euclidean_lattice.hpp"
+#include "garcide/groups/octahedral.hpp"
+#include "garcide/groups/standard_complex.hpp"
+#include <iostream>
+#include <set>
+#include <string>
+
+using namespace garcide;
+
+/**
+ * @brief The bytes of a packed factor, to tell factors apart.
+ *
+ * @tparam F A class representing factors.
+ * @param f The factor.
+ * @return Its packed bytes.
+ */
+template <class F> std::string packed(const F &f) {
+    std::string s(f.packed_size(), '\0');
+    f.pack(reinterpret_cast<u8 *>(&s[0]));
+    return s;
+}
+
+/**
+ * @brief Computes a binomial coefficient.
+ *
+ * @param n The size of the set.
+ * @param k The size of the subsets.
+ * @return \f$\binom nk\f$.
+ */
+size_t binomial(size_t n, size_t k) {
+    size_t b = 1;
+    for (size_t i = 1; i <= k; i++) {
+        b = b * (n - k + i) / i;
+    }
+    return b;
+}
+
+/**
+ * @brief Computes a factorial.
+ *
+ * @param n The integer.
+ * @return \f$n!\f$.
+ */
+size_t factorial(size_t n) { return n <= 1 ? 1 : n * factorial(n - 1); }
+
+/**
+ * @brief Checks the simple elements of a group.
+ *
+ * `for_each_simple` must call its function on `expected` distinct simple
+ * elements (unless `expected` is `0`), the left divisors of \f$\Delta\f$,
+ * and as many when split in chunks. The
+ * atom divisibility tests of every simple element must agree with meets, and
+ * `for_each_left_divisor` must find the simple elements that left-divide it.
+ *
+ * @tparam F A class representing factors.
+ * @param parameter The parameter, as a string.
+ * @param expected The number of simple elements, or `0` if it is not known.
+ * @return The number of failed checks.
+ */
+template <class F>
+size_t check_simples(const std::string &parameter, size_t expected) {
+    F f(F::parameter_of_string(parameter));
+    size_t failures = 0;
+    std::vector<F> simples;
+    std::set<std::string> distinct;
+    f.for_each_simple([&](const F &s) {
+        simples.push_back(s);
+        distinct.insert(packed(s));
+    });
+    F delta = f;
+    delta.delta();
+    for (const F &s : simples) {
+        failures += !(s.left_meet(delta) == s);
+    }
+    failures += distinct.size() != simples.size();
+    failures += expected != 0 && simples.size() != expected;
+
+    // The divisor tree finds the same elements (when `U` enumerates them
+    // directly).
+    std::set<std::string> tree;
+    delta.for_each_left_divisor([&](const F &s) { tree.insert(packed(s)); });
+    failures += tree != distinct;
+
+    // Chunks partition the enumeration.
+    std::set<std::string> chunked;
+    size_t count = 0;
+    for (size_t chunk = 0; chunk < 3; chunk++) {
+        f.for_each_simple(
+            [&](const F &s) {
+                count++;
+                chunked.insert(packed(s));
+            },
+            chunk, 3);
+    }
+    failures += count != simples.size() || chunked != distinct;
+
+    // Dedicated atom divisibility tests agree with meets.
+    std::vector<F> atoms = f.atoms();
+    for (const F &s : simples) {
+        for (size_t k = 0; k < atoms.size(); k++) {
+            failures += s.is_left_divisible_by_atom(k, atoms) !=
+                        (atoms[k].left_meet(s) == atoms[k]);
+            failures += s.is_right_divisible_by_atom(k, atoms) !=
+                        (atoms[k].right_meet(s) == atoms[k]);
+        }
+    }
+
+    // Left divisors of a few simple elements.
+    for (size_t i = 0; i < simples.size(); i += 1 + simples.size() / 8) {
+        std::set<std::string> divisors;
+        simples[i].for_each_left_divisor(
+            [&](const F &d) { divisors.insert(packed(d)); });
+        std::set<std::string> expected_divisors;
+        for (const F &s : simples) {
+            if (s.left_meet(simples[i]) == s) {
+                expected_divisors.insert(packed(s));
+            }
+        }
+        failures += divisors != expected_divisors;
+    }
+
+    if (failures != 0) {
+        std::cout << parameter << ": " << simples.size() << " simples"
+                  << std::endl;
+    }
+    return failures;
+}
+
+int main() {
+    size_t failures = 0;
+    for (size_t n = 2; n <= 6; n++) {
+        // The symmetric group, and non-crossing partitions.
+        failures += check_simples<artin::Factor>(std::to_string(n),
+                                                 factorial(n));
+        failures += check_simples<band::Factor>(
+            std::to_string(n), binomial(2 * n, n) / (n + 1));
+    }
+    for (size_t n = 2; n <= 4; n++) {
+        failures += check_simples<octahedral::Factor>(std::to_string(n),
+                                                      binomial(2 * n, n));
+        // The Coxeter group of type D_n.
+        failures += check_simples<standard_complex::Factor>(
+            "(2, " + std::to_string(n) + ")", factorial(n) << (n - 1));
+    }
+    for (size_t e = 2; e <= 5; e++) {
+        // The dihedral group of order 2e.
+        failures += check_simples<standard_complex::Factor>(
+            "(" + std::to_string(e) + ", 2)", e + 2);
+    }
+    failures += check_simples<standard_complex::Factor>("(3, 3)", 0);
+    // The Catalan numbers of G(e, e, n + 1), products of (d + h) / d over
+    // the degrees d.
+    failures += check_simples<dual_complex::Factor>("(3, 2)", 18);
+    failures += check_simples<dual_complex::Factor>("(4, 2)", 22);
+    failures += check_simples<dual_complex::Factor>("(3, 3)", 65);
+    for (size_t n = 1; n <= 10; n++) {
+        failures += check_simples<euclidean_lattice::Factor>(
+            std::to_string(n), size_t(1) << n);
+    }
+    for (size_t n = 3; n <= 8; n++) {
+        failures +=
+            check_simples<dihedral::Factor>(std::to_string(n), n + 2);
+    }
+    // Orders of Coxeter groups, and their Catalan numbers.
+    failures += check_simples<coxeter::Factor>("A3", 24);
+    failures += check_simples<coxeter::Factor>("B3", 48);
+    failures += check_simples<coxeter::Factor>("D4", 192);
+    failures += check_simples<coxeter::Factor>("H3", 120);
+    failures += check_simples<coxeter::Factor>("F4", 1152);
+    failures += check_simples<coxeter::Factor>("dual A3", 14);
+    failures += check_simples<coxeter::Factor>("dual B3", 20);
+    failures += check_simples<coxeter::Factor>("dual D4", 50);
+    failures += check_simples<coxeter::Factor>("dual H3", 32);
+    std::cout << failures << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file stress.cpp
+ * @author GarCide contributors
+ * @brief Runs summit sets, conjugacy and centralizer computations from many
+ * threads at once, and compares them with serial runs.
+ * @version 1.0.0
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (C) 2026. Distributed under the GNU General Public
+ * License, version 3.
+ *
+ */
+
+/*
+ * GarCide Copyright (C) 2026 GarCide contributors.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License in LICENSE for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "garcide/centralizer.hpp"
+#include "garcide/differential.hpp"
+#include "garcide/groups/artin.hpp"
+#include "garcide/groups/band.hpp"
+#include "garcide/groups/coxeter.hpp"
+#include "garcide/groups/dihedral.hpp"
+#include "garcide/groups/dual_complex.hpp"
+#include "garcide/sliding_circuits.hpp"
+#include "garcide/ultra_summit.hpp"
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using namespace garcide;
+
+/**
+ * @brief The number of threads that run the jobs concurrently.
+ */
+const size_t NUMBER_OF_THREADS = 8;
+
+/**
+ * @brief The number of jobs per group.
+ */
+const u64 JOBS_PER_GROUP = 12;
+
+/**
+ * @brief Draws a random braid, as a word in the atoms and their inverses.
+ *
+ * @tparam F A class representing factors.
+ * @param p The parameter.
+ * @param length The length of the word.
+ * @return The braid.
+ */
+template <class F>
+BraidTemplate<F> random_braid(const typename F::Parameter &p, size_t length) {
+    u64 number_of_atoms = F(p).atoms().size();
+    std::vector<i16> word;
+    for (size_t i = 0; i < length; i++) {
+        i16 k = i16(1 + random_below(number_of_atoms));
+        word.push_back(random_below(2) == 0 ? k : -k);
+    }
+    return differential::braid_of_word<F>(p, word);
+}
+
+/**
+ * @brief Computes summit sets, conjugators and a centralizer for random
+ * braids, and sums the results up.
+ *
+ * The random engine of the calling thread is seeded with `seed`, so that the
+ * result only depends on the parameter and on `seed`.
+ *
+ * @tparam F A class representing factors.
+ * @param parameter The parameter, as a string.
+ * @param seed The seed.
+ * @return A summary of the results.
+ */
+template <class F>
+std::string workload(const std::string &parameter, u64 seed) {
+    seed_random_engine(seed);
+    typename F::Parameter p = F::parameter_of_string(parameter);
+    BraidTemplate<F> b = random_braid<F>(p, 10), x = random_braid<F>(p, 6);
+    BraidTemplate<F> b2 = b;
+    b2.conjugate(x);
+
+    std::ostringstream str;
+    IndentedOStream os(str);
+    b.print(os);
+    os << " " << sliding_circuits::sliding_circuits_set(b).card();
+
+    BraidTemplate<F> c = BraidTemplate<F>(p);
+    BraidTemplate<F> bc = b;
+    bool conjugates = sliding_circuits::are_conjugate(b, b2, c);
+    bc.conjugate(c);
+    if (!conjugates || bc != b2) {
+        os << " wrong conjugator";
+    }
+
+    // Some groups (such as `band`) throw when cycling does not reach ultra
+    // summit sets. This is deterministic, so that it is part of the result.
+    try {
+        os << " " << ultra_summit::ultra_summit_set(b).card() << " "
+           << centralizer::centralizer(b).number_of_generators();
+        bc = b;
+        conjugates = ultra_summit::are_conjugate(b, b2, c);
+        bc.conjugate(c);
+        if (!conjugates || bc != b2) {
+            os << " wrong conjugator";
+        }
+    } catch (ultra_summit::NotUltraSummit<BraidTemplate<F>> const &) {
+        os << " not ultra summit";
+    }
+
+    return str.str();
+}
+
+int main() {
+    std::vector<std::function<std::string()>> jobs;
+    for (u64 seed = 0; seed < JOBS_PER_GROUP; seed++) {
+        jobs.push_back([seed]() { return workload<artin::Factor>("5", seed); });
+        jobs.push_back([seed]() { return workload<band::Factor>("5", seed); });
+        jobs.push_back(
+            [seed]() { return workload<dihedral::Factor>("7", seed); });
+        jobs.push_back([seed]() {
+            return workload<dual_complex::Factor>("(3, 4)", seed);
+        });
+        jobs.push_back(
+            [seed]() { return workload<coxeter::Factor>("D4", seed); });
+    }
+
+    std::vector<std::string> expected;
+    for (const std::function<std::string()> &job : jobs) {
+        expected.push_back(job());
+    }
+
+    // Threads take the jobs in turn, so that different groups run at once.
+    std::vector<std::string> results(jobs.size());
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NUMBER_OF_THREADS; t++) {
+        threads.emplace_back([&jobs, &results, &next]() {
+            for (size_t i = next++; i < jobs.size(); i = next++) {
+                results[i] = jobs[i]();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    size_t failures = 0;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        if (results[i] != expected[i] ||
+            expected[i].find("wrong") != std::string::npos) {
+            std::cout << "Job " << i << ": expected " << expected[i]
+                      << ", got " << results[i] << std::endl;
+            failures++;
+        }
+    }
+    std::cout << failures << " failures" << std::endl;
+    return failures == 0 ? 0 : 1;
+}